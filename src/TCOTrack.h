@@ -1,2 +1,24 @@
 #include "TTTrack.h"
 #include "TTSignal.h"
+#include "TTProfiler.h"
+#include "TTStress.h"
+#include "TTGolden.h"
+#include "TTViewport.h"
+#include "TTDisplay.h"
+#include "TTSync.h"
+#include "TTJournal.h"
+#include "TTSnapshot.h"
+#include "TTFrameBuffer.h"
+#include "TTDirtyRegion.h"
+#include "TTPixelKernels.h"
+#include "TTBandRenderer.h"
+#include "TTChange.h"
+#include "TTInterlocking.h"
+#include "TTMotor.h"
+#include "TTTimeout.h"
+#include "TTBlink.h"
+#include "TTGeneration.h"
+#include "TTIngress.h"
+#include "TTAwait.h"
+#include "TTArena.h"
+#include "TTSyncPty.h"
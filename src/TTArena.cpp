@@ -0,0 +1,91 @@
+//
+//  TTArena.cpp
+//  CocoaSimulator
+//
+
+#include "TTArena.h"
+
+//=============================================================================
+#if TT_ARENA_SIZE > 0
+  uint8_t TTArena::sPool [TT_ARENA_SIZE] ;
+#endif
+uint32_t TTArena::sUsedBytes = 0 ;
+uint32_t TTArena::sRequestedBytes = 0 ;
+uint16_t TTArena::sAllocationCount = 0 ;
+uint16_t TTArena::sOverflowCount = 0 ;
+uint16_t TTArena::sClassCount [kTTNumberOfTileKinds][kTTNumberOfTileScales] ;
+uint32_t TTArena::sClassBytes [kTTNumberOfTileKinds][kTTNumberOfTileScales] ;
+
+//-----------------------------------------------------------------------------
+void * TTArena::allocate (const size_t inSize)
+{
+  const uint32_t size = allocationSize (inSize) ;
+  sRequestedBytes += size ;
+  sAllocationCount++ ;
+#if TT_ARENA_SIZE > 0
+  if (size <= TT_ARENA_SIZE - sUsedBytes) {
+    void * result = sPool + sUsedBytes ;
+    sUsedBytes += size ;
+    return result ;
+  }
+  sOverflowCount++ ;
+#endif
+  return ::operator new (inSize) ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTArena::allocationSize (const size_t inSize)
+{
+  return ((uint32_t)inSize + kAlignment - 1) & ~(uint32_t)(kAlignment - 1) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTArena::release (void * inPointer)
+{
+  if (! contains (inPointer)) {
+    ::operator delete (inPointer) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTArena::contains (const void * inPointer)
+{
+#if TT_ARENA_SIZE > 0
+  const uint8_t * pointer = (const uint8_t *)inPointer ;
+  return pointer >= sPool && pointer < sPool + sUsedBytes ;
+#else
+  (void) inPointer ;
+  return false ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// The pool is filled in order: a tile uses the bytes up to the next tile
+// of the pool, or up to the end of the used part for the last one
+void TTArena::measureFootprint (void)
+{
+  for (uint8_t k = 0 ; k < kTTNumberOfTileKinds ; k++) {
+    for (uint8_t s = 0 ; s < kTTNumberOfTileScales ; s++) {
+      sClassCount [k][s] = 0 ;
+      sClassBytes [k][s] = 0 ;
+    }
+  }
+#if TT_ARENA_SIZE > 0
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    if (contains (tile)) {
+      const uint8_t * start = (const uint8_t *)tile ;
+      const uint8_t * end = sPool + sUsedBytes ;
+      for (const TTTile * other = TTTile::firstTile () ; other != NULL ; other = other->nextTile ()) {
+        const uint8_t * otherStart = (const uint8_t *)other ;
+        if (otherStart > start && otherStart < end && contains (other)) {
+          end = otherStart ;
+        }
+      }
+      const TTTileKind kind = tile->tileKind () ;
+      const TTTileScale scale = tile->tileScale () ;
+      sClassCount [kind][scale]++ ;
+      sClassBytes [kind][scale] += (uint32_t)(end - start) ;
+    }
+  }
+#endif
+}
@@ -0,0 +1,64 @@
+//
+//  TTArena.h
+//  CocoaSimulator
+//
+//  Static pool the tiles are allocated from. The sketch keeps writing
+//  new TTPoint (...), TTTile::operator new takes the bytes from a pool of
+//  TT_ARENA_SIZE bytes: no malloc header and no heap fragmentation for
+//  objects that are never freed. A tile deleted from the pool runs its
+//  destructor but its bytes are not reused.
+//
+//  Sizing: build once with TT_ARENA_SIZE 0, the tiles then go to the heap
+//  and requestedBytes () gives, once the layout is built, the exact value
+//  to set. When the pool is full the next tiles go to the heap and are
+//  counted by overflowCount ().
+//
+//  measureFootprint () walks the tiles in the pool and sums the bytes
+//  they use per class, alignment included. A class is a tile kind at the
+//  scale of its metrics: TTPoint and TTPointT <TTOverviewMetrics> are
+//  counted apart.
+//
+
+#ifndef TTArena_h
+#define TTArena_h
+
+#include "TTTrack.h"
+
+//-----------------------------------------------------------------------------
+class TTArena {
+  public : static void * allocate (const size_t inSize) ;
+  public : static void release (void * inPointer) ;
+  public : static bool contains (const void * inPointer) ;
+  //--- Bytes an object of inSize bytes takes in the pool
+  public : static uint32_t allocationSize (const size_t inSize) ;
+
+  //--- Pool usage, in bytes
+  public : static uint32_t capacity (void) { return TT_ARENA_SIZE ; }
+  public : static uint32_t usedBytes (void) { return sUsedBytes ; }
+  //--- Size the pool needs for every tile allocated so far
+  public : static uint32_t requestedBytes (void) { return sRequestedBytes ; }
+  public : static uint16_t allocationCount (void) { return sAllocationCount ; }
+  public : static uint16_t overflowCount (void) { return sOverflowCount ; }
+
+  //--- Per class footprint of the tiles in the pool, valid after
+  //    measureFootprint (), called once the layout is built
+  public : static void measureFootprint (void) ;
+  public : static uint16_t classCount (const TTTileKind inKind,
+                                       const TTTileScale inScale = kTTDefaultScale) { return sClassCount [inKind][inScale] ; }
+  public : static uint32_t classBytes (const TTTileKind inKind,
+                                       const TTTileScale inScale = kTTDefaultScale) { return sClassBytes [inKind][inScale] ; }
+
+  private : static const size_t kAlignment = __BIGGEST_ALIGNMENT__ ;
+
+#if TT_ARENA_SIZE > 0
+  private : static uint8_t sPool [TT_ARENA_SIZE] __attribute__ ((aligned (__BIGGEST_ALIGNMENT__))) ;
+#endif
+  private : static uint32_t sUsedBytes ;
+  private : static uint32_t sRequestedBytes ;
+  private : static uint16_t sAllocationCount ;
+  private : static uint16_t sOverflowCount ;
+  private : static uint16_t sClassCount [kTTNumberOfTileKinds][kTTNumberOfTileScales] ;
+  private : static uint32_t sClassBytes [kTTNumberOfTileKinds][kTTNumberOfTileScales] ;
+};
+
+#endif /* TTArena_h */
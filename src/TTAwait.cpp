@@ -0,0 +1,132 @@
+//
+//  TTAwait.cpp
+//  CocoaSimulator
+//
+
+#include "TTAwait.h"
+
+#if ! defined (ARDUINO) && defined (__cpp_impl_coroutine)
+
+#include "TTChange.h"
+#include "Arduino.h"
+
+//=============================================================================
+TTPointAwaiter::TTPointAwaiter (const uint8_t inPointId,
+                                const TTPointPosition inPosition,
+                                const uint32_t inDeadline) :
+mPointId (inPointId),
+mPosition (inPosition),
+mDeadline (inDeadline),
+mResult (kTTCommandDone),
+mReady (false),
+mHandle (),
+mNext (NULL)
+{
+}
+
+//-----------------------------------------------------------------------------
+void TTPointAwaiter::await_suspend (std::coroutine_handle <> inHandle)
+{
+  mHandle = inHandle ;
+  TTCommandLoop::add (this) ;
+}
+
+//=============================================================================
+TTPointAwaiter * TTCommandLoop::sFirst = NULL ;
+bool TTCommandLoop::sSubscribed = false ;
+
+//-----------------------------------------------------------------------------
+TTPointAwaiter TTCommandLoop::setPoint (const uint8_t inPointId,
+                                        const TTPointPosition inPosition,
+                                        const uint32_t inTimeout)
+{
+  if (! sSubscribed) {
+    sSubscribed = TTChangeNotifier::subscribeToFeedbacks (0, kTTMaxNumberOfPoints - 1, feedbackChanged) ;
+  }
+  TTPointAwaiter awaiter (inPointId, inPosition, millis () + inTimeout) ;
+  if (! TTAbstractPoint::pointExists (inPointId)) {
+    awaiter.mResult = kTTCommandUnknownPoint ;
+    awaiter.mReady = true ;
+  }
+  else {
+    TTAbstractPoint::setWishedPositionOfPoint (inPointId, inPosition) ;
+    awaiter.mReady = TTAbstractPoint::actualPositionOfPoint (inPointId) == inPosition ;
+  }
+  return awaiter ;
+}
+
+//-----------------------------------------------------------------------------
+void TTCommandLoop::add (TTPointAwaiter * inAwaiter)
+{
+  inAwaiter->mNext = sFirst ;
+  sFirst = inAwaiter ;
+}
+
+//-----------------------------------------------------------------------------
+// Only marks the commands, they are resumed by poll ()
+void TTCommandLoop::feedbackChanged (const uint8_t inPointId,
+                                     const TTPointPosition /* inOldPosition */,
+                                     const TTPointPosition inNewPosition,
+                                     const TTChangeSource /* inSource */,
+                                     void * /* inContext */)
+{
+  for (TTPointAwaiter * awaiter = sFirst ; awaiter != NULL ; awaiter = awaiter->mNext) {
+    if (awaiter->mPointId == inPointId && awaiter->mPosition == inNewPosition && ! awaiter->mReady) {
+      awaiter->mResult = kTTCommandDone ;
+      awaiter->mReady = true ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTCommandLoop::poll (const uint32_t inNow)
+{
+  //--- The completed commands are unlinked first: a resumed coroutine
+  //    may issue new commands
+  TTPointAwaiter * completed = NULL ;
+  TTPointAwaiter ** link = & sFirst ;
+  while (*link != NULL) {
+    TTPointAwaiter * awaiter = *link ;
+    if (! awaiter->mReady && (int32_t)(inNow - awaiter->mDeadline) >= 0) {
+      awaiter->mResult = kTTCommandTimeout ;
+      awaiter->mReady = true ;
+    }
+    if (awaiter->mReady) {
+      *link = awaiter->mNext ;
+      awaiter->mNext = completed ;
+      completed = awaiter ;
+    }
+    else {
+      link = & awaiter->mNext ;
+    }
+  }
+  uint16_t count = 0 ;
+  while (completed != NULL) {
+    TTPointAwaiter * awaiter = completed ;
+    completed = awaiter->mNext ;
+    //--- The awaiter is in the frame of the coroutine, it is gone once
+    //    the coroutine returns
+    const std::coroutine_handle <> handle = awaiter->mHandle ;
+    handle.resume () ;
+    count++ ;
+  }
+  return count ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTCommandLoop::poll (void)
+{
+  return poll (millis ()) ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTCommandLoop::pendingCount (void)
+{
+  uint16_t count = 0 ;
+  for (TTPointAwaiter * awaiter = sFirst ; awaiter != NULL ; awaiter = awaiter->mNext) {
+    count++ ;
+  }
+  return count ;
+}
+
+#endif
@@ -0,0 +1,103 @@
+//
+//  TTAwait.h
+//  CocoaSimulator
+//
+//  Coroutine interface of the points for the host automation scripts,
+//  compiled with C++20 only:
+//
+//    TTTask sequence (void) {
+//      if (co_await TTCommandLoop::setPoint (3, kDiagonalPosition, 2000) != kTTCommandDone) {
+//        ...
+//      }
+//    }
+//
+//  setPoint sets the wished position and the coroutine is resumed when the
+//  feedback reports it, or when the timeout expires. Any number of
+//  commands may be in flight, they are all driven by TTCommandLoop::poll ()
+//  called from the event loop of the script, without threads: a feedback
+//  only marks the command done, the coroutines are resumed by poll (), so
+//  they never run inside a setter of the library.
+//
+
+#ifndef TTAwait_h
+#define TTAwait_h
+
+#include "TTTrack.h"
+
+#if ! defined (ARDUINO) && defined (__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTCommandDone,
+  kTTCommandTimeout,
+  kTTCommandUnknownPoint
+} TTCommandResult ;
+
+//-----------------------------------------------------------------------------
+// Coroutine started at once and destroyed when it returns. A TTTask must
+// not be destroyed while it waits for a command.
+class TTTask {
+  public : class promise_type {
+    public : TTTask get_return_object (void) { return TTTask () ; }
+    public : std::suspend_never initial_suspend (void) noexcept { return std::suspend_never () ; }
+    public : std::suspend_never final_suspend (void) noexcept { return std::suspend_never () ; }
+    public : void return_void (void) {}
+    public : void unhandled_exception (void) { std::terminate () ; }
+  };
+};
+
+//-----------------------------------------------------------------------------
+class TTPointAwaiter {
+  public : TTPointAwaiter (const uint8_t inPointId,
+                           const TTPointPosition inPosition,
+                           const uint32_t inDeadline) ;
+
+  public : bool await_ready (void) const noexcept { return mReady ; }
+  public : void await_suspend (std::coroutine_handle <> inHandle) ;
+  public : TTCommandResult await_resume (void) const noexcept { return mResult ; }
+
+  private : uint8_t mPointId ;
+  private : TTPointPosition mPosition ;
+  private : uint32_t mDeadline ;
+  private : TTCommandResult mResult ;
+  private : bool mReady ;
+  private : std::coroutine_handle <> mHandle ;
+  private : TTPointAwaiter * mNext ;
+
+  friend class TTCommandLoop ;
+};
+
+//-----------------------------------------------------------------------------
+class TTCommandLoop {
+  //--- Sets the wished position of the point, the awaiter completes when
+  //    the actual position is inPosition or after inTimeout ms
+  public : static TTPointAwaiter setPoint (const uint8_t inPointId,
+                                           const TTPointPosition inPosition,
+                                           const uint32_t inTimeout) ;
+
+  //--- Resumes the coroutines whose command is done or timed out
+  public : static uint16_t poll (const uint32_t inNow) ;
+  public : static uint16_t poll (void) ;
+
+  public : static uint16_t pendingCount (void) ;
+
+  private : static void add (TTPointAwaiter * inAwaiter) ;
+  private : static void feedbackChanged (const uint8_t inPointId,
+                                         const TTPointPosition inOldPosition,
+                                         const TTPointPosition inNewPosition,
+                                         const TTChangeSource inSource,
+                                         void * inContext) ;
+
+  //--- Suspended commands
+  private : static TTPointAwaiter * sFirst ;
+  private : static bool sSubscribed ;
+
+  friend class TTPointAwaiter ;
+};
+
+#endif
+
+#endif /* TTAwait_h */
@@ -0,0 +1,181 @@
+//
+//  TTBandRenderer.cpp
+//  CocoaSimulator
+//
+
+#include "TTBandRenderer.h"
+
+#ifndef ARDUINO
+
+#include "TTTrack.h"
+#include "TTDirtyRegion.h"
+#include "Arduino.h"
+
+//=============================================================================
+TTBandRenderer::TTBandRenderer (TTPixel * inPixels,
+                                const uint16_t inWidth,
+                                const uint16_t inHeight,
+                                TTPixelFunction inPixelFunction,
+                                const uint8_t inThreadCount,
+                                const uint16_t inBandHeight) :
+mLastRenderTime (0),
+mWidth (inWidth),
+mHeight (inHeight),
+mBandHeight (inBandHeight > 0 ? inBandHeight : 1),
+mBandCount (0),
+mBands (NULL),
+mOrigin (0, 0),
+mThreadCount (inThreadCount),
+mWorkers (NULL),
+mMutex (),
+mStart (),
+mDone (),
+mGeneration (0),
+mBusyWorkers (0),
+mQuit (false),
+mNextBand (0)
+{
+  mBandCount = (mHeight + mBandHeight - 1) / mBandHeight ;
+  mBands = new TTFrameBuffer * [mBandCount] ;
+  for (uint16_t b = 0 ; b < mBandCount ; b++) {
+    const uint16_t top = b * mBandHeight ;
+    const uint16_t height = mHeight - top < mBandHeight ? mHeight - top : mBandHeight ;
+    mBands [b] = new TTFrameBuffer (inPixels + (uint32_t)top * mWidth, mWidth, height, inPixelFunction, NULL) ;
+    mBands [b]->setStringOrigin (AWPoint (0, top)) ;
+  }
+#ifdef TT_PROFILE
+  mThreadCount = 1 ;
+#else
+  if (mThreadCount == 0) {
+    const unsigned cores = std::thread::hardware_concurrency () ;
+    mThreadCount = cores == 0 ? 1 : (cores > 255 ? 255 : (uint8_t)cores) ;
+  }
+#endif
+  //--- The calling thread draws bands too
+  if (mThreadCount > 1) {
+    mWorkers = new std::thread [mThreadCount - 1] ;
+    for (uint8_t t = 0 ; t < mThreadCount - 1 ; t++) {
+      mWorkers [t] = std::thread (& TTBandRenderer::work, this) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTBandRenderer::~TTBandRenderer (void)
+{
+  {
+    std::lock_guard <std::mutex> lock (mMutex) ;
+    mQuit = true ;
+  }
+  mStart.notify_all () ;
+  if (mWorkers != NULL) {
+    for (uint8_t t = 0 ; t < mThreadCount - 1 ; t++) {
+      mWorkers [t].join () ;
+    }
+    delete [] mWorkers ;
+  }
+  for (uint16_t b = 0 ; b < mBandCount ; b++) {
+    delete mBands [b] ;
+  }
+  delete [] mBands ;
+}
+
+//-----------------------------------------------------------------------------
+void TTBandRenderer::setStringFunction (TTStringFunction inFunction)
+{
+  for (uint16_t b = 0 ; b < mBandCount ; b++) {
+    mBands [b]->setStringFunction (inFunction) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTBandRenderer::render (const AWPoint & inOrigin)
+{
+  const uint32_t start = micros () ;
+  TTDrawTarget * const savedTarget = TTDraw::target () ;
+  const AWPoint savedOffset = TTDraw::offset () ;
+  mOrigin = inOrigin ;
+  mNextBand = 0 ;
+  {
+    std::lock_guard <std::mutex> lock (mMutex) ;
+    mGeneration++ ;
+    mBusyWorkers = mThreadCount - 1 ;
+  }
+  mStart.notify_all () ;
+  drawBands () ;
+  {
+    std::unique_lock <std::mutex> lock (mMutex) ;
+    while (mBusyWorkers > 0) {
+      mDone.wait (lock) ;
+    }
+  }
+  //--- A tile across band edges draws its strings in every band it
+  //    overlaps, only the first band keeps them. From the bottom band up,
+  //    so the band compared to still holds its copy
+  for (uint16_t b = mBandCount ; b > 1 ; b--) {
+    mBands [b - 1]->removeStringsOf (* mBands [b - 2]) ;
+  }
+  //--- Strings, in the order of the bands
+  for (uint16_t b = 0 ; b < mBandCount ; b++) {
+    mBands [b]->endRefresh () ;
+  }
+  TTDraw::setOffset (savedOffset) ;
+  TTDraw::setTarget (savedTarget) ;
+  mLastRenderTime = micros () - start ;
+}
+
+//-----------------------------------------------------------------------------
+void TTBandRenderer::work (void)
+{
+  uint32_t generation = 0 ;
+  while (true) {
+    {
+      std::unique_lock <std::mutex> lock (mMutex) ;
+      while (! mQuit && mGeneration == generation) {
+        mStart.wait (lock) ;
+      }
+      if (mQuit) return ;
+      generation = mGeneration ;
+    }
+    drawBands () ;
+    {
+      std::lock_guard <std::mutex> lock (mMutex) ;
+      mBusyWorkers-- ;
+    }
+    mDone.notify_one () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTBandRenderer::drawBands (void)
+{
+  uint16_t band = mNextBand++ ;
+  while (band < mBandCount) {
+    drawBand (band) ;
+    band = mNextBand++ ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTBandRenderer::drawBand (const uint16_t inBand)
+{
+  TTFrameBuffer * const buffer = mBands [inBand] ;
+  //--- Band in the coordinates of the tiles and in the ones of its buffer
+  const AWRect band (AWPoint (mOrigin.x, mOrigin.y + inBand * mBandHeight),
+                     AWSize (mWidth, buffer->height ())) ;
+  const AWRect clip (AWPoint (0, 0), AWSize (mWidth, buffer->height ())) ;
+  const AWRegion region (clip) ;
+  buffer->beginRect (clip) ;
+  TTDraw::setTarget (buffer) ;
+  TTDraw::setOffset (AWPoint (- band.origin.x, - band.origin.y)) ;
+  TTDraw::setColor (TTBackColor) ;
+  TTDraw::fillRect (band, region) ;
+  //--- The tiles of a viewport are in the coordinates of its layout
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    if (tile->viewport () == NULL && TTDirtyRegion::overlaps (tile->absoluteFrame (), band)) {
+      tile->drawInRegion (region) ;
+    }
+  }
+}
+
+#endif
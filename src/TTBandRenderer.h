@@ -0,0 +1,84 @@
+//
+//  TTBandRenderer.h
+//  CocoaSimulator
+//
+//  Host only renderer for big screens. The framebuffer is split in
+//  horizontal bands drawn by a pool of worker threads, each band through
+//  its own TTFrameBuffer clipped to the band. A pixel belongs to a single
+//  band and the tiles of a band draw in the order of the tile list, so the
+//  result is the same as drawing the whole buffer from one thread.
+//
+//  With TT_PROFILE, whose counters are shared, the bands are drawn from the
+//  calling thread.
+//
+
+#ifndef TTBandRenderer_h
+#define TTBandRenderer_h
+
+#ifndef ARDUINO
+
+#include "TTFrameBuffer.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+//-----------------------------------------------------------------------------
+class TTBandRenderer {
+  //--- inThreadCount 0 uses every core, 1 draws from the calling thread
+  public : TTBandRenderer (TTPixel * inPixels,
+                           const uint16_t inWidth,
+                           const uint16_t inHeight,
+                           TTPixelFunction inPixelFunction,
+                           const uint8_t inThreadCount = 0,
+                           const uint16_t inBandHeight = 32) ;
+  public : ~TTBandRenderer (void) ;
+
+  public : uint8_t threadCount (void) const { return mThreadCount ; }
+  public : uint16_t bandCount (void) const { return mBandCount ; }
+
+  //--- Strings of all the bands, handed over from the calling thread once
+  //    the bands are drawn, in the coordinates of the screen and once each
+  //    when a tile crosses band edges. Not flicker free, see TTFrameBuffer.h
+  public : void setStringFunction (TTStringFunction inFunction) ;
+
+  //--- Fills the buffer with the part of the layout whose top left corner
+  //    is inOrigin, in the coordinates of the tiles. Returns when every
+  //    band is drawn
+  public : void render (const AWPoint & inOrigin) ;
+
+  //--- Duration of the last render, in microseconds
+  private : uint32_t mLastRenderTime ;
+  public : uint32_t lastRenderTime (void) const { return mLastRenderTime ; }
+
+  private : void drawBand (const uint16_t inBand) ;
+  private : void drawBands (void) ;
+  private : void work (void) ;
+
+  private : uint16_t mWidth ;
+  private : uint16_t mHeight ;
+  private : uint16_t mBandHeight ;
+  private : uint16_t mBandCount ;
+  private : TTFrameBuffer ** mBands ;
+  private : AWPoint mOrigin ;
+
+  //--- Pool: a render increments mGeneration, the workers and the calling
+  //    thread take the bands from mNextBand until none is left
+  private : uint8_t mThreadCount ;
+  private : std::thread * mWorkers ;
+  private : std::mutex mMutex ;
+  private : std::condition_variable mStart ;
+  private : std::condition_variable mDone ;
+  private : uint32_t mGeneration ;
+  private : uint8_t mBusyWorkers ;
+  private : bool mQuit ;
+  private : std::atomic <uint16_t> mNextBand ;
+
+  //--- No copy
+  private : TTBandRenderer (const TTBandRenderer &) ;
+  private : TTBandRenderer & operator = (const TTBandRenderer &) ;
+};
+
+#endif
+
+#endif /* TTBandRenderer_h */
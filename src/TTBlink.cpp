@@ -0,0 +1,102 @@
+//
+//  TTBlink.cpp
+//  CocoaSimulator
+//
+
+#include "TTBlink.h"
+#include "TTDirtyRegion.h"
+#include "TTDisplay.h"
+#include "Arduino.h"
+
+//=============================================================================
+TTTile * TTBlinkClock::sTiles [kTTMaxBlinkingTiles] ;
+uint8_t TTBlinkClock::sCount = 0 ;
+uint8_t TTBlinkClock::sKinds = 0 ;
+uint16_t TTBlinkClock::sHalfPeriod = 500 ;
+bool TTBlinkClock::sPhase = true ;
+uint32_t TTBlinkClock::sTickCount = 0 ;
+uint32_t TTBlinkClock::sInvalidatedRects = 0 ;
+uint16_t TTBlinkClock::sDroppedCount = 0 ;
+
+//-----------------------------------------------------------------------------
+void TTBlinkClock::setKinds (const uint8_t inKinds)
+{
+  if (inKinds != sKinds) {
+    //--- Back to the on phase, which is also the steady drawing
+    if (! sPhase) {
+      sPhase = true ;
+      invalidateBlinkingTiles () ;
+    }
+    sKinds = inKinds ;
+    for (TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+      tile->updateBlinking () ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTBlinkClock::setHalfPeriod (const uint16_t inHalfPeriod)
+{
+  sHalfPeriod = inHalfPeriod > 0 ? inHalfPeriod : 1 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTBlinkClock::setBlinking (TTTile * inTile, const bool inBlinking)
+{
+  uint8_t index = 0 ;
+  while (index < sCount && sTiles [index] != inTile) {
+    index++ ;
+  }
+  if (inBlinking && index == sCount) {
+    if (sCount < kTTMaxBlinkingTiles) {
+      sTiles [sCount] = inTile ;
+      sCount++ ;
+    }
+    else {
+      sDroppedCount++ ;
+    }
+  }
+  else if (! inBlinking && index < sCount) {
+    sCount-- ;
+    sTiles [index] = sTiles [sCount] ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// The TTDisplays get the merged rectangles, the viewports and the AWViews
+// still get the rectangle of each tile, merged later when the tiles merge
+// their invalidations (see TTTile::mergeInvalidations)
+void TTBlinkClock::invalidateBlinkingTiles (void)
+{
+  TTDirtyRegion region ;
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    //--- Layout coordinates for the tiles of a viewport
+    if (sTiles [i]->viewport () == NULL) {
+      region.add (sTiles [i]->blinkRect ()) ;
+    }
+  }
+  for (uint8_t i = 0 ; i < region.count () ; i++) {
+    TTDisplay::invalidateOnAllDisplays (region.rectAtIndex (i)) ;
+  }
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    sTiles [i]->invalidateView (sTiles [i]->blinkRect ()) ;
+  }
+  sInvalidatedRects += region.count () ;
+}
+
+//-----------------------------------------------------------------------------
+void TTBlinkClock::update (const uint32_t inNow)
+{
+  const bool phase = ((inNow / sHalfPeriod) & 1) == 0 ;
+  if (phase != sPhase) {
+    sPhase = phase ;
+    sTickCount++ ;
+    invalidateBlinkingTiles () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTBlinkClock::update (void)
+{
+  update (millis ()) ;
+}
@@ -0,0 +1,70 @@
+//
+//  TTBlink.h
+//  CocoaSimulator
+//
+//  Global phase clock of the blinking tiles. The pending wishes, the
+//  failed wishes (see TTTimeout.h) and the alarmed blocks may blink; all
+//  of them follow the same phase. A tile in a blinking state registers
+//  itself, and when the phase flips the blink rectangles of the registered
+//  tiles are merged and invalidated as one batch, so the display traffic
+//  does not grow with one redraw per tile as more points are pending.
+//
+//  Nothing blinks by default.
+//
+
+#ifndef TTBlink_h
+#define TTBlink_h
+
+#include "TTTrack.h"
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTBlinkWishes = 1,
+  kTTBlinkFailures = 2,
+  kTTBlinkAlarms = 4
+} TTBlinkKind ;
+
+static const uint8_t kTTMaxBlinkingTiles = 32 ;
+
+//-----------------------------------------------------------------------------
+class TTBlinkClock {
+  //--- Or of TTBlinkKind
+  public : static void setKinds (const uint8_t inKinds) ;
+  public : static uint8_t kinds (void) { return sKinds ; }
+  public : static bool blinks (const TTBlinkKind inKind) { return (sKinds & inKind) != 0 ; }
+
+  //--- Duration of each phase, 500 ms by default
+  public : static void setHalfPeriod (const uint16_t inHalfPeriod) ;
+  public : static uint16_t halfPeriod (void) { return sHalfPeriod ; }
+
+  //--- Called by the tiles while drawing: false when inKind blinks and
+  //    is in its off phase
+  public : static bool visible (const TTBlinkKind inKind) { return sPhase || (sKinds & inKind) == 0 ; }
+
+  //--- Called by the tiles when they enter or leave a blinking state
+  public : static void setBlinking (TTTile * inTile, const bool inBlinking) ;
+
+  //--- Flips the phase when it is due, called from loop ()
+  public : static void update (const uint32_t inNow) ;
+  public : static void update (void) ;
+
+  //--- Statistics
+  public : static uint8_t blinkingCount (void) { return sCount ; }
+  public : static uint32_t tickCount (void) { return sTickCount ; }
+  public : static uint32_t invalidatedRects (void) { return sInvalidatedRects ; }
+  //--- Tiles that did not blink because the table was full
+  public : static uint16_t droppedCount (void) { return sDroppedCount ; }
+
+  private : static void invalidateBlinkingTiles (void) ;
+
+  private : static TTTile * sTiles [kTTMaxBlinkingTiles] ;
+  private : static uint8_t sCount ;
+  private : static uint8_t sKinds ;
+  private : static uint16_t sHalfPeriod ;
+  private : static bool sPhase ;
+  private : static uint32_t sTickCount ;
+  private : static uint32_t sInvalidatedRects ;
+  private : static uint16_t sDroppedCount ;
+};
+
+#endif /* TTBlink_h */
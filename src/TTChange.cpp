@@ -0,0 +1,168 @@
+//
+//  TTChange.cpp
+//  CocoaSimulator
+//
+
+#include "TTChange.h"
+#include "TTGeneration.h"
+
+//=============================================================================
+TTChangeNotifier::Subscription TTChangeNotifier::sSubscriptions [kTTMaxSubscriptions] ;
+uint8_t TTChangeNotifier::sCount = 0 ;
+
+//-----------------------------------------------------------------------------
+TTChangeNotifier::Subscription * TTChangeNotifier::newSubscription (const Kind inKind,
+                                                                    const uint8_t inFirstId,
+                                                                    const uint8_t inLastId,
+                                                                    void * inContext)
+{
+  if (sCount < kTTMaxSubscriptions && inFirstId <= inLastId) {
+    Subscription * subscription = & sSubscriptions [sCount] ;
+    sCount++ ;
+    subscription->kind = inKind ;
+    subscription->first = inFirstId ;
+    subscription->last = inLastId ;
+    subscription->context = inContext ;
+    return subscription ;
+  }
+  else {
+    return NULL ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTChangeNotifier::subscribeToWishes (const uint8_t inFirstId,
+                                          const uint8_t inLastId,
+                                          TTPointCallback inCallback,
+                                          void * inContext)
+{
+  Subscription * subscription = newSubscription (kWish, inFirstId, inLastId, inContext) ;
+  if (subscription != NULL) {
+    subscription->callback.point = inCallback ;
+  }
+  return subscription != NULL ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTChangeNotifier::subscribeToFeedbacks (const uint8_t inFirstId,
+                                             const uint8_t inLastId,
+                                             TTPointCallback inCallback,
+                                             void * inContext)
+{
+  Subscription * subscription = newSubscription (kFeedback, inFirstId, inLastId, inContext) ;
+  if (subscription != NULL) {
+    subscription->callback.point = inCallback ;
+  }
+  return subscription != NULL ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTChangeNotifier::subscribeToWishFailures (const uint8_t inFirstId,
+                                                const uint8_t inLastId,
+                                                TTPointCallback inCallback,
+                                                void * inContext)
+{
+  Subscription * subscription = newSubscription (kWishFailure, inFirstId, inLastId, inContext) ;
+  if (subscription != NULL) {
+    subscription->callback.point = inCallback ;
+  }
+  return subscription != NULL ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTChangeNotifier::subscribeToDecouplers (const uint8_t inFirstId,
+                                              const uint8_t inLastId,
+                                              TTDecouplerCallback inCallback,
+                                              void * inContext)
+{
+  Subscription * subscription = newSubscription (kDecoupler, inFirstId, inLastId, inContext) ;
+  if (subscription != NULL) {
+    subscription->callback.decoupler = inCallback ;
+  }
+  return subscription != NULL ;
+}
+
+//-----------------------------------------------------------------------------
+void TTChangeNotifier::unsubscribe (void * inContext)
+{
+  uint8_t kept = 0 ;
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    if (sSubscriptions [i].context != inContext) {
+      sSubscriptions [kept] = sSubscriptions [i] ;
+      kept++ ;
+    }
+  }
+  sCount = kept ;
+}
+
+//-----------------------------------------------------------------------------
+void TTChangeNotifier::unsubscribeAll (void)
+{
+  sCount = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTChangeNotifier::wishChanged (const uint8_t inPointId,
+                                    const TTPointPosition inOldPosition,
+                                    const TTPointPosition inNewPosition,
+                                    const TTChangeSource inSource)
+{
+#ifdef TT_GENERATION
+  TTGeneration::touch (kTTPointObject, inPointId) ;
+#endif
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    const Subscription & s = sSubscriptions [i] ;
+    if (s.kind == kWish && inPointId >= s.first && inPointId <= s.last) {
+      s.callback.point (inPointId, inOldPosition, inNewPosition, inSource, s.context) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTChangeNotifier::feedbackChanged (const uint8_t inPointId,
+                                        const TTPointPosition inOldPosition,
+                                        const TTPointPosition inNewPosition)
+{
+#ifdef TT_GENERATION
+  TTGeneration::touch (kTTPointObject, inPointId) ;
+#endif
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    const Subscription & s = sSubscriptions [i] ;
+    if (s.kind == kFeedback && inPointId >= s.first && inPointId <= s.last) {
+      s.callback.point (inPointId, inOldPosition, inNewPosition, kTTRemoteSource, s.context) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTChangeNotifier::wishFailed (const uint8_t inPointId,
+                                   const TTPointPosition inActualPosition,
+                                   const TTPointPosition inWishedPosition)
+{
+#ifdef TT_GENERATION
+  TTGeneration::touch (kTTPointObject, inPointId) ;
+#endif
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    const Subscription & s = sSubscriptions [i] ;
+    if (s.kind == kWishFailure && inPointId >= s.first && inPointId <= s.last) {
+      s.callback.point (inPointId, inActualPosition, inWishedPosition, kTTRemoteSource, s.context) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTChangeNotifier::decouplerChanged (const uint8_t inDecouplerId,
+                                         const bool inOldPosition,
+                                         const bool inNewPosition,
+                                         const TTChangeSource inSource)
+{
+#ifdef TT_GENERATION
+  TTGeneration::touch (kTTDecouplerObject, inDecouplerId) ;
+#endif
+  for (uint8_t i = 0 ; i < sCount ; i++) {
+    const Subscription & s = sSubscriptions [i] ;
+    if (s.kind == kDecoupler && inDecouplerId >= s.first && inDecouplerId <= s.last) {
+      s.callback.decoupler (inDecouplerId, inOldPosition, inNewPosition, inSource, s.context) ;
+    }
+  }
+}
@@ -0,0 +1,104 @@
+//
+//  TTChange.h
+//  CocoaSimulator
+//
+//  Typed change notifications. Instead of one AWAction installed on every
+//  tile, which has to find out which tile fired and poll pendingWish or
+//  positionOfDecoupler, the sketch subscribes a callback to a point, a
+//  decoupler or a range of them and receives the identifier, the old and
+//  the new value and where the change comes from.
+//
+//  The AWAction of the tiles is still sent, except for the changes applied
+//  by a TTSyncDecoder (kTTSyncSource): the board the change comes from has
+//  already acted on it.
+//
+
+#ifndef TTChange_h
+#define TTChange_h
+
+#include "TTTrack.h"
+
+//-----------------------------------------------------------------------------
+typedef void (*TTPointCallback) (const uint8_t inPointId,
+                                 const TTPointPosition inOldPosition,
+                                 const TTPointPosition inNewPosition,
+                                 const TTChangeSource inSource,
+                                 void * inContext) ;
+
+typedef void (*TTDecouplerCallback) (const uint8_t inDecouplerId,
+                                     const bool inOldPosition,
+                                     const bool inNewPosition,
+                                     const TTChangeSource inSource,
+                                     void * inContext) ;
+
+static const uint8_t kTTMaxSubscriptions = 16 ;
+
+//-----------------------------------------------------------------------------
+// Identifiers inFirstId to inLastId included, the same for a single one.
+// The subscribe methods return false when the table is full. Several
+// subscriptions may cover the same identifier, they are called in the
+// order they were made.
+class TTChangeNotifier {
+  //--- Wished position of the points
+  public : static bool subscribeToWishes (const uint8_t inFirstId,
+                                          const uint8_t inLastId,
+                                          TTPointCallback inCallback,
+                                          void * inContext = NULL) ;
+  //--- Actual position of the points
+  public : static bool subscribeToFeedbacks (const uint8_t inFirstId,
+                                             const uint8_t inLastId,
+                                             TTPointCallback inCallback,
+                                             void * inContext = NULL) ;
+  //--- Wishes not reached in time (see TTTimeout.h), the old position is
+  //    the actual one and the new position the wished one
+  public : static bool subscribeToWishFailures (const uint8_t inFirstId,
+                                                const uint8_t inLastId,
+                                                TTPointCallback inCallback,
+                                                void * inContext = NULL) ;
+  public : static bool subscribeToDecouplers (const uint8_t inFirstId,
+                                              const uint8_t inLastId,
+                                              TTDecouplerCallback inCallback,
+                                              void * inContext = NULL) ;
+  //--- Removes every subscription with this context
+  public : static void unsubscribe (void * inContext) ;
+  public : static void unsubscribeAll (void) ;
+
+  //--- Called by the tiles when the value has changed, the object is also
+  //    stamped with a new generation (see TTGeneration.h)
+  public : static void wishChanged (const uint8_t inPointId,
+                                    const TTPointPosition inOldPosition,
+                                    const TTPointPosition inNewPosition,
+                                    const TTChangeSource inSource) ;
+  public : static void feedbackChanged (const uint8_t inPointId,
+                                        const TTPointPosition inOldPosition,
+                                        const TTPointPosition inNewPosition) ;
+  public : static void wishFailed (const uint8_t inPointId,
+                                   const TTPointPosition inActualPosition,
+                                   const TTPointPosition inWishedPosition) ;
+  public : static void decouplerChanged (const uint8_t inDecouplerId,
+                                         const bool inOldPosition,
+                                         const bool inNewPosition,
+                                         const TTChangeSource inSource) ;
+
+  private : typedef enum { kWish, kFeedback, kWishFailure, kDecoupler } Kind ;
+  private : typedef struct {
+    uint8_t kind ;
+    uint8_t first ;
+    uint8_t last ;
+    union {
+      TTPointCallback point ;
+      TTDecouplerCallback decoupler ;
+    } callback ;
+    void * context ;
+  } Subscription ;
+
+  private : static Subscription * newSubscription (const Kind inKind,
+                                                   const uint8_t inFirstId,
+                                                   const uint8_t inLastId,
+                                                   void * inContext) ;
+
+  private : static Subscription sSubscriptions [kTTMaxSubscriptions] ;
+  private : static uint8_t sCount ;
+};
+
+#endif /* TTChange_h */
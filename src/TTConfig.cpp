@@ -13,6 +13,8 @@
 const AWColor inactiveTrackColor = AWColor::lightGray() ;
 const AWColor activeTrackColor = AWColor( 30, 180, 0) ;
 const AWColor wishedPosColor = AWColor::blue() ;
+const AWColor wishFailedColor = AWColor (230, 120, 0) ;
+const AWColor alarmColor = AWColor::red () ;
 const AWColor decoupleColor = AWColor::red() ;
 const AWColor feedbackColor = AWColor::darkGray() ;
 //const AWColor TTBackColor =  awkBackColor;
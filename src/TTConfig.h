@@ -16,9 +16,61 @@
 #define STRAIGHT_TRACK_WIDTH (5)
 #define DIAGONAL_TRACK_WIDTH (7)
 
+//--- Grid of the reduced scale tiles (TTOverviewMetrics)
+#define OVERVIEW_TILE_PIXEL_GRID (12)
+#define OVERVIEW_STRAIGHT_TRACK_WIDTH (3)
+#define OVERVIEW_DIAGONAL_TRACK_WIDTH (5)
+
+//--- Uncomment to count the drawing primitives per tile and per class (see TTProfiler.h)
+//#define TT_PROFILE
+
+//--- Uncomment to record the state changing calls in a ring buffer (see TTJournal.h)
+//#define TT_JOURNAL
+#define TT_JOURNAL_SIZE (256)
+
+//--- Uncomment to stamp the points, decouplers and signals with the
+//    generation of their last change (see TTGeneration.h)
+//#define TT_GENERATION
+
+//--- Lockout of the touches by the routes and the blocks (see
+//    TTInterlocking.h). Off on AVR, where its tables take about 420 bytes
+#ifndef __AVR__
+  #define TT_INTERLOCKING
+#endif
+
+//--- Number of routes and of blocks known by TTInterlocking
+#define TT_MAX_ROUTES (16)
+#define TT_MAX_BLOCKS (32)
+
+//--- Deadline of the pending wishes (see TTTimeout.h). Off on AVR, where
+//    its timing wheel takes about 600 bytes
+#ifndef __AVR__
+  #define TT_WISH_TIMEOUT
+#endif
+
+//--- Changes posted from an interrupt or an other thread, a power of two
+//    up to 128 (see TTIngress.h)
+#define TT_INGRESS_SIZE (64)
+
+//--- Bytes of the static pool the tiles are allocated from. With 0 they go
+//    to the heap and the arena only counts the bytes (see TTArena.h)
+#define TT_ARENA_SIZE (0)
+
+//--- Uncomment for 32 bit framebuffer pixels instead of RGB565 (see TTFrameBuffer.h)
+//#define TT_PIXEL_32
+
+//--- The host build draws from several threads (see TTBandRenderer.h)
+#ifdef ARDUINO
+  #define TT_THREAD_LOCAL
+#else
+  #define TT_THREAD_LOCAL thread_local
+#endif
+
 extern const AWColor inactiveTrackColor ;
 extern const AWColor activeTrackColor ;
 extern const AWColor wishedPosColor ;
+extern const AWColor wishFailedColor ;
+extern const AWColor alarmColor ;
 extern const AWColor decoupleColor ;
 extern const AWColor feedbackColor ;
 extern const AWColor TTBackColor ;
@@ -0,0 +1,163 @@
+//
+//  TTDirtyRegion.cpp
+//  CocoaSimulator
+//
+
+#include "TTDirtyRegion.h"
+
+//-----------------------------------------------------------------------------
+bool TTDirtyRegion::overlaps (const AWRect & inA, const AWRect & inB)
+{
+  return inA.origin.x < inB.origin.x + inB.size.width &&
+         inB.origin.x < inA.origin.x + inA.size.width &&
+         inA.origin.y < inB.origin.y + inB.size.height &&
+         inB.origin.y < inA.origin.y + inA.size.height ;
+}
+
+//-----------------------------------------------------------------------------
+AWRect TTDirtyRegion::boundingBox (const AWRect & inA, const AWRect & inB)
+{
+  const AWInt left = inA.origin.x < inB.origin.x ? inA.origin.x : inB.origin.x ;
+  const AWInt top = inA.origin.y < inB.origin.y ? inA.origin.y : inB.origin.y ;
+  const AWInt rightA = inA.origin.x + inA.size.width ;
+  const AWInt rightB = inB.origin.x + inB.size.width ;
+  const AWInt bottomA = inA.origin.y + inA.size.height ;
+  const AWInt bottomB = inB.origin.y + inB.size.height ;
+  return AWRect (AWPoint (left, top),
+                 AWSize ((rightA > rightB ? rightA : rightB) - left,
+                         (bottomA > bottomB ? bottomA : bottomB) - top)) ;
+}
+
+//-----------------------------------------------------------------------------
+AWRect TTDirtyRegion::intersection (const AWRect & inA, const AWRect & inB)
+{
+  const AWInt left = inA.origin.x > inB.origin.x ? inA.origin.x : inB.origin.x ;
+  const AWInt top = inA.origin.y > inB.origin.y ? inA.origin.y : inB.origin.y ;
+  const AWInt rightA = inA.origin.x + inA.size.width ;
+  const AWInt rightB = inB.origin.x + inB.size.width ;
+  const AWInt bottomA = inA.origin.y + inA.size.height ;
+  const AWInt bottomB = inB.origin.y + inB.size.height ;
+  return AWRect (AWPoint (left, top),
+                 AWSize ((rightA < rightB ? rightA : rightB) - left,
+                         (bottomA < bottomB ? bottomA : bottomB) - top)) ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTDirtyRegion::area (const AWRect & inRect)
+{
+  return (uint32_t)inRect.size.width * (uint32_t)inRect.size.height ;
+}
+
+//=============================================================================
+TTDirtyRegion::TTDirtyRegion (const uint16_t inSetupCost) :
+mSetupCost (inSetupCost),
+mCount (0),
+mAddedCount (0),
+mAddedPixels (0),
+mMergeCount (0)
+{
+}
+
+//-----------------------------------------------------------------------------
+void TTDirtyRegion::resetStatistics (void)
+{
+  mAddedCount = 0 ;
+  mAddedPixels = 0 ;
+  mMergeCount = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTDirtyRegion::intersects (const AWRect & inRect) const
+{
+  for (uint8_t i = 0 ; i < mCount ; i++) {
+    if (overlaps (inRect, mRects [i])) return true ;
+  }
+  return false ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTDirtyRegion::pixels (void) const
+{
+  uint32_t result = 0 ;
+  for (uint8_t i = 0 ; i < mCount ; i++) {
+    result += area (mRects [i]) ;
+  }
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+int32_t TTDirtyRegion::mergeCost (const AWRect & inA, const AWRect & inB) const
+{
+  return (int32_t)area (boundingBox (inA, inB))
+       - (int32_t)area (inA) - (int32_t)area (inB) - (int32_t)mSetupCost ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDirtyRegion::removeAtIndex (const uint8_t inIndex)
+{
+  mCount-- ;
+  for (uint8_t i = inIndex ; i < mCount ; i++) {
+    mRects [i] = mRects [i + 1] ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDirtyRegion::add (const AWRect & inRect)
+{
+  if (inRect.size.width <= 0 || inRect.size.height <= 0) return ;
+  mAddedCount++ ;
+  mAddedPixels += area (inRect) ;
+  //--- Merge as long as it pays, the grown rectangle may now be worth
+  //    merging with an other one
+  AWRect rect = inRect ;
+  bool merged = true ;
+  while (merged) {
+    merged = false ;
+    uint8_t best = 0 ;
+    int32_t bestCost = 0 ;
+    for (uint8_t i = 0 ; i < mCount ; i++) {
+      const int32_t cost = mergeCost (rect, mRects [i]) ;
+      if (cost <= bestCost) {
+        bestCost = cost ;
+        best = i ;
+        merged = true ;
+      }
+    }
+    if (merged) {
+      rect = boundingBox (rect, mRects [best]) ;
+      removeAtIndex (best) ;
+      mMergeCount++ ;
+    }
+  }
+  if (mCount < kMaxRects) {
+    mRects [mCount] = rect ;
+    mCount++ ;
+  }
+  else {
+    //--- Region full, merge the pair that costs the least, the new
+    //    rectangle being at index kMaxRects
+    uint8_t bestA = 0 ;
+    uint8_t bestB = kMaxRects ;
+    int32_t bestCost = INT32_MAX ;
+    for (uint8_t a = 0 ; a < kMaxRects ; a++) {
+      for (uint8_t b = a + 1 ; b <= kMaxRects ; b++) {
+        const int32_t cost = mergeCost (mRects [a], b < kMaxRects ? mRects [b] : rect) ;
+        if (cost < bestCost) {
+          bestCost = cost ;
+          bestA = a ;
+          bestB = b ;
+        }
+      }
+    }
+    if (bestB == kMaxRects) {
+      mRects [bestA] = boundingBox (mRects [bestA], rect) ;
+    }
+    else {
+      mRects [bestA] = boundingBox (mRects [bestA], mRects [bestB]) ;
+      removeAtIndex (bestB) ;
+      mRects [mCount] = rect ;
+      mCount++ ;
+    }
+    mMergeCount++ ;
+  }
+}
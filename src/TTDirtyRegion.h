@@ -0,0 +1,69 @@
+//
+//  TTDirtyRegion.h
+//  CocoaSimulator
+//
+//  Accumulator of the rectangles invalidated by the tiles. Each rectangle
+//  left in the region costs one redraw pass and one transfer to the panel,
+//  so rectangles that overlap or touch are merged whenever the pixels the
+//  bounding box adds cost less than the setup of the pass it saves. A
+//  route or a feedback burst invalidating dozens of tiles ends up as a
+//  handful of rectangles. Used by TTDisplay and, for the AWView that holds
+//  the tiles, by TTTile::mergeInvalidations.
+//
+
+#ifndef TTDirtyRegion_h
+#define TTDirtyRegion_h
+
+#include "AWView.h"
+
+//-----------------------------------------------------------------------------
+class TTDirtyRegion {
+  //--- inSetupCost is the cost of one more rectangle, in pixels: window
+  //    setup on the bus and walk of the tiles
+  public : TTDirtyRegion (const uint16_t inSetupCost = kDefaultSetupCost) ;
+
+  public : static const uint8_t kMaxRects = 8 ;
+  public : static const uint16_t kDefaultSetupCost = 256 ;
+
+  private : uint16_t mSetupCost ;
+  public : uint16_t setupCost (void) const { return mSetupCost ; }
+  public : void setSetupCost (const uint16_t inSetupCost) { mSetupCost = inSetupCost ; }
+
+  public : void add (const AWRect & inRect) ;
+  public : void clear (void) { mCount = 0 ; }
+
+  private : AWRect mRects [kMaxRects] ;
+  private : uint8_t mCount ;
+  public : bool isEmpty (void) const { return mCount == 0 ; }
+  public : uint8_t count (void) const { return mCount ; }
+  public : const AWRect & rectAtIndex (const uint8_t inIndex) const { return mRects [inIndex] ; }
+  public : bool intersects (const AWRect & inRect) const ;
+
+  //--- Pixels covered by the rectangles and cost of the region, overlaps
+  //    counted twice since they are sent twice
+  public : uint32_t pixels (void) const ;
+  public : uint32_t cost (void) const { return pixels () + (uint32_t)mCount * mSetupCost ; }
+
+  //--- Statistics since the last resetStatistics
+  private : uint32_t mAddedCount ;
+  private : uint32_t mAddedPixels ;
+  private : uint32_t mMergeCount ;
+  public : uint32_t addedCount (void) const { return mAddedCount ; }
+  public : uint32_t addedPixels (void) const { return mAddedPixels ; }
+  public : uint32_t mergeCount (void) const { return mMergeCount ; }
+  public : void resetStatistics (void) ;
+
+  //--- Rectangle helpers, also used by TTDisplay
+  public : static bool overlaps (const AWRect & inA, const AWRect & inB) ;
+  public : static AWRect boundingBox (const AWRect & inA, const AWRect & inB) ;
+  //--- Only meaningful when inA and inB overlap
+  public : static AWRect intersection (const AWRect & inA, const AWRect & inB) ;
+  public : static uint32_t area (const AWRect & inRect) ;
+
+  //--- Cost added by replacing inA and inB by their bounding box, negative
+  //    when the merge is worth it
+  private : int32_t mergeCost (const AWRect & inA, const AWRect & inB) const ;
+  private : void removeAtIndex (const uint8_t inIndex) ;
+};
+
+#endif /* TTDirtyRegion_h */
@@ -0,0 +1,271 @@
+//
+//  TTDisplay.cpp
+//  CocoaSimulator
+//
+
+#include "TTDisplay.h"
+#include "TTConfig.h"
+#include "Arduino.h"
+#include <stdlib.h>
+
+//=============================================================================
+TTDisplay * TTDisplay::sFirstDisplay = NULL ;
+
+//-----------------------------------------------------------------------------
+TTDisplay::TTDisplay (TTDrawTarget * inTarget,
+                      const AWRect & inBounds,
+                      const uint16_t inMinimumInterval) :
+mNextDisplay (sFirstDisplay),
+mTarget (inTarget),
+mBounds (inBounds),
+mMinimumInterval (inMinimumInterval),
+mLastRefresh (0),
+mDirtyRegion (),
+mFrameCount (0),
+mPaintPhase (kTTPaintDone),
+mPaintStart (0),
+mTimeToInteractive (0)
+{
+  sFirstDisplay = this ;
+  invalidateAll () ;
+}
+
+//-----------------------------------------------------------------------------
+TTDisplay::~TTDisplay (void)
+{
+  TTDisplay * previous = NULL ;
+  TTDisplay * display = sFirstDisplay ;
+  while (display != NULL && display != this) {
+    previous = display ;
+    display = display->mNextDisplay ;
+  }
+  if (display != NULL) {
+    if (previous == NULL) {
+      sFirstDisplay = mNextDisplay ;
+    }
+    else {
+      previous->mNextDisplay = mNextDisplay ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::setBounds (const AWRect & inBounds)
+{
+  mBounds = inBounds ;
+  invalidateAll () ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::invalidateAll (void)
+{
+  mDirtyRegion.clear () ;
+  mDirtyRegion.add (mBounds) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::invalidate (const AWRect & inRect)
+{
+  if (TTDirtyRegion::overlaps (inRect, mBounds)) {
+    mDirtyRegion.add (inRect) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::invalidateOnAllDisplays (const AWRect & inRect)
+{
+  for (TTDisplay * display = sFirstDisplay ; display != NULL ; display = display->mNextDisplay) {
+    display->invalidate (inRect) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTDisplay::refresh (void)
+{
+  if (mPaintPhase != kTTPaintDone) {
+    drawPaintPhase () ;
+    return true ;
+  }
+  if (mDirtyRegion.isEmpty ()) return false ;
+  const uint32_t now = millis () ;
+  if (mFrameCount > 0 && (uint32_t)(now - mLastRefresh) < mMinimumInterval) return false ;
+  mLastRefresh = now ;
+
+  TTDrawTarget * const savedTarget = TTDraw::target () ;
+  const AWPoint savedOffset = TTDraw::offset () ;
+  TTDraw::setTarget (mTarget) ;
+  TTDraw::setOffset (AWPoint (- mBounds.origin.x, - mBounds.origin.y)) ;
+  //--- Tiles invalidated while drawing go to the next refresh
+  const uint8_t count = mDirtyRegion.count () ;
+  AWRect rects [kMaxDirtyRects] ;
+  for (uint8_t i = 0 ; i < count ; i++) {
+    rects [i] = mDirtyRegion.rectAtIndex (i) ;
+  }
+  mDirtyRegion.clear () ;
+  for (uint8_t i = 0 ; i < count ; i++) {
+    drawRect (rects [i]) ;
+  }
+  if (mTarget != NULL) {
+    mTarget->endRefresh () ;
+  }
+  TTDraw::setOffset (savedOffset) ;
+  TTDraw::setTarget (savedTarget) ;
+  mFrameCount++ ;
+  return true ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::refreshAll (void)
+{
+  for (TTDisplay * display = sFirstDisplay ; display != NULL ; display = display->mNextDisplay) {
+    display->refresh () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::drawRect (const AWRect & inRect) const
+{
+  //--- The region is in the coordinates of the target
+  AWRect clip = inRect ;
+  clip.translateBy (- mBounds.origin.x, - mBounds.origin.y) ;
+  const AWRegion region (clip) ;
+  if (mTarget != NULL) {
+    mTarget->beginRect (clip) ;
+  }
+  TTDraw::setColor (TTBackColor) ;
+  TTDraw::fillRect (inRect, region) ;
+  //--- The tiles of a viewport are in the coordinates of its layout, the
+  //    viewport draws them
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    if (tile->viewport () == NULL && TTDirtyRegion::overlaps (tile->absoluteFrame (), inRect)) {
+      tile->drawInRegion (region) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTPaintPhase TTDisplay::paintPhaseOfKind (const TTTileKind inKind)
+{
+  switch (inKind) {
+    case kTTPointKind :
+    case kTTDoublePointKind :
+    case kTTDecouplerKind :
+    case kTTSignalKind :
+      return kTTPaintInteractive ;
+    case kTTTrackKind :
+    case kTTBlockKind :
+    case kTTSlipKind :
+    case kTTDiagKind :
+    case kTTBufferKind :
+      return kTTPaintTrack ;
+    default :
+      return kTTPaintDecorations ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::beginFirstPaint (void)
+{
+  mDirtyRegion.clear () ;
+  mPaintPhase = kTTPaintInteractive ;
+  mPaintStart = millis () ;
+  mTimeToInteractive = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+// Screen tile of a display, for invalidatePhaseOverlaps
+typedef struct {
+  AWRect frame ;
+  TTPaintPhase phase ;
+} TTPhasedFrame ;
+
+//-----------------------------------------------------------------------------
+static int compareLeftSides (const void * inA, const void * inB)
+{
+  const AWInt a = ((const TTPhasedFrame *) inA)->frame.origin.x ;
+  const AWInt b = ((const TTPhasedFrame *) inB)->frame.origin.x ;
+  return (a > b) - (a < b) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::invalidatePhaseOverlaps (void)
+{
+  //--- The screen tiles of the display, the viewport of a tile is looked
+  //    up once
+  uint16_t tileCount = 0 ;
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    tileCount++ ;
+  }
+  TTPhasedFrame * frames = new TTPhasedFrame [tileCount] ;
+  uint16_t count = 0 ;
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    const AWRect frame = tile->absoluteFrame () ;
+    if (TTDirtyRegion::overlaps (frame, mBounds) && tile->viewport () == NULL) {
+      frames [count].frame = frame ;
+      frames [count].phase = paintPhaseOfKind (tile->tileKind ()) ;
+      count++ ;
+    }
+  }
+  //--- Sorted by their left side, a tile is only compared with the tiles
+  //    starting before its right side
+  qsort (frames, count, sizeof (TTPhasedFrame), compareLeftSides) ;
+  for (uint16_t i = 0 ; i < count ; i++) {
+    const AWRect & frame = frames [i].frame ;
+    const AWInt right = frame.origin.x + frame.size.width ;
+    for (uint16_t j = i + 1 ; j < count && frames [j].frame.origin.x < right ; j++) {
+      if (frames [j].phase != frames [i].phase && TTDirtyRegion::overlaps (frames [j].frame, frame)) {
+        invalidate (TTDirtyRegion::intersection (frames [j].frame, frame)) ;
+      }
+    }
+  }
+  delete [] frames ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTDisplay::touchesEnabled (void)
+{
+  for (const TTDisplay * display = sFirstDisplay ; display != NULL ; display = display->mNextDisplay) {
+    if (display->mPaintPhase == kTTPaintInteractive) {
+      return false ;
+    }
+  }
+  return true ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDisplay::drawPaintPhase (void)
+{
+  const uint32_t now = millis () ;
+  mLastRefresh = now ;
+  TTDrawTarget * const savedTarget = TTDraw::target () ;
+  const AWPoint savedOffset = TTDraw::offset () ;
+  TTDraw::setTarget (mTarget) ;
+  TTDraw::setOffset (AWPoint (- mBounds.origin.x, - mBounds.origin.y)) ;
+  AWRect clip = mBounds ;
+  clip.translateBy (- mBounds.origin.x, - mBounds.origin.y) ;
+  const AWRegion region (clip) ;
+  if (mTarget != NULL) {
+    mTarget->beginRect (clip) ;
+  }
+  if (mPaintPhase == kTTPaintInteractive) {
+    TTDraw::setColor (TTBackColor) ;
+    TTDraw::fillRect (mBounds, region) ;
+  }
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    const AWRect frame = tile->absoluteFrame () ;
+    if (tile->viewport () == NULL && paintPhaseOfKind (tile->tileKind ()) == mPaintPhase && TTDirtyRegion::overlaps (frame, mBounds)) {
+      tile->drawInRegion (region) ;
+    }
+  }
+  if (mTarget != NULL) {
+    mTarget->endRefresh () ;
+  }
+  TTDraw::setOffset (savedOffset) ;
+  TTDraw::setTarget (savedTarget) ;
+  mFrameCount++ ;
+  if (mPaintPhase == kTTPaintInteractive) {
+    mTimeToInteractive = millis () - mPaintStart ;
+    invalidatePhaseOverlaps () ;
+  }
+  mPaintPhase = (TTPaintPhase)(mPaintPhase + 1) ;
+}
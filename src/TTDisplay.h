@@ -0,0 +1,115 @@
+//
+//  TTDisplay.h
+//  CocoaSimulator
+//
+//  Additional screens showing the same tiles as the ArduinoWidgets views.
+//  The state of the tiles is shared, each display only keeps the list of
+//  the rectangles it still has to redraw and refreshes them at its own
+//  pace through its own TTDrawTarget, so a slow screen never delays the
+//  other ones.
+//
+//  At boot the whole layout is dirty. beginFirstPaint () splits that paint
+//  over three refreshes: the tiles the operator touches first (points,
+//  double points, decouplers, signals), then the rest of the track, then
+//  the decorations. The loop goes back to the touch screen after each
+//  step, so the panel answers as soon as the first one is on screen. The
+//  touches are ignored until then, so a point is never toggled before it
+//  is on screen.
+//
+//  Only the TTDisplays paint progressively: the primary ArduinoWidgets
+//  view is painted by the library in one pass. A sketch wanting it for
+//  the primary panel too drives that panel through a TTDisplay.
+//
+
+#ifndef TTDisplay_h
+#define TTDisplay_h
+
+#include "TTTrack.h"
+#include "TTDirtyRegion.h"
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTPaintInteractive,
+  kTTPaintTrack,
+  kTTPaintDecorations,
+  kTTPaintDone
+} TTPaintPhase ;
+
+//-----------------------------------------------------------------------------
+class TTDisplay {
+  public : TTDisplay (TTDrawTarget * inTarget,
+                      const AWRect & inBounds,
+                      const uint16_t inMinimumInterval = 0) ;
+  public : ~TTDisplay (void) ;
+
+  //--- All the displays, in construction order
+  private : static TTDisplay * sFirstDisplay ;
+  private : TTDisplay * mNextDisplay ;
+  public : static TTDisplay * firstDisplay (void) { return sFirstDisplay ; }
+  public : TTDisplay * nextDisplay (void) const { return mNextDisplay ; }
+
+  //--- Where the primitives go and the part of the layout shown, in the
+  //    coordinates of the tiles. It is drawn at the origin of the target
+  private : TTDrawTarget * mTarget ;
+  private : AWRect mBounds ;
+  public : TTDrawTarget * target (void) const { return mTarget ; }
+  public : const AWRect & bounds (void) const { return mBounds ; }
+  public : void setBounds (const AWRect & inBounds) ;
+
+  //--- Minimum time between two refreshes, in ms
+  private : uint16_t mMinimumInterval ;
+  private : uint32_t mLastRefresh ;
+  public : void setMinimumInterval (const uint16_t inInterval) { mMinimumInterval = inInterval ; }
+
+  //--- Rectangles to redraw, in the coordinates of the tiles. The setup
+  //    cost of the region is the one of a redraw on this display
+  public : static const uint8_t kMaxDirtyRects = TTDirtyRegion::kMaxRects ;
+  private : TTDirtyRegion mDirtyRegion ;
+  public : uint8_t dirtyRectCount (void) const { return mDirtyRegion.count () ; }
+  public : TTDirtyRegion & dirtyRegion (void) { return mDirtyRegion ; }
+  public : void invalidate (const AWRect & inRect) ;
+  public : void invalidateAll (void) ;
+
+  //--- Called by the tiles when they change
+  public : static void invalidateOnAllDisplays (const AWRect & inRect) ;
+
+  //--- Redraw the dirty rectangles if the interval has elapsed. Returns
+  //    true if something was drawn
+  public : bool refresh (void) ;
+  public : static void refreshAll (void) ;
+
+  //--- Number of refreshes that drew something
+  private : uint32_t mFrameCount ;
+  public : uint32_t frameCount (void) const { return mFrameCount ; }
+
+  //--- Progressive first paint, the next refreshes draw the phases in
+  //    order without waiting for the minimum interval. The rectangles
+  //    invalidated meanwhile are drawn after the last phase
+  private : TTPaintPhase mPaintPhase ;
+  private : uint32_t mPaintStart ;
+  private : uint32_t mTimeToInteractive ;
+  public : void beginFirstPaint (void) ;
+  public : TTPaintPhase paintPhase (void) const { return mPaintPhase ; }
+  public : static TTPaintPhase paintPhaseOfKind (const TTTileKind inKind) ;
+  //--- The interactive tiles are on screen
+  public : bool interactive (void) const { return mPaintPhase > kTTPaintInteractive ; }
+  //--- False while a display has not painted its interactive tiles, the
+  //    tiles ignore the touches meanwhile
+  public : static bool touchesEnabled (void) ;
+  //--- From beginFirstPaint () to the end of the first phase, in ms
+  public : uint32_t timeToFirstInteractive (void) const { return mTimeToInteractive ; }
+
+  private : void drawRect (const AWRect & inRect) const ;
+  private : void drawPaintPhase (void) ;
+  //--- Where a tile covers a tile of another phase, the order of
+  //    construction is restored by a normal refresh after the last phase.
+  //    Done once the interactive tiles are on screen, so the search does
+  //    not delay them
+  private : void invalidatePhaseOverlaps (void) ;
+
+  //--- No copy
+  private : TTDisplay (const TTDisplay &) ;
+  private : TTDisplay & operator = (const TTDisplay &) ;
+};
+
+#endif /* TTDisplay_h */
@@ -0,0 +1,225 @@
+//
+//  TTDraw.cpp
+//  CocoaSimulator
+//
+
+#include "TTDraw.h"
+#include "TTProfiler.h"
+#include "AWContext.h"
+
+//=============================================================================
+TTDrawCounters::TTDrawCounters (void)
+{
+  reset () ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDrawCounters::reset (void)
+{
+  for (uint8_t p = 0 ; p < kTTNumberOfPrimitives ; p++) {
+    mCalls [p] = 0 ;
+    mPixels [p] = 0 ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDrawCounters::add (const TTPrimitiveKind inPrimitive, const uint32_t inPixels)
+{
+  mCalls [inPrimitive]++ ;
+  mPixels [inPrimitive] += inPixels ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDrawCounters::add (const TTDrawCounters & inCounters)
+{
+  for (uint8_t p = 0 ; p < kTTNumberOfPrimitives ; p++) {
+    mCalls [p] += inCounters.mCalls [p] ;
+    mPixels [p] += inCounters.mPixels [p] ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTDrawCounters::totalCalls (void) const
+{
+  uint16_t result = 0 ;
+  for (uint8_t p = 0 ; p < kTTNumberOfPrimitives ; p++) {
+    result += mCalls [p] ;
+  }
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTDrawCounters::totalPixels (void) const
+{
+  uint32_t result = 0 ;
+  for (uint8_t p = 0 ; p < kTTNumberOfPrimitives ; p++) {
+    result += mPixels [p] ;
+  }
+  return result ;
+}
+
+//=============================================================================
+#ifdef TT_PROFILE
+static uint32_t rectArea (const AWRect & inRect)
+{
+  if (inRect.size.width > 0 && inRect.size.height > 0) {
+    return (uint32_t)inRect.size.width * (uint32_t)inRect.size.height ;
+  }
+  else {
+    return 0 ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+static uint32_t rectPerimeter (const AWRect & inRect)
+{
+  if (inRect.size.width > 1 && inRect.size.height > 1) {
+    return 2 * (uint32_t)(inRect.size.width + inRect.size.height) - 4 ;
+  }
+  else {
+    return rectArea (inRect) ;
+  }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+TT_THREAD_LOCAL AWColor TTDraw::sColor ;
+TT_THREAD_LOCAL TTDrawTarget * TTDraw::sTarget = NULL ;
+TT_THREAD_LOCAL AWPoint TTDraw::sOffset (0, 0) ;
+
+//-----------------------------------------------------------------------------
+void TTDraw::setColor (const AWColor & inColor)
+{
+  sColor = inColor ;
+  AWContext::setColor (inColor) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::fillRect (const AWRect & inRect,
+                       const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  TTProfiler::record (kTTFillRect, rectArea (inRect)) ;
+#endif
+  AWRect r = inRect ;
+  r.translateBy (sOffset.x, sOffset.y) ;
+  if (sTarget != NULL) {
+    sTarget->fillRect (r, sColor, inDrawRegion) ;
+  }
+  else {
+    r.fillRectInRegion (inDrawRegion) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::frameRect (const AWRect & inRect,
+                        const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  TTProfiler::record (kTTFrameRect, rectPerimeter (inRect)) ;
+#endif
+  AWRect r = inRect ;
+  r.translateBy (sOffset.x, sOffset.y) ;
+  if (sTarget != NULL) {
+    sTarget->frameRect (r, sColor, inDrawRegion) ;
+  }
+  else {
+    r.frameRectInRegion (inDrawRegion) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::fillRoundRect (const AWRect & inRect,
+                            const AWInt inRadius,
+                            const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  TTProfiler::record (kTTFillRoundRect, rectArea (inRect)) ;
+#endif
+  AWRect r = inRect ;
+  r.translateBy (sOffset.x, sOffset.y) ;
+  if (sTarget != NULL) {
+    sTarget->fillRoundRect (r, inRadius, sColor, inDrawRegion) ;
+  }
+  else {
+    r.fillRoundRectInRegion (inRadius, inDrawRegion) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::frameRoundRect (const AWRect & inRect,
+                             const AWInt inRadius,
+                             const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  TTProfiler::record (kTTFrameRoundRect, rectPerimeter (inRect)) ;
+#endif
+  AWRect r = inRect ;
+  r.translateBy (sOffset.x, sOffset.y) ;
+  if (sTarget != NULL) {
+    sTarget->frameRoundRect (r, inRadius, sColor, inDrawRegion) ;
+  }
+  else {
+    r.frameRoundRectInRegion (inRadius, inDrawRegion) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::fillOval (const AWRect & inRect,
+                       const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  //--- pi / 4 of the bounding box
+  TTProfiler::record (kTTFillOval, (rectArea (inRect) * 201) / 256) ;
+#endif
+  AWRect r = inRect ;
+  r.translateBy (sOffset.x, sOffset.y) ;
+  if (sTarget != NULL) {
+    sTarget->fillOval (r, sColor, inDrawRegion) ;
+  }
+  else {
+    r.fillOvalInRegion (inDrawRegion) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::strokeLine (const AWPoint & inFrom,
+                         const AWPoint & inTo,
+                         const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  const AWInt dx = inTo.x > inFrom.x ? inTo.x - inFrom.x : inFrom.x - inTo.x ;
+  const AWInt dy = inTo.y > inFrom.y ? inTo.y - inFrom.y : inFrom.y - inTo.y ;
+  TTProfiler::record (kTTStrokeLine, (uint32_t)(dx > dy ? dx : dy) + 1) ;
+#endif
+  AWPoint from = inFrom ;
+  from.translateBy (sOffset) ;
+  AWPoint to = inTo ;
+  to.translateBy (sOffset) ;
+  if (sTarget != NULL) {
+    sTarget->strokeLine (from, to, sColor, inDrawRegion) ;
+  }
+  else {
+    from.strokeLineInRegion (to, inDrawRegion) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTDraw::drawString (const AWFont & inFont,
+                         const AWInt inX,
+                         const AWInt inY,
+                         const String & inString,
+                         const AWRegion & inDrawRegion)
+{
+#ifdef TT_PROFILE
+  TTProfiler::record (kTTDrawString, (uint32_t)inFont.stringLength (inString) * (uint32_t)inFont.ascent ()) ;
+#endif
+  const AWInt x = inX + sOffset.x ;
+  const AWInt y = inY + sOffset.y ;
+  if (sTarget != NULL) {
+    sTarget->drawString (inFont, x, y, inString, sColor, inDrawRegion) ;
+  }
+  else {
+    inFont.drawStringInRegion (x, y, inString, inDrawRegion) ;
+  }
+}
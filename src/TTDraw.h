@@ -0,0 +1,130 @@
+//
+//  TTDraw.h
+//  CocoaSimulator
+//
+//  Drawing primitives used by the tiles. Every tile draws through TTDraw
+//  instead of calling the ArduinoWidgets primitives directly so the
+//  primitive stream can be observed (see TTProfiler) or redirected to
+//  another TTDrawTarget (see TTGolden).
+//
+
+#ifndef TTDraw_h
+#define TTDraw_h
+
+#include "AWView.h"
+#include "AWFont.h"
+#include "TTConfig.h"
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTFillRect,
+  kTTFrameRect,
+  kTTFillRoundRect,
+  kTTFrameRoundRect,
+  kTTFillOval,
+  kTTStrokeLine,
+  kTTDrawString,
+  kTTNumberOfPrimitives
+} TTPrimitiveKind ;
+
+//-----------------------------------------------------------------------------
+// Number of calls and number of pixels covered (before clipping) for each
+// kind of primitive.
+class TTDrawCounters {
+  public : TTDrawCounters (void) ;
+
+  public : void reset (void) ;
+  public : void add (const TTPrimitiveKind inPrimitive, const uint32_t inPixels) ;
+  public : void add (const TTDrawCounters & inCounters) ;
+
+  public : uint16_t calls (const TTPrimitiveKind inPrimitive) const { return mCalls [inPrimitive] ; }
+  public : uint32_t pixels (const TTPrimitiveKind inPrimitive) const { return mPixels [inPrimitive] ; }
+  public : uint16_t totalCalls (void) const ;
+  public : uint32_t totalPixels (void) const ;
+
+  private : uint16_t mCalls [kTTNumberOfPrimitives] ;
+  private : uint32_t mPixels [kTTNumberOfPrimitives] ;
+};
+
+//-----------------------------------------------------------------------------
+// Receiver of the primitives when it is not the ArduinoWidgets context.
+// The color is the one of the last TTDraw::setColor.
+class TTDrawTarget {
+  public : virtual ~TTDrawTarget (void) {}
+
+  //--- Called by TTDisplay before drawing each dirty rectangle, in the
+  //    coordinates of the target, and once all of them are drawn
+  public : virtual void beginRect (const AWRect & /* inRect */) {}
+  public : virtual void endRefresh (void) {}
+
+  public : virtual void fillRect (const AWRect & inRect,
+                                  const AWColor & inColor,
+                                  const AWRegion & inDrawRegion) = 0 ;
+  public : virtual void frameRect (const AWRect & inRect,
+                                   const AWColor & inColor,
+                                   const AWRegion & inDrawRegion) = 0 ;
+  public : virtual void fillRoundRect (const AWRect & inRect,
+                                       const AWInt inRadius,
+                                       const AWColor & inColor,
+                                       const AWRegion & inDrawRegion) = 0 ;
+  public : virtual void frameRoundRect (const AWRect & inRect,
+                                        const AWInt inRadius,
+                                        const AWColor & inColor,
+                                        const AWRegion & inDrawRegion) = 0 ;
+  public : virtual void fillOval (const AWRect & inRect,
+                                  const AWColor & inColor,
+                                  const AWRegion & inDrawRegion) = 0 ;
+  public : virtual void strokeLine (const AWPoint & inFrom,
+                                    const AWPoint & inTo,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion) = 0 ;
+  public : virtual void drawString (const AWFont & inFont,
+                                    const AWInt inX,
+                                    const AWInt inY,
+                                    const String & inString,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion) = 0 ;
+};
+
+//-----------------------------------------------------------------------------
+class TTDraw {
+  //--- Current color
+  public : static void setColor (const AWColor & inColor) ;
+  public : static const AWColor & color (void) { return sColor ; }
+
+  //--- Current target, NULL for the ArduinoWidgets context
+  public : static void setTarget (TTDrawTarget * inTarget) { sTarget = inTarget ; }
+  public : static TTDrawTarget * target (void) { return sTarget ; }
+
+  //--- Translation added to the coordinates of the primitives (see TTViewport)
+  public : static void setOffset (const AWPoint & inOffset) { sOffset = inOffset ; }
+  public : static const AWPoint & offset (void) { return sOffset ; }
+
+  public : static void fillRect (const AWRect & inRect,
+                                 const AWRegion & inDrawRegion) ;
+  public : static void frameRect (const AWRect & inRect,
+                                  const AWRegion & inDrawRegion) ;
+  public : static void fillRoundRect (const AWRect & inRect,
+                                      const AWInt inRadius,
+                                      const AWRegion & inDrawRegion) ;
+  public : static void frameRoundRect (const AWRect & inRect,
+                                       const AWInt inRadius,
+                                       const AWRegion & inDrawRegion) ;
+  public : static void fillOval (const AWRect & inRect,
+                                 const AWRegion & inDrawRegion) ;
+  public : static void strokeLine (const AWPoint & inFrom,
+                                   const AWPoint & inTo,
+                                   const AWRegion & inDrawRegion) ;
+  public : static void drawString (const AWFont & inFont,
+                                   const AWInt inX,
+                                   const AWInt inY,
+                                   const String & inString,
+                                   const AWRegion & inDrawRegion) ;
+
+  //--- Per thread on the host, see TTBandRenderer
+  private : static TT_THREAD_LOCAL AWColor sColor ;
+  private : static TT_THREAD_LOCAL TTDrawTarget * sTarget ;
+  private : static TT_THREAD_LOCAL AWPoint sOffset ;
+};
+
+#endif /* TTDraw_h */
@@ -0,0 +1,396 @@
+//
+//  TTFrameBuffer.cpp
+//  CocoaSimulator
+//
+
+#include "TTFrameBuffer.h"
+#include "TTDirtyRegion.h"
+#include <string.h>
+
+//-----------------------------------------------------------------------------
+static AWInt minimum (const AWInt inA, const AWInt inB)
+{
+  return inA < inB ? inA : inB ;
+}
+
+//-----------------------------------------------------------------------------
+static AWInt maximum (const AWInt inA, const AWInt inB)
+{
+  return inA > inB ? inA : inB ;
+}
+
+//-----------------------------------------------------------------------------
+static AWInt squareRoot (const uint32_t inValue)
+{
+  uint32_t result = 0 ;
+  while ((result + 1) * (result + 1) <= inValue) {
+    result++ ;
+  }
+  return (AWInt)result ;
+}
+
+//=============================================================================
+TTFrameBuffer::TTFrameBuffer (TTPixel * inPixels,
+                              const uint16_t inWidth,
+                              const uint16_t inHeight,
+                              TTPixelFunction inPixelFunction,
+                              TTFlushFunction inFlushFunction) :
+mPixels (inPixels),
+mWidth (inWidth),
+mHeight (inHeight),
+mPixelFunction (inPixelFunction),
+mFlushFunction (inFlushFunction),
+mStringFunction (NULL),
+mLastColor (),
+mLastPixel (0),
+mLastColorValid (false),
+mClipLeft (0),
+mClipTop (0),
+mClipRight (0),
+mClipBottom (0),
+mFlushRectCount (0),
+mStringOrigin (0, 0),
+mStringCount (0),
+mFlushCount (0),
+mFlushedPixels (0),
+mDroppedStrings (0)
+{
+}
+
+//-----------------------------------------------------------------------------
+TTFrameBuffer::~TTFrameBuffer (void)
+{
+}
+
+//-----------------------------------------------------------------------------
+TTPixel TTFrameBuffer::pixel (const AWInt inX, const AWInt inY) const
+{
+  if (inX >= 0 && inY >= 0 && inX < mWidth && inY < mHeight) {
+    return mPixels [(uint32_t)inY * mWidth + inX] ;
+  }
+  else {
+    return 0 ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTPixel TTFrameBuffer::pixelOfColor (const AWColor & inColor)
+{
+  //--- The tiles draw long runs of primitives of the same color
+  if (! mLastColorValid || memcmp (& mLastColor, & inColor, sizeof (AWColor)) != 0) {
+    mLastColor = inColor ;
+    mLastPixel = mPixelFunction (inColor) ;
+    mLastColorValid = true ;
+  }
+  return mLastPixel ;
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::beginRect (const AWRect & inRect)
+{
+  mClipLeft = maximum (inRect.origin.x, 0) ;
+  mClipTop = maximum (inRect.origin.y, 0) ;
+  mClipRight = minimum (inRect.origin.x + inRect.size.width, mWidth) ;
+  mClipBottom = minimum (inRect.origin.y + inRect.size.height, mHeight) ;
+  if (mClipLeft < mClipRight && mClipTop < mClipBottom) {
+    const AWRect clip (AWPoint (mClipLeft, mClipTop),
+                       AWSize (mClipRight - mClipLeft, mClipBottom - mClipTop)) ;
+    if (mFlushRectCount < kMaxFlushRects) {
+      mFlushRects [mFlushRectCount] = clip ;
+      mFlushRectCount++ ;
+    }
+    else {
+      //--- TTDisplay does not send more rectangles than that, merge anyway
+      mFlushRects [kMaxFlushRects - 1] = TTDirtyRegion::boundingBox (mFlushRects [kMaxFlushRects - 1], clip) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::endRefresh (void)
+{
+  for (uint8_t i = 0 ; i < mFlushRectCount ; i++) {
+    const AWRect & r = mFlushRects [i] ;
+    if (mFlushFunction != NULL) {
+      mFlushFunction (r, mPixels + (uint32_t)r.origin.y * mWidth + r.origin.x, mWidth) ;
+    }
+    mFlushedPixels += (uint32_t)r.size.width * (uint32_t)r.size.height ;
+  }
+  if (mFlushRectCount > 0) {
+    mFlushCount++ ;
+  }
+  mFlushRectCount = 0 ;
+  if (mStringFunction != NULL) {
+    for (uint8_t i = 0 ; i < mStringCount ; i++) {
+      mStringFunction (* mStringFonts [i],
+                       mStringLocations [i].x,
+                       mStringLocations [i].y,
+                       mStrings [i],
+                       mStringColors [i]) ;
+    }
+  }
+  mStringCount = 0 ;
+  //--- Nothing is drawn outside of a refresh
+  mClipLeft = mClipRight = 0 ;
+  mClipTop = mClipBottom = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::copyRect (const AWRect & inSource, const AWPoint & inDestination)
+{
+  //--- Clip the source, then the destination, to the buffer
+  AWInt sourceX = inSource.origin.x ;
+  AWInt sourceY = inSource.origin.y ;
+  AWInt destinationX = inDestination.x ;
+  AWInt destinationY = inDestination.y ;
+  AWInt width = inSource.size.width ;
+  AWInt height = inSource.size.height ;
+  const AWInt leftCut = maximum (maximum (- sourceX, - destinationX), 0) ;
+  const AWInt topCut = maximum (maximum (- sourceY, - destinationY), 0) ;
+  sourceX += leftCut ; destinationX += leftCut ; width -= leftCut ;
+  sourceY += topCut ; destinationY += topCut ; height -= topCut ;
+  width = minimum (width, minimum (mWidth - sourceX, mWidth - destinationX)) ;
+  height = minimum (height, minimum (mHeight - sourceY, mHeight - destinationY)) ;
+  if (width > 0 && height > 0) {
+    //--- Bottom up when moving down so the source rows are read before
+    //    being overwritten
+    const bool bottomUp = destinationY > sourceY ;
+    for (AWInt i = 0 ; i < height ; i++) {
+      const AWInt row = bottomUp ? height - 1 - i : i ;
+      ttCopyRow (mPixels + (uint32_t)(destinationY + row) * mWidth + destinationX,
+                 mPixels + (uint32_t)(sourceY + row) * mWidth + sourceX,
+                 width) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::fillSpan (const AWInt inLeft,
+                              const AWInt inRight,
+                              const AWInt inY,
+                              const TTPixel inPixel)
+{
+  if (inY >= mClipTop && inY < mClipBottom) {
+    const AWInt left = maximum (inLeft, mClipLeft) ;
+    const AWInt right = minimum (inRight, mClipRight) ;
+    if (left < right) {
+      ttFillRow (mPixels + (uint32_t)inY * mWidth + left, inPixel, right - left) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::plot (const AWInt inX, const AWInt inY, const TTPixel inPixel)
+{
+  if (inX >= mClipLeft && inX < mClipRight && inY >= mClipTop && inY < mClipBottom) {
+    mPixels [(uint32_t)inY * mWidth + inX] = inPixel ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Number of pixels left out at both ends of a row of a rounded rectangle
+AWInt TTFrameBuffer::cornerInset (const AWRect & inRect,
+                                  const AWInt inRadius,
+                                  const AWInt inRow) const
+{
+  AWInt distance = -1 ;
+  if (inRow < inRadius) {
+    distance = inRadius - 1 - inRow ;
+  }
+  else if (inRow >= inRect.size.height - inRadius) {
+    distance = inRow - (inRect.size.height - inRadius) ;
+  }
+  if (distance < 0) {
+    return 0 ;
+  }
+  else {
+    return inRadius - squareRoot ((uint32_t)(inRadius * inRadius - distance * distance)) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::fillRect (const AWRect & inRect,
+                              const AWColor & inColor,
+                              const AWRegion & /* inDrawRegion */)
+{
+  //--- Clipped once for the whole rectangle
+  const AWInt left = maximum (inRect.origin.x, mClipLeft) ;
+  const AWInt top = maximum (inRect.origin.y, mClipTop) ;
+  const AWInt right = minimum (inRect.origin.x + inRect.size.width, mClipRight) ;
+  const AWInt bottom = minimum (inRect.origin.y + inRect.size.height, mClipBottom) ;
+  if (left < right && top < bottom) {
+    ttFillRect (mPixels + (uint32_t)top * mWidth + left, mWidth, right - left, bottom - top, pixelOfColor (inColor)) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::frameRect (const AWRect & inRect,
+                               const AWColor & inColor,
+                               const AWRegion & /* inDrawRegion */)
+{
+  if (inRect.size.width > 0 && inRect.size.height > 0) {
+    const TTPixel pixel = pixelOfColor (inColor) ;
+    const AWInt left = inRect.origin.x ;
+    const AWInt right = left + inRect.size.width ;
+    const AWInt bottom = inRect.origin.y + inRect.size.height - 1 ;
+    fillSpan (left, right, inRect.origin.y, pixel) ;
+    for (AWInt y = inRect.origin.y + 1 ; y < bottom ; y++) {
+      plot (left, y, pixel) ;
+      plot (right - 1, y, pixel) ;
+    }
+    fillSpan (left, right, bottom, pixel) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::fillRoundRect (const AWRect & inRect,
+                                   const AWInt inRadius,
+                                   const AWColor & inColor,
+                                   const AWRegion & /* inDrawRegion */)
+{
+  const TTPixel pixel = pixelOfColor (inColor) ;
+  const AWInt radius = minimum (inRadius, minimum (inRect.size.width, inRect.size.height) / 2) ;
+  const AWInt left = inRect.origin.x ;
+  const AWInt right = left + inRect.size.width ;
+  for (AWInt row = 0 ; row < inRect.size.height ; row++) {
+    const AWInt inset = cornerInset (inRect, radius, row) ;
+    fillSpan (left + inset, right - inset, inRect.origin.y + row, pixel) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::frameRoundRect (const AWRect & inRect,
+                                    const AWInt inRadius,
+                                    const AWColor & inColor,
+                                    const AWRegion & /* inDrawRegion */)
+{
+  const TTPixel pixel = pixelOfColor (inColor) ;
+  const AWInt radius = minimum (inRadius, minimum (inRect.size.width, inRect.size.height) / 2) ;
+  const AWInt left = inRect.origin.x ;
+  const AWInt right = left + inRect.size.width ;
+  const AWInt height = inRect.size.height ;
+  for (AWInt row = 0 ; row < height ; row++) {
+    const AWInt y = inRect.origin.y + row ;
+    const AWInt inset = cornerInset (inRect, radius, row) ;
+    if (row == 0 || row == height - 1) {
+      fillSpan (left + inset, right - inset, y, pixel) ;
+    }
+    else {
+      //--- Join the inset of the row closer to the middle so the arcs have
+      //    no gap
+      const AWInt next = cornerInset (inRect, radius, row < height / 2 ? row + 1 : row - 1) ;
+      const AWInt end = maximum (inset + 1, next) ;
+      fillSpan (left + inset, left + end, y, pixel) ;
+      fillSpan (right - end, right - inset, y, pixel) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::fillOval (const AWRect & inRect,
+                              const AWColor & inColor,
+                              const AWRegion & /* inDrawRegion */)
+{
+  const TTPixel pixel = pixelOfColor (inColor) ;
+  const AWInt w = inRect.size.width ;
+  const AWInt h = inRect.size.height ;
+  if (w > 0 && h > 0) {
+    for (AWInt row = 0 ; row < h ; row++) {
+      //--- Twice the distance from the center of the row to the center
+      const AWInt dy = 2 * row + 1 - h ;
+      const AWInt span = (AWInt)((int32_t)w * squareRoot ((uint32_t)(h * h - dy * dy)) / h) ;
+      const AWInt inset = (w - span) / 2 ;
+      fillSpan (inRect.origin.x + inset, inRect.origin.x + w - inset, inRect.origin.y + row, pixel) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::strokeLine (const AWPoint & inFrom,
+                                const AWPoint & inTo,
+                                const AWColor & inColor,
+                                const AWRegion & /* inDrawRegion */)
+{
+  const TTPixel pixel = pixelOfColor (inColor) ;
+  //--- Bresenham, both ends included
+  AWInt x = inFrom.x ;
+  AWInt y = inFrom.y ;
+  const AWInt dx = inTo.x > inFrom.x ? inTo.x - inFrom.x : inFrom.x - inTo.x ;
+  const AWInt dy = inTo.y > inFrom.y ? inFrom.y - inTo.y : inTo.y - inFrom.y ;
+  const AWInt sx = inFrom.x < inTo.x ? 1 : -1 ;
+  const AWInt sy = inFrom.y < inTo.y ? 1 : -1 ;
+  int32_t error = dx + dy ;
+  while (true) {
+    plot (x, y, pixel) ;
+    if (x == inTo.x && y == inTo.y) break ;
+    const int32_t e2 = 2 * error ;
+    if (e2 >= dy) {
+      error += dy ;
+      x += sx ;
+    }
+    if (e2 <= dx) {
+      error += dx ;
+      y += sy ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::drawString (const AWFont & inFont,
+                                const AWInt inX,
+                                const AWInt inY,
+                                const String & inString,
+                                const AWColor & inColor,
+                                const AWRegion & /* inDrawRegion */)
+{
+  //--- A tile across two dirty rectangles draws its strings twice
+  const AWPoint location (inX + mStringOrigin.x, inY + mStringOrigin.y) ;
+  if (indexOfString (inFont, location, inString, inColor) >= 0) {
+    return ;
+  }
+  if (mStringCount < kMaxDeferredStrings) {
+    mStringFonts [mStringCount] = & inFont ;
+    mStringLocations [mStringCount] = location ;
+    mStrings [mStringCount] = inString ;
+    mStringColors [mStringCount] = inColor ;
+    mStringCount++ ;
+  }
+  else {
+    mDroppedStrings++ ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+int16_t TTFrameBuffer::indexOfString (const AWFont & inFont,
+                                      const AWPoint & inLocation,
+                                      const String & inString,
+                                      const AWColor & inColor) const
+{
+  for (uint8_t i = 0 ; i < mStringCount ; i++) {
+    if (mStringFonts [i] == & inFont &&
+        mStringLocations [i].x == inLocation.x && mStringLocations [i].y == inLocation.y &&
+        mStrings [i] == inString &&
+        memcmp (& mStringColors [i], & inColor, sizeof (AWColor)) == 0) {
+      return i ;
+    }
+  }
+  return -1 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTFrameBuffer::removeStringsOf (const TTFrameBuffer & inOther)
+{
+  uint8_t kept = 0 ;
+  for (uint8_t i = 0 ; i < mStringCount ; i++) {
+    if (inOther.indexOfString (* mStringFonts [i], mStringLocations [i], mStrings [i], mStringColors [i]) < 0) {
+      if (kept != i) {
+        mStringFonts [kept] = mStringFonts [i] ;
+        mStringLocations [kept] = mStringLocations [i] ;
+        mStrings [kept] = mStrings [i] ;
+        mStringColors [kept] = mStringColors [i] ;
+      }
+      kept++ ;
+    }
+  }
+  mStringCount = kept ;
+}
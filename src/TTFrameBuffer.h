@@ -0,0 +1,175 @@
+//
+//  TTFrameBuffer.h
+//  CocoaSimulator
+//
+//  Draw target rendering the tiles into an offscreen buffer in the native
+//  format of the panel. Used as the target of a TTDisplay, the overlapping
+//  primitives of the tiles are resolved in memory and only the dirty
+//  rectangles of a refresh are sent to the panel, in one burst at the end
+//  of the refresh, so the panel never shows a half drawn tile and no bus
+//  bandwidth is spent on overdraw.
+//
+//  Strings can not be rasterized without the glyphs of the panel library:
+//  they are kept and handed to the string function after the flush, so
+//  they are drawn on top of the flushed pixels. Text is therefore not
+//  flicker free: the flush first overwrites it with the pixels of the
+//  buffer, which do not hold it, then the panel library draws it again.
+//  For the same reason copyRect does not move the strings, a viewport
+//  blitting through the buffer only gets back the strings of the tiles it
+//  redraws; leave its blit function NULL when its tiles have titles.
+//
+
+#ifndef TTFrameBuffer_h
+#define TTFrameBuffer_h
+
+#include "TTDraw.h"
+#include "TTPixelKernels.h"
+
+//-----------------------------------------------------------------------------
+// RGB565, the format of the ILI9341 and ST7735 panels, or 32 bits for the
+// host and the RGB888 panels
+#ifdef TT_PIXEL_32
+  typedef uint32_t TTPixel ;
+#else
+  typedef uint16_t TTPixel ;
+#endif
+
+typedef TTPixel (*TTPixelFunction) (const AWColor & inColor) ;
+
+//--- Sends inRect to the panel. inPixels is the top left pixel of the
+//    rectangle, rows are inStride pixels apart. It may start a DMA transfer
+//    but must wait for its end before returning since the buffer is drawn
+//    into at the next refresh
+typedef void (*TTFlushFunction) (const AWRect & inRect,
+                                 const TTPixel * inPixels,
+                                 const uint16_t inStride) ;
+
+typedef void (*TTStringFunction) (const AWFont & inFont,
+                                  const AWInt inX,
+                                  const AWInt inY,
+                                  const String & inString,
+                                  const AWColor & inColor) ;
+
+//-----------------------------------------------------------------------------
+class TTFrameBuffer : public TTDrawTarget {
+  //--- inPixels holds inWidth * inHeight pixels, usually a static array
+  public : TTFrameBuffer (TTPixel * inPixels,
+                          const uint16_t inWidth,
+                          const uint16_t inHeight,
+                          TTPixelFunction inPixelFunction,
+                          TTFlushFunction inFlushFunction) ;
+  public : virtual ~TTFrameBuffer (void) ;
+
+  public : uint16_t width (void) const { return mWidth ; }
+  public : uint16_t height (void) const { return mHeight ; }
+  public : const TTPixel * pixels (void) const { return mPixels ; }
+  public : TTPixel pixel (const AWInt inX, const AWInt inY) const ;
+
+  //--- Moves pixels inside the buffer, inSource and inDestination may
+  //    overlap. Fits the blit function of a TTViewport drawing into the
+  //    buffer. The strings are not moved
+  public : void copyRect (const AWRect & inSource, const AWPoint & inDestination) ;
+
+  //--- NULL drops the strings
+  public : void setStringFunction (TTStringFunction inFunction) { mStringFunction = inFunction ; }
+  //--- Added to the location of the strings handed to the string function,
+  //    for a buffer which is a part of the screen
+  public : void setStringOrigin (const AWPoint & inOrigin) { mStringOrigin = inOrigin ; }
+  //--- Forgets the deferred strings inOther holds too, in the coordinates
+  //    of the screen: a string across two buffers is drawn once
+  public : void removeStringsOf (const TTFrameBuffer & inOther) ;
+
+  //--- Statistics
+  public : uint32_t flushCount (void) const { return mFlushCount ; }
+  public : uint32_t flushedPixels (void) const { return mFlushedPixels ; }
+  public : uint16_t droppedStrings (void) const { return mDroppedStrings ; }
+
+  //--- Called by TTDisplay
+  public : virtual void beginRect (const AWRect & inRect) ;
+  public : virtual void endRefresh (void) ;
+
+  public : virtual void fillRect (const AWRect & inRect,
+                                  const AWColor & inColor,
+                                  const AWRegion & inDrawRegion) ;
+  public : virtual void frameRect (const AWRect & inRect,
+                                   const AWColor & inColor,
+                                   const AWRegion & inDrawRegion) ;
+  public : virtual void fillRoundRect (const AWRect & inRect,
+                                       const AWInt inRadius,
+                                       const AWColor & inColor,
+                                       const AWRegion & inDrawRegion) ;
+  public : virtual void frameRoundRect (const AWRect & inRect,
+                                        const AWInt inRadius,
+                                        const AWColor & inColor,
+                                        const AWRegion & inDrawRegion) ;
+  public : virtual void fillOval (const AWRect & inRect,
+                                  const AWColor & inColor,
+                                  const AWRegion & inDrawRegion) ;
+  public : virtual void strokeLine (const AWPoint & inFrom,
+                                    const AWPoint & inTo,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion) ;
+  public : virtual void drawString (const AWFont & inFont,
+                                    const AWInt inX,
+                                    const AWInt inY,
+                                    const String & inString,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion) ;
+
+  //--- Rasterization, clipped to the current rectangle
+  private : TTPixel pixelOfColor (const AWColor & inColor) ;
+  private : void fillSpan (const AWInt inLeft,
+                           const AWInt inRight,
+                           const AWInt inY,
+                           const TTPixel inPixel) ;
+  private : void plot (const AWInt inX, const AWInt inY, const TTPixel inPixel) ;
+  private : AWInt cornerInset (const AWRect & inRect,
+                               const AWInt inRadius,
+                               const AWInt inRow) const ;
+  private : int16_t indexOfString (const AWFont & inFont,
+                                   const AWPoint & inLocation,
+                                   const String & inString,
+                                   const AWColor & inColor) const ;
+
+  private : TTPixel * mPixels ;
+  private : uint16_t mWidth ;
+  private : uint16_t mHeight ;
+  private : TTPixelFunction mPixelFunction ;
+  private : TTFlushFunction mFlushFunction ;
+  private : TTStringFunction mStringFunction ;
+
+  //--- Last converted color
+  private : AWColor mLastColor ;
+  private : TTPixel mLastPixel ;
+  private : bool mLastColorValid ;
+
+  //--- Rectangle being drawn, empty outside of a refresh
+  private : AWInt mClipLeft ;
+  private : AWInt mClipTop ;
+  private : AWInt mClipRight ;
+  private : AWInt mClipBottom ;
+
+  //--- Rectangles to flush at the end of the refresh
+  public : static const uint8_t kMaxFlushRects = 8 ;
+  private : AWRect mFlushRects [kMaxFlushRects] ;
+  private : uint8_t mFlushRectCount ;
+
+  //--- Strings drawn after the flush, in the coordinates of the screen
+  private : AWPoint mStringOrigin ;
+  public : static const uint8_t kMaxDeferredStrings = 16 ;
+  private : const AWFont * mStringFonts [kMaxDeferredStrings] ;
+  private : AWPoint mStringLocations [kMaxDeferredStrings] ;
+  private : String mStrings [kMaxDeferredStrings] ;
+  private : AWColor mStringColors [kMaxDeferredStrings] ;
+  private : uint8_t mStringCount ;
+
+  private : uint32_t mFlushCount ;
+  private : uint32_t mFlushedPixels ;
+  private : uint16_t mDroppedStrings ;
+
+  //--- No copy
+  private : TTFrameBuffer (const TTFrameBuffer &) ;
+  private : TTFrameBuffer & operator = (const TTFrameBuffer &) ;
+};
+
+#endif /* TTFrameBuffer_h */
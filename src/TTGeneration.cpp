@@ -0,0 +1,151 @@
+//
+//  TTGeneration.cpp
+//  CocoaSimulator
+//
+
+#include "TTGeneration.h"
+
+#ifdef TT_GENERATION
+
+//--- The entries are uint8_t, kNone excluded
+typedef char TTGenerationEntriesFit [(kTTMaxNumberOfPoints + kTTMaxNumberOfDecouplers + kTTMaxNumberOfSignals < 0xFF) ? 1 : -1] ;
+
+//=============================================================================
+uint32_t TTGeneration::sCurrent = 0 ;
+uint32_t TTGeneration::sGeneration [kEntries] ;
+uint8_t TTGeneration::sOlder [kEntries] ;
+uint8_t TTGeneration::sNewer [kEntries] ;
+uint8_t TTGeneration::sOldest = TTGeneration::kNone ;
+uint8_t TTGeneration::sNewest = TTGeneration::kNone ;
+
+//-----------------------------------------------------------------------------
+uint8_t TTGeneration::entryOf (const TTObjectKind inKind, const uint8_t inIdentifier)
+{
+  switch (inKind) {
+    case kTTPointObject :
+      return inIdentifier < kTTMaxNumberOfPoints ? inIdentifier : kNone ;
+    case kTTDecouplerObject :
+      return inIdentifier < kTTMaxNumberOfDecouplers ?
+        (uint8_t)(kTTMaxNumberOfPoints + inIdentifier) : kNone ;
+    case kTTSignalObject :
+      return inIdentifier < kTTMaxNumberOfSignals ?
+        (uint8_t)(kTTMaxNumberOfPoints + kTTMaxNumberOfDecouplers + inIdentifier) : kNone ;
+    default :
+      return kNone ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTGeneration::generationOf (const TTObjectKind inKind, const uint8_t inIdentifier)
+{
+  const uint8_t entry = entryOf (inKind, inIdentifier) ;
+  return (entry != kNone) ? sGeneration [entry] : 0 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGeneration::touch (const TTObjectKind inKind, const uint8_t inIdentifier)
+{
+  const uint8_t entry = entryOf (inKind, inIdentifier) ;
+  if (entry != kNone) {
+    sCurrent++ ;
+    if (entry != sNewest) {
+      //--- An entry with a generation is in the list, and not the newest
+      //    one here, so it has a newer entry
+      if (sGeneration [entry] != 0) {
+        const uint8_t older = sOlder [entry] ;
+        const uint8_t newer = sNewer [entry] ;
+        if (older != kNone) {
+          sNewer [older] = newer ;
+        }
+        else {
+          sOldest = newer ;
+        }
+        sOlder [newer] = older ;
+      }
+      sOlder [entry] = sNewest ;
+      sNewer [entry] = kNone ;
+      if (sNewest != kNone) {
+        sNewer [sNewest] = entry ;
+      }
+      else {
+        sOldest = entry ;
+      }
+      sNewest = entry ;
+    }
+    sGeneration [entry] = sCurrent ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTGeneration::touchAll (void)
+{
+  for (uint8_t identifier = 0 ; identifier < kTTMaxNumberOfPoints ; identifier++) {
+    touch (kTTPointObject, identifier) ;
+  }
+  for (uint8_t identifier = 0 ; identifier < kTTMaxNumberOfDecouplers ; identifier++) {
+    touch (kTTDecouplerObject, identifier) ;
+  }
+  for (uint8_t identifier = 0 ; identifier < kTTMaxNumberOfSignals ; identifier++) {
+    touch (kTTSignalObject, identifier) ;
+  }
+}
+
+//=============================================================================
+TTChangedObjects::TTChangedObjects (const uint32_t inSince) :
+mSince (inSince),
+mEntry (TTGeneration::kNone),
+mStarted (false)
+{
+}
+
+//-----------------------------------------------------------------------------
+bool TTChangedObjects::next (void)
+{
+  if (! mStarted) {
+    mStarted = true ;
+    mEntry = TTGeneration::sNewest ;
+  }
+  else if (mEntry != TTGeneration::kNone) {
+    mEntry = TTGeneration::sOlder [mEntry] ;
+  }
+  if (mEntry != TTGeneration::kNone && TTGeneration::sGeneration [mEntry] <= mSince) {
+    mEntry = TTGeneration::kNone ;
+  }
+  return mEntry != TTGeneration::kNone ;
+}
+
+//-----------------------------------------------------------------------------
+TTObjectKind TTChangedObjects::kind (void) const
+{
+  if (mEntry < kTTMaxNumberOfPoints) {
+    return kTTPointObject ;
+  }
+  else if (mEntry < kTTMaxNumberOfPoints + kTTMaxNumberOfDecouplers) {
+    return kTTDecouplerObject ;
+  }
+  else {
+    return kTTSignalObject ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTChangedObjects::identifier (void) const
+{
+  if (mEntry < kTTMaxNumberOfPoints) {
+    return mEntry ;
+  }
+  else if (mEntry < kTTMaxNumberOfPoints + kTTMaxNumberOfDecouplers) {
+    return (uint8_t)(mEntry - kTTMaxNumberOfPoints) ;
+  }
+  else {
+    return (uint8_t)(mEntry - kTTMaxNumberOfPoints - kTTMaxNumberOfDecouplers) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTChangedObjects::generation (void) const
+{
+  return TTGeneration::sGeneration [mEntry] ;
+}
+
+#endif
@@ -0,0 +1,92 @@
+//
+//  TTGeneration.h
+//  CocoaSimulator
+//
+//  Change detection for the readers mirroring the layout, a web page or a
+//  serial link. Every change of a point, a decoupler or a signal increments
+//  a global generation and stamps the object with it. A reader keeps the
+//  generation of its last pass and visits only the objects changed since,
+//  so a pass costs what changed and not the size of the layout.
+//
+//  The objects are kept in a list ordered by their last change: stamping
+//  moves the object to the newest end, TTChangedObjects walks from there
+//  and stops at the first object not newer than the reader.
+//
+//  Enabled by defining TT_GENERATION in TTConfig.h. The tables take 6 bytes
+//  per point, decoupler and signal, about 1.15 KB with the default maximums,
+//  so it is off by default; without it TTSyncEncoder compares every object
+//  with its shadow.
+//
+
+#ifndef TTGeneration_h
+#define TTGeneration_h
+
+#include "TTTrack.h"
+#include "TTSignal.h"
+
+#ifdef TT_GENERATION
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTPointObject,
+  kTTDecouplerObject,
+  kTTSignalObject,
+  kTTNumberOfObjectKinds
+} TTObjectKind ;
+
+//-----------------------------------------------------------------------------
+class TTGeneration {
+  //--- 0 before the first change
+  public : static uint32_t current (void) { return sCurrent ; }
+  //--- Generation of the last change of the object, 0 if it never changed
+  public : static uint32_t generationOf (const TTObjectKind inKind, const uint8_t inIdentifier) ;
+
+  //--- Called when the object changes: points and decouplers through
+  //    TTChangeNotifier, signals by setState
+  public : static void touch (const TTObjectKind inKind, const uint8_t inIdentifier) ;
+  //--- Every object, after a TTSnapshot is restored
+  public : static void touchAll (void) ;
+
+  //--- One entry per object, the points first, then the decouplers and the
+  //    signals. kNone when the identifier is out of range
+  private : static const uint8_t kNone = 0xFF ;
+  private : static const uint16_t kEntries = kTTMaxNumberOfPoints + kTTMaxNumberOfDecouplers + kTTMaxNumberOfSignals ;
+  private : static uint8_t entryOf (const TTObjectKind inKind, const uint8_t inIdentifier) ;
+  private : static uint32_t sCurrent ;
+  private : static uint32_t sGeneration [kEntries] ;
+  //--- List from the oldest change to the newest one
+  private : static uint8_t sOlder [kEntries] ;
+  private : static uint8_t sNewer [kEntries] ;
+  private : static uint8_t sOldest ;
+  private : static uint8_t sNewest ;
+
+  friend class TTChangedObjects ;
+};
+
+//-----------------------------------------------------------------------------
+// Objects changed after inSince, the most recent first:
+//
+//   for (TTChangedObjects changed (since) ; changed.next () ; ) {
+//     ... changed.kind (), changed.identifier ()
+//   }
+//   since = TTGeneration::current () ;
+//
+// The layout must not change during the walk.
+class TTChangedObjects {
+  public : TTChangedObjects (const uint32_t inSince) ;
+
+  //--- Moves to the next object, false when there is none
+  public : bool next (void) ;
+
+  public : TTObjectKind kind (void) const ;
+  public : uint8_t identifier (void) const ;
+  public : uint32_t generation (void) const ;
+
+  private : uint32_t mSince ;
+  private : uint8_t mEntry ;
+  private : bool mStarted ;
+};
+
+#endif
+
+#endif /* TTGeneration_h */
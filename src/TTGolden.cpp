@@ -0,0 +1,395 @@
+//
+//  TTGolden.cpp
+//  CocoaSimulator
+//
+
+#include "TTGolden.h"
+
+#ifndef ARDUINO
+
+#include "TTSignal.h"
+#include "TTConfig.h"
+#include "AW-settings.h"
+#include "Arduino.h"
+#include <string.h>
+
+//--- Number of drawings timed for the time budget
+static const uint8_t kTTTimingRuns = 4 ;
+//--- Number of calibration runs, the fastest one is kept
+static const uint8_t kTTCalibrationRuns = 16 ;
+//--- Resolution of micros () and rounding of the scaled budget
+static const uint32_t kTTTimerSlack = 2 ;
+
+//--- Keeps the calibration runs
+static volatile uint32_t gCalibrationSink ;
+
+//--- FNV-1a
+static const uint32_t kFNVOffset = 2166136261UL ;
+static const uint32_t kFNVPrime = 16777619UL ;
+
+//-----------------------------------------------------------------------------
+static uint32_t fnv (uint32_t inHash, const void * inData, const size_t inLength)
+{
+  const uint8_t * p = (const uint8_t *) inData ;
+  for (size_t i = 0 ; i < inLength ; i++) {
+    inHash = (inHash ^ p [i]) * kFNVPrime ;
+  }
+  return inHash ;
+}
+
+//-----------------------------------------------------------------------------
+static TTPixel goldenPixel (const AWColor & inColor)
+{
+  return TTGoldenCanvas::paletteIndex (inColor) ;
+}
+
+//=============================================================================
+TTGoldenCanvas::TTGoldenCanvas (void) :
+TTFrameBuffer (new TTPixel [(uint32_t)kWidth * kHeight], kWidth, kHeight, goldenPixel, NULL),
+mStrings (kFNVOffset),
+mPrimitives (0)
+{
+}
+
+//-----------------------------------------------------------------------------
+TTGoldenCanvas::~TTGoldenCanvas (void)
+{
+  delete [] pixels () ;
+}
+
+//-----------------------------------------------------------------------------
+TTPixel TTGoldenCanvas::paletteIndex (const AWColor & inColor)
+{
+  //--- The colors of the configuration first so a tile drawn with a
+  //    configuration color keeps its index when the color is changed to
+  //    another one of the palette
+  const AWColor palette [] = {
+    inactiveTrackColor, activeTrackColor, wishedPosColor, wishFailedColor,
+    alarmColor, decoupleColor, feedbackColor, TTBackColor,
+    buttonFrameColor, buttonBackColor, trackGridColor, awkTextColor,
+    AWColor::black (), AWColor::white (), AWColor::gray (), AWColor::lightGray (),
+    AWColor::darkGray (), AWColor::veryLightGray (), AWColor::red (), AWColor::green (),
+    AWColor::blue (), AWColor::yellow ()
+  } ;
+  const uint8_t count = sizeof (palette) / sizeof (palette [0]) ;
+  TTPixel result = kUnknownColor ;
+  for (uint8_t i = 0 ; i < count && result == kUnknownColor ; i++) {
+    if (memcmp (& palette [i], & inColor, sizeof (AWColor)) == 0) {
+      result = (TTPixel)(i + 1) ;
+    }
+  }
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::begin (const AWRect & inFrame)
+{
+  TTPixel * p = const_cast <TTPixel *> (pixels ()) ;
+  for (uint32_t i = 0 ; i < (uint32_t)kWidth * kHeight ; i++) {
+    p [i] = kEmpty ;
+  }
+  TTDraw::setOffset (AWPoint (TTDefaultMetrics::kGrid - inFrame.origin.x, TTDefaultMetrics::kGrid - inFrame.origin.y)) ;
+  beginRect (AWRect (AWPoint (0, 0), AWSize (kWidth, kHeight))) ;
+  mStrings = kFNVOffset ;
+  mPrimitives = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTGoldenCanvas::signature (void) const
+{
+  //--- One byte per pixel whatever the size of TTPixel
+  const TTPixel * p = pixels () ;
+  uint32_t result = kFNVOffset ;
+  for (uint32_t i = 0 ; i < (uint32_t)kWidth * kHeight ; i++) {
+    result = (result ^ (uint8_t)p [i]) * kFNVPrime ;
+  }
+  return fnv (result, & mStrings, sizeof (mStrings)) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::fillRect (const AWRect & inRect,
+                               const AWColor & inColor,
+                               const AWRegion & inDrawRegion)
+{
+  mPrimitives++ ;
+  TTFrameBuffer::fillRect (inRect, inColor, inDrawRegion) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::frameRect (const AWRect & inRect,
+                                const AWColor & inColor,
+                                const AWRegion & inDrawRegion)
+{
+  mPrimitives++ ;
+  TTFrameBuffer::frameRect (inRect, inColor, inDrawRegion) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::fillRoundRect (const AWRect & inRect,
+                                    const AWInt inRadius,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion)
+{
+  mPrimitives++ ;
+  TTFrameBuffer::fillRoundRect (inRect, inRadius, inColor, inDrawRegion) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::frameRoundRect (const AWRect & inRect,
+                                     const AWInt inRadius,
+                                     const AWColor & inColor,
+                                     const AWRegion & inDrawRegion)
+{
+  mPrimitives++ ;
+  TTFrameBuffer::frameRoundRect (inRect, inRadius, inColor, inDrawRegion) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::fillOval (const AWRect & inRect,
+                               const AWColor & inColor,
+                               const AWRegion & inDrawRegion)
+{
+  mPrimitives++ ;
+  TTFrameBuffer::fillOval (inRect, inColor, inDrawRegion) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::strokeLine (const AWPoint & inFrom,
+                                 const AWPoint & inTo,
+                                 const AWColor & inColor,
+                                 const AWRegion & inDrawRegion)
+{
+  mPrimitives++ ;
+  TTFrameBuffer::strokeLine (inFrom, inTo, inColor, inDrawRegion) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenCanvas::drawString (const AWFont & /* inFont */,
+                                 const AWInt inX,
+                                 const AWInt inY,
+                                 const String & inString,
+                                 const AWColor & inColor,
+                                 const AWRegion & /* inDrawRegion */)
+{
+  //--- inX and inY come from the metrics of the font, see TTGolden.h
+  mPrimitives++ ;
+  const uint32_t color = paletteIndex (inColor) ;
+  mStrings = fnv (mStrings, & color, sizeof (color)) ;
+  mStrings = fnv (mStrings, inString.c_str (), inString.length ()) ;
+}
+
+//=============================================================================
+TTGoldenCanvas * TTGoldenHarness::sCanvas = NULL ;
+TTGoldenCallback TTGoldenHarness::sCallback = NULL ;
+uint16_t TTGoldenHarness::sFailures = 0 ;
+uint32_t TTGoldenHarness::sCalibration = 0 ;
+uint16_t TTGoldenHarness::sVariant [kTTNumberOfTileKinds] ;
+
+//-----------------------------------------------------------------------------
+uint16_t TTGoldenHarness::run (TTGoldenCallback inCallback)
+{
+  sCanvas = new TTGoldenCanvas () ;
+  sCallback = inCallback ;
+  sFailures = 0 ;
+  for (uint8_t k = 0 ; k < kTTNumberOfTileKinds ; k++) {
+    sVariant [k] = 0 ;
+  }
+  calibrate () ;
+  checkPoints () ;
+  checkDoublePoints () ;
+  checkOthers () ;
+  delete sCanvas ;
+  sCanvas = NULL ;
+  return sFailures ;
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenHarness::calibrate (void)
+{
+  sCanvas->begin (AWRect (AWPoint (0, 0), AWSize (0, 0))) ;
+  sCalibration = 0xFFFFFFFFUL ;
+  for (uint8_t i = 0 ; i < kTTCalibrationRuns ; i++) {
+    const uint32_t start = micros () ;
+    gCalibrationSink = sCanvas->signature () ;
+    const uint32_t duration = micros () - start ;
+    if (duration < sCalibration) {
+      sCalibration = duration ;
+    }
+  }
+  if (sCalibration == 0) {
+    sCalibration = 1 ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenHarness::check (const TTTileKind inKind, const AWView * inView)
+{
+  TTGoldenSample sample ;
+  sample.kind = inKind ;
+  sample.variant = sVariant [inKind]++ ;
+  const AWRect frame = inView->absoluteFrame () ;
+  const AWRegion region (frame) ;
+  TTDrawTarget * previousTarget = TTDraw::target () ;
+  const AWPoint previousOffset = TTDraw::offset () ;
+  TTDraw::setTarget (sCanvas) ;
+  //--- Time of the drawing and of its rasterization, the same work on every
+  //    host. The fastest run is kept, the others may include an interrupt
+  //    or a context switch
+  sCanvas->begin (frame) ;
+  sample.micros = 0xFFFFFFFFUL ;
+  for (uint8_t i = 0 ; i < kTTTimingRuns ; i++) {
+    const uint32_t start = micros () ;
+    inView->drawInRegion (region) ;
+    const uint32_t duration = micros () - start ;
+    if (duration < sample.micros) {
+      sample.micros = duration ;
+    }
+  }
+  //--- Capture
+  sCanvas->begin (frame) ;
+  inView->drawInRegion (region) ;
+  sample.signature = sCanvas->signature () ;
+  sample.primitives = sCanvas->primitives () ;
+  sCanvas->endRefresh () ;
+  TTDraw::setOffset (previousOffset) ;
+  TTDraw::setTarget (previousTarget) ;
+  //--- Compare
+  uint8_t status = kTTGoldenMatch ;
+  const TTGoldenSet & golden = kTTGoldenSets [inKind] ;
+  if (sample.variant >= golden.count) {
+    status |= kTTGoldenMissing ;
+  }
+  else if (golden.signatures [sample.variant] != sample.signature) {
+    status |= kTTGoldenMismatch ;
+  }
+  if (sample.primitives > kTTRenderBudgets [inKind].primitives) {
+    status |= kTTPrimitiveBudgetExceeded ;
+  }
+  if (sample.micros > kTTRenderBudgets [inKind].time * sCalibration / 1000 + kTTTimerSlack) {
+    status |= kTTTimeBudgetExceeded ;
+  }
+  if (status != kTTGoldenMatch) {
+    sFailures++ ;
+  }
+  if (sCallback != NULL) {
+    sCallback (sample, status) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+static const TTPointPosition kActualPositions [] = {
+  kStraightPosition, kMiddlePosition, kDiagonalPosition, kNoPosition
+} ;
+static const TTPointPosition kWishedPositions [] = {
+  kStraightPosition, kDiagonalPosition
+} ;
+
+//-----------------------------------------------------------------------------
+void TTGoldenHarness::checkPoints (void)
+{
+  for (uint8_t shape = 0 ; shape < 16 ; shape++) {
+    //--- Not registered identifier so the layout of the sketch is left alone
+    TTPoint point (AWPoint (1, 1), kTTMaxNumberOfPoints,
+                   shape & 1, (shape >> 1) & 1, (shape >> 2) & 1, (shape >> 3) & 1) ;
+    for (uint8_t actual = 0 ; actual < 4 ; actual++) {
+      for (uint8_t wished = 0 ; wished < 2 ; wished++) {
+        for (uint8_t pending = 0 ; pending < 2 ; pending++) {
+          for (uint8_t feedback = 0 ; feedback < 2 ; feedback++) {
+            point.mActualPosition = kActualPositions [actual] ;
+            point.mWishedPosition = kWishedPositions [wished] ;
+            point.mPendingWishedPosition = pending ;
+            point.setFeedback (feedback) ;
+            check (kTTPointKind, & point) ;
+          }
+        }
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenHarness::checkDoublePoints (void)
+{
+  static const TTDoublePointSize kSizes [] = { kNormal, kLarge, kLargeNoSync } ;
+  for (uint8_t way = 0 ; way < 2 ; way++) {
+    for (uint8_t size = 0 ; size < 3 ; size++) {
+      TTDoublePoint point (AWPoint (1, 1), kTTMaxNumberOfPoints, kTTMaxNumberOfPoints, way, kSizes [size]) ;
+      //--- No feedback, then touch in the middle or in each quarter
+      const uint8_t feedbackCount = kSizes [size] == kLargeNoSync ? 5 : 2 ;
+      AWRect button = point.absoluteFrame () ;
+      button.inset (3, 3) ;
+      for (uint16_t positions = 0 ; positions < 256 ; positions++) {
+        for (uint8_t feedback = 0 ; feedback < feedbackCount ; feedback++) {
+          point.mActualTopPosition = kActualPositions [positions & 3] ;
+          point.mWishedTopPosition = kWishedPositions [(positions >> 2) & 1] ;
+          point.mPendingWishedTopPosition = (positions >> 3) & 1 ;
+          point.mActualBottomPosition = kActualPositions [(positions >> 4) & 3] ;
+          point.mWishedBottomPosition = kWishedPositions [(positions >> 6) & 1] ;
+          point.mPendingWishedBottomPosition = (positions >> 7) & 1 ;
+          point.setFeedback (false) ;
+          point.mTouchInProgress = false ;
+          if (feedback == 1 && feedbackCount == 2) {
+            point.touchDown (AWPoint (button.origin.x + button.size.width / 2,
+                                      button.origin.y + button.size.height / 2)) ;
+          }
+          else if (feedback > 0) {
+            const uint8_t quarter = feedback - 1 ;
+            point.touchDown (AWPoint (button.origin.x + ((quarter & 1) ? 3 : 1) * button.size.width / 4,
+                                      button.origin.y + ((quarter & 2) ? 3 : 1) * button.size.height / 4)) ;
+          }
+          check (kTTDoublePointKind, & point) ;
+        }
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTGoldenHarness::checkOthers (void)
+{
+  static const BlockInOutShape kShapes [] = { kMiddle, kTopDiagonal, kBottomDiagonal } ;
+  for (uint8_t shapes = 0 ; shapes < 9 ; shapes++) {
+    for (uint8_t reverted = 0 ; reverted < 2 ; reverted++) {
+      TTBlock block (AWPoint (1, 1), 3, kShapes [shapes % 3], kShapes [shapes / 3], reverted) ;
+      for (uint8_t dashed = 0 ; dashed < 2 ; dashed++) {
+        block.setDashed (dashed) ;
+        check (kTTBlockKind, & block) ;
+      }
+    }
+  }
+  static const int kSlipKinds [] = { kSlipLeft, kSlipRight, kSlipLeft | kSlipRight } ;
+  for (uint8_t variant = 0 ; variant < 12 ; variant++) {
+    TTSlip slip (AWPoint (1, 1), kSlipKinds [variant % 3], (variant / 3) & 1, variant / 6) ;
+    check (kTTSlipKind, & slip) ;
+  }
+  for (uint8_t variant = 0 ; variant < 12 ; variant++) {
+    TTDiag diag (AWPoint (1, 1), 1 + variant % 3, (variant / 3) & 1, variant / 6) ;
+    check (kTTDiagKind, & diag) ;
+  }
+  for (uint8_t reverted = 0 ; reverted < 2 ; reverted++) {
+    TTArrow arrow (AWPoint (1, 1), reverted) ;
+    check (kTTArrowKind, & arrow) ;
+    TTBuffer buffer (AWPoint (1, 1), reverted) ;
+    check (kTTBufferKind, & buffer) ;
+  }
+  TTDecoupler decoupler (AWPoint (1, 1), kTTMaxNumberOfDecouplers) ;
+  for (uint8_t variant = 0 ; variant < 4 ; variant++) {
+    decoupler.mPosition = variant & 1 ;
+    decoupler.setFeedback (variant >> 1) ;
+    check (kTTDecouplerKind, & decoupler) ;
+  }
+  static const TTSemaphoreState kStates [] = { kTTSemaphore, kTTRalentissement, kTTVoieLibre } ;
+  for (uint8_t direction = 0 ; direction < 2 ; direction++) {
+    TTSemaphoreF signal (AWPoint (1, 1), direction) ;
+    for (uint8_t state = 0 ; state < 3 ; state++) {
+      signal.setState (kStates [state]) ;
+      check (kTTSignalKind, & signal) ;
+    }
+  }
+  const TTView untitledView (AWPoint (TTDefaultMetrics::kGrid, TTDefaultMetrics::kGrid), 4, 2) ;
+  check (kTTViewKind, & untitledView) ;
+  const TTView titledView (AWPoint (TTDefaultMetrics::kGrid, TTDefaultMetrics::kGrid), 4, 2, "TCO") ;
+  check (kTTViewKind, & titledView) ;
+}
+
+#endif
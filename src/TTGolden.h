@@ -0,0 +1,162 @@
+//
+//  TTGolden.h
+//  CocoaSimulator
+//
+//  Regression harness for the drawing code. Every widget is drawn in every
+//  state into a TTGoldenCanvas and the resulting signature is compared
+//  with the golden signatures of TTGoldenData.cpp. The number of primitives
+//  and the drawing time of every sample are checked against the budgets of
+//  the class in the same file, whatever the outcome of the comparison.
+//  Host only: the canvas does not fit the boards and the sketches do not
+//  carry the tables.
+//
+//  The canvas is a TTFrameBuffer: every primitive is rasterized by the same
+//  code as the offscreen displays, so the signature is the one of the
+//  pixels and does not change when the primitives of a tile are split,
+//  merged or reordered as long as the pixels are the same. Strings can not
+//  be rasterized without the glyphs, their text and color are hashed
+//  instead. Not their location: the tiles place them with the metrics of
+//  the fonts of the ArduinoWidgets of the build, the signatures would
+//  depend on it.
+//
+#ifndef TTGolden_h
+#define TTGolden_h
+
+#ifndef ARDUINO
+
+#include "TTTrack.h"
+#include "TTFrameBuffer.h"
+
+//-----------------------------------------------------------------------------
+// Golden signatures of a class, indexed by variant
+typedef struct {
+  const uint32_t * signatures ;
+  uint16_t count ;
+} TTGoldenSet ;
+
+//-----------------------------------------------------------------------------
+// Maximum for one drawInRegion of a class. The time is in thousandths of
+// the calibration run (see TTGoldenHarness::calibration) so the budget
+// follows the speed of the host and of the build
+typedef struct {
+  uint16_t primitives ;
+  uint16_t time ;
+} TTRenderBudget ;
+
+extern const TTGoldenSet kTTGoldenSets [kTTNumberOfTileKinds] ;
+extern const TTRenderBudget kTTRenderBudgets [kTTNumberOfTileKinds] ;
+
+//-----------------------------------------------------------------------------
+// Outcome of a sample, kTTGoldenMatch or a combination of the other flags
+typedef enum {
+  kTTGoldenMatch = 0,
+  kTTGoldenMismatch = 1,
+  kTTGoldenMissing = 2,
+  kTTPrimitiveBudgetExceeded = 4,
+  kTTTimeBudgetExceeded = 8
+} TTGoldenStatus ;
+
+//-----------------------------------------------------------------------------
+typedef struct {
+  TTTileKind kind ;
+  uint16_t variant ;
+  uint32_t signature ;
+  uint16_t primitives ;
+  uint32_t micros ;
+} TTGoldenSample ;
+
+typedef void (*TTGoldenCallback) (const TTGoldenSample & inSample, const uint8_t inStatus) ;
+
+//-----------------------------------------------------------------------------
+// Frame buffer whose pixels are indexes in a palette of the colors of the
+// configuration and of ArduinoWidgets, so the signatures do not depend on
+// the pixel format nor on the layout of AWColor
+class TTGoldenCanvas : public TTFrameBuffer {
+  public : TTGoldenCanvas (void) ;
+  public : virtual ~TTGoldenCanvas (void) ;
+
+  //--- Large enough for the biggest sample with its margin
+  public : static const uint16_t kWidth = 8 * TTDefaultMetrics::kGrid ;
+  public : static const uint16_t kHeight = 5 * TTDefaultMetrics::kGrid ;
+
+  //--- Clears the pixels and maps the top left corner of inFrame, minus a
+  //    margin for the tiles drawing slightly outside of their frame, to the
+  //    top left corner of the canvas
+  public : void begin (const AWRect & inFrame) ;
+  public : uint32_t signature (void) const ;
+  public : uint16_t primitives (void) const { return mPrimitives ; }
+
+  //--- Pixels are palette indexes, kEmpty where nothing has been drawn and
+  //    kUnknownColor for the colors out of the palette
+  public : static const TTPixel kEmpty = 0 ;
+  public : static const TTPixel kUnknownColor = 255 ;
+  public : static TTPixel paletteIndex (const AWColor & inColor) ;
+
+  public : virtual void fillRect (const AWRect & inRect,
+                                  const AWColor & inColor,
+                                  const AWRegion & inDrawRegion) ;
+  public : virtual void frameRect (const AWRect & inRect,
+                                   const AWColor & inColor,
+                                   const AWRegion & inDrawRegion) ;
+  public : virtual void fillRoundRect (const AWRect & inRect,
+                                       const AWInt inRadius,
+                                       const AWColor & inColor,
+                                       const AWRegion & inDrawRegion) ;
+  public : virtual void frameRoundRect (const AWRect & inRect,
+                                        const AWInt inRadius,
+                                        const AWColor & inColor,
+                                        const AWRegion & inDrawRegion) ;
+  public : virtual void fillOval (const AWRect & inRect,
+                                  const AWColor & inColor,
+                                  const AWRegion & inDrawRegion) ;
+  public : virtual void strokeLine (const AWPoint & inFrom,
+                                    const AWPoint & inTo,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion) ;
+  public : virtual void drawString (const AWFont & inFont,
+                                    const AWInt inX,
+                                    const AWInt inY,
+                                    const String & inString,
+                                    const AWColor & inColor,
+                                    const AWRegion & inDrawRegion) ;
+
+  private : uint32_t mStrings ;
+  private : uint16_t mPrimitives ;
+
+  //--- No copy
+  private : TTGoldenCanvas (const TTGoldenCanvas &) ;
+  private : TTGoldenCanvas & operator = (const TTGoldenCanvas &) ;
+};
+
+//-----------------------------------------------------------------------------
+class TTGoldenHarness {
+  //--- Draws every variant, calls inCallback (if not NULL) for each one and
+  //    returns the number of failing samples. To regenerate
+  //    TTGoldenData.cpp, print the signatures of every kind in variant order.
+  public : static uint16_t run (TTGoldenCallback inCallback) ;
+
+  //--- Canvas of the last sample, valid during the callback
+  public : static const TTGoldenCanvas & canvas (void) { return * sCanvas ; }
+
+  //--- Time of the calibration run in microseconds, valid during the
+  //    callback: the signature of the canvas, a fixed amount of work which
+  //    does not depend on the drawing code under test
+  public : static uint32_t calibration (void) { return sCalibration ; }
+  private : static void calibrate (void) ;
+
+  private : static void checkPoints (void) ;
+  private : static void checkDoublePoints (void) ;
+  private : static void checkOthers (void) ;
+  private : static void check (const TTTileKind inKind, const AWView * inView) ;
+
+  //--- Allocated by run () only, the pixels do not fit the small boards
+  private : static TTGoldenCanvas * sCanvas ;
+  private : static TTGoldenCallback sCallback ;
+  private : static uint16_t sFailures ;
+  private : static uint32_t sCalibration ;
+  private : static uint16_t sVariant [kTTNumberOfTileKinds] ;
+};
+
+#endif
+
+#endif /* TTGolden_h */
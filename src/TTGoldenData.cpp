@@ -0,0 +1,962 @@
+//
+//  TTGoldenData.cpp
+//  CocoaSimulator
+//
+//  Golden signatures and rendering budgets used by TTGoldenHarness.
+//  The signatures depend on the configuration colors, not on the fonts of
+//  the build (see TTGolden.h). They are regenerated on the host build by
+//  printing the signatures of TTGoldenHarness::run () for each kind, in
+//  variant order, and pasting the result below.
+//
+
+#include "TTGolden.h"
+
+#ifndef ARDUINO
+
+//-----------------------------------------------------------------------------
+static const uint32_t kViewSignatures [] = {
+  0xAF76D4F5, 0xF57E9E4A
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kBlockSignatures [] = {
+  0xB22F40FA, 0xE885821A, 0xB22F40FA, 0xE885821A, 0x9E8729D8, 0x4F1E7BB8,
+  0xD8440CF8, 0x1B070018, 0x90FC3FF8, 0x57B4AD58, 0xE2881118, 0xF5DBA0B8,
+  0xE2881118, 0xF5DBA0B8, 0x90FC3FF8, 0x57B4AD58, 0x83A269CA, 0xCE0DCFAA,
+  0xA55D212A, 0xF2F5B38A, 0x9025599A, 0xDDBC58FA, 0x9025599A, 0xDDBC58FA,
+  0xD8440CF8, 0x1B070018, 0x9E8729D8, 0x4F1E7BB8, 0x034A0D1A, 0xA95F2E7A,
+  0x034A0D1A, 0xA95F2E7A, 0xA55D212A, 0xF2F5B38A, 0x83A269CA, 0xCE0DCFAA
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kPointSignatures [] = {
+  0xA65A0BCB, 0x876C9A3E, 0xA65A0BCB, 0x876C9A3E, 0xA65A0BCB, 0x876C9A3E,
+  0x438DA721, 0x63ED0250, 0xD709680A, 0xE32752C7, 0x536052EC, 0x5DE94B21,
+  0xD709680A, 0xE32752C7, 0xBD507CC6, 0xE01DA49F, 0x061BCCB0, 0xC8D8CADD,
+  0x569321F8, 0x7EE9BAD5, 0x061BCCB0, 0xC8D8CADD, 0x061BCCB0, 0xC8D8CADD,
+  0xF527BBF9, 0x9E300789, 0xF527BBF9, 0x9E300789, 0xF527BBF9, 0x9E300789,
+  0xF527BBF9, 0x9E300789, 0x60276953, 0xB7DE5A8E, 0x60276953, 0xB7DE5A8E,
+  0x60276953, 0xB7DE5A8E, 0xE76A0C39, 0x3CF47E90, 0xE065E846, 0xC7B4E043,
+  0x0DF5C098, 0x80169611, 0xE065E846, 0xC7B4E043, 0xFDC2E5F6, 0x67233CDB,
+  0x5D1370B4, 0x5160E769, 0xA726341C, 0x7F651349, 0x5D1370B4, 0x5160E769,
+  0x5D1370B4, 0x5160E769, 0xF6881B51, 0xBEE51B49, 0xF6881B51, 0xBEE51B49,
+  0xF6881B51, 0xBEE51B49, 0xF6881B51, 0xBEE51B49, 0x6DB72396, 0xA57E3C46,
+  0x6DB72396, 0xA57E3C46, 0x6DB72396, 0xA57E3C46, 0xAEE2A5BE, 0xC2E67402,
+  0x2DF8DC0B, 0xA42B36DB, 0xF5FC64A5, 0xD6195955, 0x2DF8DC0B, 0xA42B36DB,
+  0x6368C041, 0x01975B8D, 0x074D1BBE, 0x6FA5FB1E, 0x72AE741A, 0x09396F6A,
+  0x074D1BBE, 0x6FA5FB1E, 0x074D1BBE, 0x6FA5FB1E, 0xC329CB27, 0xB8CC3E5B,
+  0xC329CB27, 0xB8CC3E5B, 0xC329CB27, 0xB8CC3E5B, 0xC329CB27, 0xB8CC3E5B,
+  0xC072E7F2, 0x21F94446, 0xC072E7F2, 0x21F94446, 0xC072E7F2, 0x21F94446,
+  0xFD859C5A, 0xE0884D86, 0x3D22185B, 0x3E55EC9F, 0x21825AC1, 0x641FA7C1,
+  0x3D22185B, 0x3E55EC9F, 0x8AD50D3D, 0x0F374C35, 0xE5AB7C66, 0x4A69749A,
+  0x79AF7F0A, 0x03E4ABF6, 0xE5AB7C66, 0x4A69749A, 0xE5AB7C66, 0x4A69749A,
+  0x5D201DBF, 0x964C0B83, 0x5D201DBF, 0x964C0B83, 0x5D201DBF, 0x964C0B83,
+  0x5D201DBF, 0x964C0B83, 0xBFF2312D, 0x019086DF, 0xBFF2312D, 0x019086DF,
+  0xBFF2312D, 0x019086DF, 0xCA7E56FD, 0xC1CA5A5F, 0xAB65CCC8, 0x16D0E8F6,
+  0xBFAF8D3E, 0xA24E37EC, 0xAB65CCC8, 0x16D0E8F6, 0x43AEA0B6, 0xE2A93A74,
+  0xD43C05B9, 0xD5A97B23, 0xF5319EA1, 0x15C5C08B, 0xD43C05B9, 0xD5A97B23,
+  0xD43C05B9, 0xD5A97B23, 0x760DE790, 0xC2D4CE48, 0x760DE790, 0xC2D4CE48,
+  0x760DE790, 0xC2D4CE48, 0x760DE790, 0xC2D4CE48, 0xB2622991, 0x4CB44F9B,
+  0xB2622991, 0x4CB44F9B, 0xB2622991, 0x4CB44F9B, 0x8FC40DA1, 0x0B116FA7,
+  0x8083FE18, 0x263A91FE, 0x205ABBC6, 0xE29695C0, 0x8083FE18, 0x263A91FE,
+  0xB809027E, 0x5FEECD94, 0x7AD90E45, 0xDF3E7937, 0xBEFE55A5, 0xDA4A9ED7,
+  0x7AD90E45, 0xDF3E7937, 0x7AD90E45, 0xDF3E7937, 0x76C443AC, 0xD385ECA8,
+  0x76C443AC, 0xD385ECA8, 0x76C443AC, 0xD385ECA8, 0x76C443AC, 0xD385ECA8,
+  0x722EA3C4, 0x9DD24FF7, 0x722EA3C4, 0x9DD24FF7, 0x722EA3C4, 0x9DD24FF7,
+  0x8C5CDD8E, 0xC4BC30A9, 0x4792946D, 0x0F877112, 0x19ADED53, 0x9EB10F98,
+  0x4792946D, 0x0F877112, 0xEA5C961D, 0x5F46AF2A, 0x114F503F, 0x94973B64,
+  0x26C7291B, 0x8F7DA8D8, 0x114F503F, 0x94973B64, 0x114F503F, 0x94973B64,
+  0x71C9A03E, 0xAC6DF0FA, 0x71C9A03E, 0xAC6DF0FA, 0x71C9A03E, 0xAC6DF0FA,
+  0x71C9A03E, 0xAC6DF0FA, 0x616C0694, 0xDF477647, 0x616C0694, 0xDF477647,
+  0x616C0694, 0xDF477647, 0x7AE991D2, 0xC93113E9, 0xB1315751, 0x68F91A36,
+  0xE6E577AB, 0x7B4B98D4, 0xB1315751, 0x68F91A36, 0x58C86BB5, 0x90EA3CF2,
+  0x0C4AAEE3, 0x0F258D08, 0x177B7D9F, 0x26B7CB9C, 0x0C4AAEE3, 0x0F258D08,
+  0x0C4AAEE3, 0x0F258D08, 0x4891AA5E, 0x10448516, 0x4891AA5E, 0x10448516,
+  0x4891AA5E, 0x10448516, 0x4891AA5E, 0x10448516, 0x0397E235, 0xF5D93CF2,
+  0x0397E235, 0xF5D93CF2, 0x0397E235, 0xF5D93CF2, 0xABB2391D, 0x7B1F6122,
+  0xF577C612, 0x8575346D, 0xD57B00FC, 0x32CBD6F3, 0xF577C612, 0x8575346D,
+  0x3716F83C, 0x9A314273, 0x9E6376EB, 0x46527E68, 0x67A45C8B, 0xC08E9440,
+  0x9E6376EB, 0x46527E68, 0x9E6376EB, 0x46527E68, 0xAABFEA74, 0x96429499,
+  0xAABFEA74, 0x96429499, 0xAABFEA74, 0x96429499, 0xAABFEA74, 0x96429499,
+  0x1F108265, 0x55B2D642, 0x1F108265, 0x55B2D642, 0x1F108265, 0x55B2D642,
+  0x8EC5E9FD, 0x581A7462, 0x4A0A31BE, 0x41D00C11, 0xEAED9078, 0x5CCB9CA3,
+  0x4A0A31BE, 0x41D00C11, 0xC20205EC, 0x7C77C7AF, 0x4E03954B, 0x2A1EAD00,
+  0xAA982BF3, 0x90194238, 0x4E03954B, 0x2A1EAD00, 0x4E03954B, 0x2A1EAD00,
+  0xDBC9ECF0, 0xE13FBCD1, 0xDBC9ECF0, 0xE13FBCD1, 0xDBC9ECF0, 0xE13FBCD1,
+  0xDBC9ECF0, 0xE13FBCD1, 0x366167BE, 0x1B6C9649, 0x366167BE, 0x1B6C9649,
+  0x366167BE, 0x1B6C9649, 0xEA93FFE0, 0x2E732797, 0x340E0635, 0x66BC3012,
+  0x9E82B9F3, 0x50A56884, 0x340E0635, 0x66BC3012, 0x316BF3E1, 0x31F49736,
+  0x37064099, 0xC9070496, 0x8AD56495, 0xBEE1296A, 0x37064099, 0xC9070496,
+  0x37064099, 0xC9070496, 0xA11198AE, 0x36E308B4, 0xA11198AE, 0x36E308B4,
+  0xA11198AE, 0x36E308B4, 0xA11198AE, 0x36E308B4, 0x916DF1D7, 0x63594668,
+  0x916DF1D7, 0x63594668, 0x916DF1D7, 0x63594668, 0xDFEBF60F, 0x1EA49758,
+  0xB61AAD98, 0x75FCE377, 0x0E3732F2, 0xC671B261, 0xB61AAD98, 0x75FCE377,
+  0xE2249A4A, 0xF6C79A71, 0x8E7C3E81, 0x4E8DFDEA, 0xAF2F90AD, 0x77E9BC36,
+  0x8E7C3E81, 0x4E8DFDEA, 0x8E7C3E81, 0x4E8DFDEA, 0xAFB6F7FA, 0xC6455807,
+  0xAFB6F7FA, 0xC6455807, 0xAFB6F7FA, 0xC6455807, 0xAFB6F7FA, 0xC6455807,
+  0x25FEDCB4, 0x30C2676A, 0x25FEDCB4, 0x30C2676A, 0x25FEDCB4, 0x30C2676A,
+  0xCA8471D2, 0x674B241C, 0x1134EE3B, 0xAA557825, 0x1CFDFA75, 0x8FFBC7CB,
+  0x1134EE3B, 0xAA557825, 0xA80376B3, 0x53FCB30D, 0x3A05D379, 0x0129079B,
+  0x61015159, 0xF37A3EBB, 0x3A05D379, 0x0129079B, 0x3A05D379, 0x0129079B,
+  0x60C60BE6, 0x89B490E1, 0x60C60BE6, 0x89B490E1, 0x60C60BE6, 0x89B490E1,
+  0x60C60BE6, 0x89B490E1, 0xD966AEAC, 0x9E63A16E, 0xD966AEAC, 0x9E63A16E,
+  0xD966AEAC, 0x9E63A16E, 0xF993F0FE, 0x1F432DFC, 0x2B383B1F, 0xCF461D75,
+  0x2726494D, 0x8D47807B, 0x2B383B1F, 0xCF461D75, 0x71DAB323, 0x8054A25D,
+  0x3EA591F1, 0x689FA0B7, 0x2A76BFC9, 0xB829766F, 0x3EA591F1, 0x689FA0B7,
+  0x3EA591F1, 0x689FA0B7, 0x651E6326, 0x40A79131, 0x651E6326, 0x40A79131,
+  0x651E6326, 0x40A79131, 0x651E6326, 0x40A79131, 0x457D2373, 0xA11F5B21,
+  0x457D2373, 0xA11F5B21, 0x457D2373, 0xA11F5B21, 0xB4A0CFD3, 0x1F13310D,
+  0xE8080890, 0xCB2237EA, 0x552785D6, 0x53C465DC, 0xE8080890, 0xCB2237EA,
+  0x907947B2, 0xB5C4397C, 0x3A51ED33, 0xF79AA8B1, 0x9B038597, 0x09EEABDD,
+  0x3A51ED33, 0xF79AA8B1, 0x3A51ED33, 0xF79AA8B1, 0xFD5C530C, 0x6D717EDC,
+  0xFD5C530C, 0x6D717EDC, 0xFD5C530C, 0x6D717EDC, 0xFD5C530C, 0x6D717EDC,
+  0x606994FA, 0x1BD9E540, 0x606994FA, 0x1BD9E540, 0x606994FA, 0x1BD9E540,
+  0xC842AB78, 0x6004E652, 0xAFF4CCED, 0x962C59B7, 0xB130E7B3, 0x83526E45,
+  0xAFF4CCED, 0x962C59B7, 0x54361799, 0x024A3B17, 0xDBC950D7, 0x62EB7F29,
+  0x4FFB1EA3, 0x88CD169D, 0xDBC950D7, 0x62EB7F29, 0xDBC950D7, 0x62EB7F29,
+  0xB9D382B0, 0x49830757, 0xB9D382B0, 0x49830757, 0xB9D382B0, 0x49830757,
+  0xB9D382B0, 0x49830757
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kDoublePointSignatures [] = {
+  0x0FCF270E, 0x5DC1296A, 0xAEFA1308, 0x4A44B914, 0xB04B5C64, 0x5A5004E0,
+  0x64E875C7, 0x07EB6A06, 0x0FCF270E, 0x5DC1296A, 0xAEFA1308, 0x4A44B914,
+  0xB04B5C64, 0x5A5004E0, 0x64E875C7, 0x07EB6A06, 0x0FCF270E, 0x5DC1296A,
+  0xE5FC9B5C, 0xACB991D8, 0xA84BCB3C, 0x8D90A058, 0x64E875C7, 0x07EB6A06,
+  0x81EA5B32, 0x96FE757E, 0xFA09FCDC, 0xFDFF06D8, 0xB04B5C64, 0x5A5004E0,
+  0x64E875C7, 0x07EB6A06, 0x29CE80D8, 0x2BC57614, 0x7F09F712, 0xD3B3688E,
+  0x5EC4C716, 0x90BC02B2, 0x1BE80B4D, 0xFB04726C, 0x29CE80D8, 0x2BC57614,
+  0x7F09F712, 0xD3B3688E, 0x5EC4C716, 0x90BC02B2, 0x1BE80B4D, 0xFB04726C,
+  0x29CE80D8, 0x2BC57614, 0x555D355E, 0x09FB86EA, 0x01E155DE, 0x5D0AEA3A,
+  0x1BE80B4D, 0xFB04726C, 0x14F69DD4, 0x8327B0B0, 0x0C2D890E, 0x11D38AEA,
+  0x5EC4C716, 0x90BC02B2, 0x1BE80B4D, 0xFB04726C, 0xC6859074, 0xB6DBAF80,
+  0xC1CBD27E, 0x74972A0A, 0xC6DFB06A, 0xB3DEF946, 0x0925ED11, 0xC7BD6398,
+  0xC6859074, 0xB6DBAF80, 0xC1CBD27E, 0x74972A0A, 0xC6DFB06A, 0xB3DEF946,
+  0x0925ED11, 0xC7BD6398, 0xC6859074, 0xB6DBAF80, 0x408D093A, 0xE726A316,
+  0x050C61D2, 0xD7F7B78E, 0x0925ED11, 0xC7BD6398, 0xA9020CD8, 0x4C4E9724,
+  0xE40D10C2, 0x13B8208E, 0xC6DFB06A, 0xB3DEF946, 0x0925ED11, 0xC7BD6398,
+  0x6474B915, 0x749A02B2, 0x11F08E57, 0x595278DC, 0x82ED6E23, 0xC6627FD0,
+  0xAC48F3F0, 0xE35034AE, 0x6474B915, 0x749A02B2, 0x11F08E57, 0x595278DC,
+  0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE, 0x6474B915, 0x749A02B2,
+  0x29D2C51F, 0xE6E1D4C0, 0x2AD10603, 0xBFF71208, 0xAC48F3F0, 0xE35034AE,
+  0x0F3050B5, 0xF3E8A966, 0xBBCC66EB, 0xD384EC20, 0x82ED6E23, 0xC6627FD0,
+  0xAC48F3F0, 0xE35034AE, 0x0FCF270E, 0x5DC1296A, 0xAEFA1308, 0x4A44B914,
+  0xB04B5C64, 0x5A5004E0, 0x64E875C7, 0x07EB6A06, 0x0FCF270E, 0x5DC1296A,
+  0xAEFA1308, 0x4A44B914, 0xB04B5C64, 0x5A5004E0, 0x64E875C7, 0x07EB6A06,
+  0x0FCF270E, 0x5DC1296A, 0xE5FC9B5C, 0xACB991D8, 0xA84BCB3C, 0x8D90A058,
+  0x64E875C7, 0x07EB6A06, 0x81EA5B32, 0x96FE757E, 0xFA09FCDC, 0xFDFF06D8,
+  0xB04B5C64, 0x5A5004E0, 0x64E875C7, 0x07EB6A06, 0x29CE80D8, 0x2BC57614,
+  0x7F09F712, 0xD3B3688E, 0x5EC4C716, 0x90BC02B2, 0x1BE80B4D, 0xFB04726C,
+  0x29CE80D8, 0x2BC57614, 0x7F09F712, 0xD3B3688E, 0x5EC4C716, 0x90BC02B2,
+  0x1BE80B4D, 0xFB04726C, 0x29CE80D8, 0x2BC57614, 0x555D355E, 0x09FB86EA,
+  0x01E155DE, 0x5D0AEA3A, 0x1BE80B4D, 0xFB04726C, 0x14F69DD4, 0x8327B0B0,
+  0x0C2D890E, 0x11D38AEA, 0x5EC4C716, 0x90BC02B2, 0x1BE80B4D, 0xFB04726C,
+  0xC6859074, 0xB6DBAF80, 0xC1CBD27E, 0x74972A0A, 0xC6DFB06A, 0xB3DEF946,
+  0x0925ED11, 0xC7BD6398, 0xC6859074, 0xB6DBAF80, 0xC1CBD27E, 0x74972A0A,
+  0xC6DFB06A, 0xB3DEF946, 0x0925ED11, 0xC7BD6398, 0xC6859074, 0xB6DBAF80,
+  0x408D093A, 0xE726A316, 0x050C61D2, 0xD7F7B78E, 0x0925ED11, 0xC7BD6398,
+  0xA9020CD8, 0x4C4E9724, 0xE40D10C2, 0x13B8208E, 0xC6DFB06A, 0xB3DEF946,
+  0x0925ED11, 0xC7BD6398, 0x6474B915, 0x749A02B2, 0x11F08E57, 0x595278DC,
+  0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE, 0x6474B915, 0x749A02B2,
+  0x11F08E57, 0x595278DC, 0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE,
+  0x6474B915, 0x749A02B2, 0x29D2C51F, 0xE6E1D4C0, 0x2AD10603, 0xBFF71208,
+  0xAC48F3F0, 0xE35034AE, 0x0F3050B5, 0xF3E8A966, 0xBBCC66EB, 0xD384EC20,
+  0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE, 0x0FCF270E, 0x5DC1296A,
+  0xAEFA1308, 0x4A44B914, 0xB04B5C64, 0x5A5004E0, 0x64E875C7, 0x07EB6A06,
+  0x0FCF270E, 0x5DC1296A, 0xAEFA1308, 0x4A44B914, 0xB04B5C64, 0x5A5004E0,
+  0x64E875C7, 0x07EB6A06, 0x0FCF270E, 0x5DC1296A, 0xE5FC9B5C, 0xACB991D8,
+  0xA84BCB3C, 0x8D90A058, 0x64E875C7, 0x07EB6A06, 0x81EA5B32, 0x96FE757E,
+  0xFA09FCDC, 0xFDFF06D8, 0xB04B5C64, 0x5A5004E0, 0x64E875C7, 0x07EB6A06,
+  0x2676E0AC, 0x845C4C08, 0xC04C2E56, 0x1784D412, 0x2E1DA41A, 0x341B5E26,
+  0xB2877BE1, 0xFEDF4878, 0x2676E0AC, 0x845C4C08, 0xC04C2E56, 0x1784D412,
+  0x2E1DA41A, 0x341B5E26, 0xB2877BE1, 0xFEDF4878, 0x2676E0AC, 0x845C4C08,
+  0xA95F4752, 0x0242A77E, 0x6D85F702, 0x6D16706E, 0xB2877BE1, 0xFEDF4878,
+  0x94AA4F68, 0xF72C8CB4, 0x09615C92, 0xEAD2011E, 0x2E1DA41A, 0x341B5E26,
+  0xB2877BE1, 0xFEDF4878, 0x089504AC, 0xA333F3D8, 0xA26A5256, 0xFCAD4CA2,
+  0x74628342, 0x0888931E, 0x02A062C9, 0xEA8C17A0, 0x089504AC, 0xA333F3D8,
+  0xA26A5256, 0xFCAD4CA2, 0x74628342, 0x0888931E, 0x02A062C9, 0xEA8C17A0,
+  0x089504AC, 0xA333F3D8, 0x8B7D6B52, 0xE8AD0D8E, 0x27FA9E0A, 0x718B7446,
+  0x02A062C9, 0xEA8C17A0, 0xDCEAB610, 0xD6B7E65C, 0x5045C6DA, 0x4E22B286,
+  0x74628342, 0x0888931E, 0x02A062C9, 0xEA8C17A0, 0x6474B915, 0x749A02B2,
+  0x11F08E57, 0x595278DC, 0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE,
+  0x6474B915, 0x749A02B2, 0x11F08E57, 0x595278DC, 0x82ED6E23, 0xC6627FD0,
+  0xAC48F3F0, 0xE35034AE, 0x6474B915, 0x749A02B2, 0x29D2C51F, 0xE6E1D4C0,
+  0x2AD10603, 0xBFF71208, 0xAC48F3F0, 0xE35034AE, 0x0F3050B5, 0xF3E8A966,
+  0xBBCC66EB, 0xD384EC20, 0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE,
+  0x6AD1953A, 0xF18C50B6, 0xBB83BCF4, 0xB6FB4720, 0xF9293558, 0xF6044574,
+  0xB4CEBCEB, 0x7475AE3A, 0x6AD1953A, 0xF18C50B6, 0xBB83BCF4, 0xB6FB4720,
+  0xF9293558, 0xF6044574, 0xB4CEBCEB, 0x7475AE3A, 0x6AD1953A, 0xF18C50B6,
+  0x7658F678, 0x6B838D54, 0x8170D590, 0xBD3ACBAC, 0xB4CEBCEB, 0x7475AE3A,
+  0xE875A0FE, 0xDE8DED1A, 0x695D7188, 0xE67D9094, 0xF9293558, 0xF6044574,
+  0xB4CEBCEB, 0x7475AE3A, 0x54CCB7EC, 0x11197658, 0xEEA20596, 0x6A95F522,
+  0x2B820D72, 0x4D60E17E, 0x492FBA99, 0x7CC54E88, 0x54CCB7EC, 0x11197658,
+  0xEEA20596, 0x6A95F522, 0x2B820D72, 0x4D60E17E, 0x492FBA99, 0x7CC54E88,
+  0x54CCB7EC, 0x11197658, 0xAB72E792, 0x5692900E, 0xA6B00C7A, 0xCDC07FA6,
+  0x492FBA99, 0x7CC54E88, 0xBEF0C2A8, 0xFCAFA904, 0x5FE6E0D2, 0xF058436E,
+  0x2B820D72, 0x4D60E17E, 0x492FBA99, 0x7CC54E88, 0xC6859074, 0xB6DBAF80,
+  0xC1CBD27E, 0x74972A0A, 0xC6DFB06A, 0xB3DEF946, 0x0925ED11, 0xC7BD6398,
+  0xC6859074, 0xB6DBAF80, 0xC1CBD27E, 0x74972A0A, 0xC6DFB06A, 0xB3DEF946,
+  0x0925ED11, 0xC7BD6398, 0xC6859074, 0xB6DBAF80, 0x408D093A, 0xE726A316,
+  0x050C61D2, 0xD7F7B78E, 0x0925ED11, 0xC7BD6398, 0xA9020CD8, 0x4C4E9724,
+  0xE40D10C2, 0x13B8208E, 0xC6DFB06A, 0xB3DEF946, 0x0925ED11, 0xC7BD6398,
+  0x6474B915, 0x749A02B2, 0x11F08E57, 0x595278DC, 0x82ED6E23, 0xC6627FD0,
+  0xAC48F3F0, 0xE35034AE, 0x6474B915, 0x749A02B2, 0x11F08E57, 0x595278DC,
+  0x82ED6E23, 0xC6627FD0, 0xAC48F3F0, 0xE35034AE, 0x6474B915, 0x749A02B2,
+  0x29D2C51F, 0xE6E1D4C0, 0x2AD10603, 0xBFF71208, 0xAC48F3F0, 0xE35034AE,
+  0x0F3050B5, 0xF3E8A966, 0xBBCC66EB, 0xD384EC20, 0x82ED6E23, 0xC6627FD0,
+  0xAC48F3F0, 0xE35034AE, 0x9B383469, 0xB3ECBAFD, 0xE4C40ADC, 0x7DE4E7E8,
+  0x784820D9, 0xD3A4EBE5, 0x4B38D3ED, 0xF07A4496, 0x9B383469, 0xB3ECBAFD,
+  0xE4C40ADC, 0x7DE4E7E8, 0x784820D9, 0xD3A4EBE5, 0x4B38D3ED, 0xF07A4496,
+  0x9B383469, 0xB3ECBAFD, 0x06D15086, 0x7360721A, 0xF9846BFF, 0xEBDD258F,
+  0x4B38D3ED, 0xF07A4496, 0x48CF0C87, 0xD264E527, 0x124C5FFE, 0x11081452,
+  0x784820D9, 0xD3A4EBE5, 0x4B38D3ED, 0xF07A4496, 0xFBE04D6C, 0x194D4978,
+  0xE71FE139, 0x444E5A4D, 0xDD9C5A94, 0x1165AF98, 0x7B5B9480, 0x206E9837,
+  0xFBE04D6C, 0x194D4978, 0xE71FE139, 0x444E5A4D, 0xDD9C5A94, 0x1165AF98,
+  0x7B5B9480, 0x206E9837, 0xFBE04D6C, 0x194D4978, 0xF9311787, 0xDD116CF3,
+  0xC590BD52, 0xFB2269E2, 0x7B5B9480, 0x206E9837, 0xE2DD1AC2, 0x3E887342,
+  0x44612537, 0xAB825C33, 0xDD9C5A94, 0x1165AF98, 0x7B5B9480, 0x206E9837,
+  0x12C31F60, 0x98F4B9BC, 0x4CA7A3ED, 0xC0B5F561, 0x6FFFCE50, 0xE7FBF074,
+  0xA8D38F7C, 0xD567C8AB, 0x12C31F60, 0x98F4B9BC, 0x4CA7A3ED, 0xC0B5F561,
+  0x6FFFCE50, 0xE7FBF074, 0xA8D38F7C, 0xD567C8AB, 0x12C31F60, 0x98F4B9BC,
+  0x02C5E2DB, 0x2CEE4F17, 0xB331811E, 0x38907DCE, 0xA8D38F7C, 0xD567C8AB,
+  0x53946CDE, 0x0DA3B52E, 0x55AEB123, 0x4CB7010F, 0x6FFFCE50, 0xE7FBF074,
+  0xA8D38F7C, 0xD567C8AB, 0x517D64DC, 0x73B1A4A4, 0x044C90E9, 0xA7DC5029,
+  0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B, 0x517D64DC, 0x73B1A4A4,
+  0x044C90E9, 0xA7DC5029, 0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B,
+  0x517D64DC, 0x73B1A4A4, 0x4ECE2EF7, 0x59108D1F, 0x73CE3ABA, 0xA26D24E6,
+  0xFAB48AA8, 0xA411874B, 0x2DF95A8A, 0xE4900BDE, 0x4256FF5F, 0xD29DB77F,
+  0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B, 0x9B383469, 0xB3ECBAFD,
+  0xE4C40ADC, 0x7DE4E7E8, 0x784820D9, 0xD3A4EBE5, 0x4B38D3ED, 0xF07A4496,
+  0x9B383469, 0xB3ECBAFD, 0xE4C40ADC, 0x7DE4E7E8, 0x784820D9, 0xD3A4EBE5,
+  0x4B38D3ED, 0xF07A4496, 0x9B383469, 0xB3ECBAFD, 0x06D15086, 0x7360721A,
+  0xF9846BFF, 0xEBDD258F, 0x4B38D3ED, 0xF07A4496, 0x48CF0C87, 0xD264E527,
+  0x124C5FFE, 0x11081452, 0x784820D9, 0xD3A4EBE5, 0x4B38D3ED, 0xF07A4496,
+  0xFBE04D6C, 0x194D4978, 0xE71FE139, 0x444E5A4D, 0xDD9C5A94, 0x1165AF98,
+  0x7B5B9480, 0x206E9837, 0xFBE04D6C, 0x194D4978, 0xE71FE139, 0x444E5A4D,
+  0xDD9C5A94, 0x1165AF98, 0x7B5B9480, 0x206E9837, 0xFBE04D6C, 0x194D4978,
+  0xF9311787, 0xDD116CF3, 0xC590BD52, 0xFB2269E2, 0x7B5B9480, 0x206E9837,
+  0xE2DD1AC2, 0x3E887342, 0x44612537, 0xAB825C33, 0xDD9C5A94, 0x1165AF98,
+  0x7B5B9480, 0x206E9837, 0x12C31F60, 0x98F4B9BC, 0x4CA7A3ED, 0xC0B5F561,
+  0x6FFFCE50, 0xE7FBF074, 0xA8D38F7C, 0xD567C8AB, 0x12C31F60, 0x98F4B9BC,
+  0x4CA7A3ED, 0xC0B5F561, 0x6FFFCE50, 0xE7FBF074, 0xA8D38F7C, 0xD567C8AB,
+  0x12C31F60, 0x98F4B9BC, 0x02C5E2DB, 0x2CEE4F17, 0xB331811E, 0x38907DCE,
+  0xA8D38F7C, 0xD567C8AB, 0x53946CDE, 0x0DA3B52E, 0x55AEB123, 0x4CB7010F,
+  0x6FFFCE50, 0xE7FBF074, 0xA8D38F7C, 0xD567C8AB, 0x517D64DC, 0x73B1A4A4,
+  0x044C90E9, 0xA7DC5029, 0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B,
+  0x517D64DC, 0x73B1A4A4, 0x044C90E9, 0xA7DC5029, 0xD85B24BC, 0x1BDCB36C,
+  0xFAB48AA8, 0xA411874B, 0x517D64DC, 0x73B1A4A4, 0x4ECE2EF7, 0x59108D1F,
+  0x73CE3ABA, 0xA26D24E6, 0xFAB48AA8, 0xA411874B, 0x2DF95A8A, 0xE4900BDE,
+  0x4256FF5F, 0xD29DB77F, 0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B,
+  0x9B383469, 0xB3ECBAFD, 0xE4C40ADC, 0x7DE4E7E8, 0x784820D9, 0xD3A4EBE5,
+  0x4B38D3ED, 0xF07A4496, 0x9B383469, 0xB3ECBAFD, 0xE4C40ADC, 0x7DE4E7E8,
+  0x784820D9, 0xD3A4EBE5, 0x4B38D3ED, 0xF07A4496, 0x9B383469, 0xB3ECBAFD,
+  0x06D15086, 0x7360721A, 0xF9846BFF, 0xEBDD258F, 0x4B38D3ED, 0xF07A4496,
+  0x48CF0C87, 0xD264E527, 0x124C5FFE, 0x11081452, 0x784820D9, 0xD3A4EBE5,
+  0x4B38D3ED, 0xF07A4496, 0xF2370B3E, 0x4CE7500A, 0xD97EB40F, 0x520D35D3,
+  0xDFA07E36, 0xA136DA3A, 0xD30EFE12, 0xC8AC4241, 0xF2370B3E, 0x4CE7500A,
+  0xD97EB40F, 0x520D35D3, 0xDFA07E36, 0xA136DA3A, 0xD30EFE12, 0xC8AC4241,
+  0xF2370B3E, 0x4CE7500A, 0x90608721, 0xA464A92D, 0x1F989768, 0xE06D63F0,
+  0xD30EFE12, 0xC8AC4241, 0x708E4E18, 0x74C02920, 0x324DFAD1, 0x3288068D,
+  0xDFA07E36, 0xA136DA3A, 0xD30EFE12, 0xC8AC4241, 0x4B0DBDF6, 0x23B5A14E,
+  0x14A1F327, 0x534F71E7, 0xC9114C46, 0xF91530E6, 0x455B2FC2, 0x23C4D145,
+  0x4B0DBDF6, 0x23B5A14E, 0x14A1F327, 0x534F71E7, 0xC9114C46, 0xF91530E6,
+  0x455B2FC2, 0x23C4D145, 0x4B0DBDF6, 0x23B5A14E, 0x19ED79D9, 0xE7171831,
+  0x2DD31AB8, 0x7284BF6C, 0x455B2FC2, 0x23C4D145, 0x7D6AAA78, 0x7CDF80AC,
+  0x540CAB31, 0x411CF5C9, 0xC9114C46, 0xF91530E6, 0x455B2FC2, 0x23C4D145,
+  0x517D64DC, 0x73B1A4A4, 0x044C90E9, 0xA7DC5029, 0xD85B24BC, 0x1BDCB36C,
+  0xFAB48AA8, 0xA411874B, 0x517D64DC, 0x73B1A4A4, 0x044C90E9, 0xA7DC5029,
+  0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B, 0x517D64DC, 0x73B1A4A4,
+  0x4ECE2EF7, 0x59108D1F, 0x73CE3ABA, 0xA26D24E6, 0xFAB48AA8, 0xA411874B,
+  0x2DF95A8A, 0xE4900BDE, 0x4256FF5F, 0xD29DB77F, 0xD85B24BC, 0x1BDCB36C,
+  0xFAB48AA8, 0xA411874B, 0x5D275385, 0x4EB28D09, 0x2EF6B478, 0x06D02204,
+  0x692AAB7D, 0x64280F59, 0x88A0DE21, 0x3CA8B74A, 0x5D275385, 0x4EB28D09,
+  0x2EF6B478, 0x06D02204, 0x692AAB7D, 0x64280F59, 0x88A0DE21, 0x3CA8B74A,
+  0x5D275385, 0x4EB28D09, 0xEA3D9A62, 0x111375A6, 0xE3EDAC63, 0xA27C9143,
+  0x88A0DE21, 0x3CA8B74A, 0x73E409A3, 0x9E138E63, 0x2AEC84DA, 0xD7C6712E,
+  0x692AAB7D, 0x64280F59, 0x88A0DE21, 0x3CA8B74A, 0x3A870924, 0x48B9A81C,
+  0x911F9791, 0x71B68541, 0xC68DDD04, 0x14372634, 0x18DA63D0, 0x9F670573,
+  0x3A870924, 0x48B9A81C, 0x911F9791, 0x71B68541, 0xC68DDD04, 0x14372634,
+  0x18DA63D0, 0x9F670573, 0x3A870924, 0x48B9A81C, 0xC2E42D7F, 0xF2D132F7,
+  0xAFC10742, 0x64CBB38E, 0x18DA63D0, 0x9F670573, 0x2B25484A, 0x63278536,
+  0x6BC1FE1F, 0x037CDCD7, 0xC68DDD04, 0x14372634, 0x18DA63D0, 0x9F670573,
+  0x12C31F60, 0x98F4B9BC, 0x4CA7A3ED, 0xC0B5F561, 0x6FFFCE50, 0xE7FBF074,
+  0xA8D38F7C, 0xD567C8AB, 0x12C31F60, 0x98F4B9BC, 0x4CA7A3ED, 0xC0B5F561,
+  0x6FFFCE50, 0xE7FBF074, 0xA8D38F7C, 0xD567C8AB, 0x12C31F60, 0x98F4B9BC,
+  0x02C5E2DB, 0x2CEE4F17, 0xB331811E, 0x38907DCE, 0xA8D38F7C, 0xD567C8AB,
+  0x53946CDE, 0x0DA3B52E, 0x55AEB123, 0x4CB7010F, 0x6FFFCE50, 0xE7FBF074,
+  0xA8D38F7C, 0xD567C8AB, 0x517D64DC, 0x73B1A4A4, 0x044C90E9, 0xA7DC5029,
+  0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B, 0x517D64DC, 0x73B1A4A4,
+  0x044C90E9, 0xA7DC5029, 0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B,
+  0x517D64DC, 0x73B1A4A4, 0x4ECE2EF7, 0x59108D1F, 0x73CE3ABA, 0xA26D24E6,
+  0xFAB48AA8, 0xA411874B, 0x2DF95A8A, 0xE4900BDE, 0x4256FF5F, 0xD29DB77F,
+  0xD85B24BC, 0x1BDCB36C, 0xFAB48AA8, 0xA411874B, 0xF77BB2D6, 0x66495B3B,
+  0xD48F327A, 0xBDD2AD25, 0xEE04B0D4, 0xE07CDC97, 0x0DF6DE2A, 0x293CB20B,
+  0x4C2669E0, 0x58285609, 0x7A909626, 0x0BF45A27, 0xC46C7F86, 0x962FABF9,
+  0xFADAEE80, 0xAEADA749, 0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2,
+  0xF77BB2D6, 0x66495B3B, 0xD48F327A, 0xBDD2AD25, 0xEE04B0D4, 0xE07CDC97,
+  0x0DF6DE2A, 0x293CB20B, 0x4C2669E0, 0x58285609, 0x7A909626, 0x0BF45A27,
+  0xC46C7F86, 0x962FABF9, 0xFADAEE80, 0xAEADA749, 0xDA2D8830, 0x931E8A9D,
+  0x2F65CE85, 0x47A98EF2, 0xF77BB2D6, 0x66495B3B, 0xD48F327A, 0xBDD2AD25,
+  0xEE04B0D4, 0x806DADFD, 0xE772EF4C, 0x359D7211, 0xEB73982E, 0x2D8B64A3,
+  0x8D725C10, 0x66C419D1, 0xAF95EE30, 0xE14762EF, 0x8F0CB1D6, 0xAEADA749,
+  0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2, 0x9BE7873C, 0xAD7DA18D,
+  0x7563BE3C, 0x99E4C5A3, 0x2A80AC22, 0x48B82D69, 0x71EC76FC, 0xA73C2D59,
+  0x2C3892CE, 0x4DD0564B, 0x7A909626, 0x0BF45A27, 0xC46C7F86, 0x962FABF9,
+  0xFADAEE80, 0xAEADA749, 0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2,
+  0xFF2F55EB, 0x1A803AEE, 0x2CEBAD43, 0x8548252C, 0x48BF6CAD, 0x92DDCAAA,
+  0x68A2D8BF, 0x7AA39F92, 0x3C1B11A1, 0xBCA9B408, 0xF460226B, 0x183D722A,
+  0xD648D7B7, 0x26DC3110, 0x3B440429, 0x36794B2C, 0x2B216F11, 0xE9EC3328,
+  0x48556530, 0x8B8F0BBF, 0xFF2F55EB, 0x1A803AEE, 0x2CEBAD43, 0x8548252C,
+  0x48BF6CAD, 0x92DDCAAA, 0x68A2D8BF, 0x7AA39F92, 0x3C1B11A1, 0xBCA9B408,
+  0xF460226B, 0x183D722A, 0xD648D7B7, 0x26DC3110, 0x3B440429, 0x36794B2C,
+  0x2B216F11, 0xE9EC3328, 0x48556530, 0x8B8F0BBF, 0xFF2F55EB, 0x1A803AEE,
+  0x2CEBAD43, 0x8548252C, 0x48BF6CAD, 0x8213980C, 0x0B2B5145, 0x719AA894,
+  0x1E84911B, 0xA0C805F6, 0xC50E0985, 0xB73BEA64, 0x31189761, 0x0D21F9E6,
+  0x10FDFD9F, 0x36794B2C, 0x2B216F11, 0xE9EC3328, 0x48556530, 0x8B8F0BBF,
+  0xCA6DF2A9, 0xA67E01F0, 0x872B9AFD, 0x6507816A, 0xF06072FB, 0x5866E988,
+  0x47423E1D, 0xFBCD4BAC, 0x87CA2AF3, 0xFE2E0186, 0xF460226B, 0x183D722A,
+  0xD648D7B7, 0x26DC3110, 0x3B440429, 0x36794B2C, 0x2B216F11, 0xE9EC3328,
+  0x48556530, 0x8B8F0BBF, 0x76D5372B, 0x519982A6, 0x614906EB, 0xBDCA7608,
+  0x4EB412D9, 0x0A83ABEA, 0x4076A3D7, 0x07BAE85A, 0xFC5A246D, 0x98684664,
+  0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34, 0x658B7F3D, 0xEA9BEEDC,
+  0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3, 0x76D5372B, 0x519982A6,
+  0x614906EB, 0xBDCA7608, 0x4EB412D9, 0x0A83ABEA, 0x4076A3D7, 0x07BAE85A,
+  0xFC5A246D, 0x98684664, 0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34,
+  0x658B7F3D, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3,
+  0x76D5372B, 0x519982A6, 0x614906EB, 0xBDCA7608, 0x4EB412D9, 0xCD7A684C,
+  0x42F8AEBD, 0x1C21CA3C, 0x08665127, 0xB0606C82, 0x35F205CD, 0xCB5F70E4,
+  0x289C0471, 0xB963839A, 0x505BC963, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290,
+  0x9E365F6C, 0x3A6B05B3, 0x8B659891, 0xBD3068B0, 0xF5C2F075, 0x4C38DC1E,
+  0x2914DD27, 0xA37955B0, 0x31B593DD, 0xF4A5DEC4, 0xD55A4267, 0x91164E02,
+  0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34, 0x658B7F3D, 0xEA9BEEDC,
+  0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3, 0x2E220056, 0xF5F71552,
+  0x92937F13, 0xE0266815, 0x4B10E1B4, 0x17265017, 0xA49A2583, 0xA69F6822,
+  0x6E7A24D0, 0xCB527C69, 0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919,
+  0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A,
+  0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815, 0x4B10E1B4, 0x17265017,
+  0xA49A2583, 0xA69F6822, 0x6E7A24D0, 0xCB527C69, 0x857D4EA6, 0x1102D42E,
+  0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0,
+  0x9A12D06D, 0x31EFCD4A, 0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815,
+  0x4B10E1B4, 0xB717217D, 0x3D40C2E9, 0x9D967124, 0x23E5489E, 0x8BD33703,
+  0x985BEE90, 0xB82AB158, 0x49243931, 0x7D8AAB8F, 0x7B36D12E, 0x10CFDA81,
+  0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A, 0xAD145570, 0x888E9C90,
+  0xC88ED0B1, 0x9C509EA7, 0xAF400356, 0xA659726D, 0x11F61BBD, 0xCC0DAF20,
+  0x823DD562, 0xA68BE79F, 0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919,
+  0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A,
+  0xF77BB2D6, 0x66495B3B, 0xD48F327A, 0xBDD2AD25, 0xEE04B0D4, 0xE07CDC97,
+  0x0DF6DE2A, 0x293CB20B, 0x4C2669E0, 0x58285609, 0x7A909626, 0x0BF45A27,
+  0xC46C7F86, 0x962FABF9, 0xFADAEE80, 0xAEADA749, 0xDA2D8830, 0x931E8A9D,
+  0x2F65CE85, 0x47A98EF2, 0xF77BB2D6, 0x66495B3B, 0xD48F327A, 0xBDD2AD25,
+  0xEE04B0D4, 0xE07CDC97, 0x0DF6DE2A, 0x293CB20B, 0x4C2669E0, 0x58285609,
+  0x7A909626, 0x0BF45A27, 0xC46C7F86, 0x962FABF9, 0xFADAEE80, 0xAEADA749,
+  0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2, 0xF77BB2D6, 0x66495B3B,
+  0xD48F327A, 0xBDD2AD25, 0xEE04B0D4, 0x806DADFD, 0xE772EF4C, 0x359D7211,
+  0xEB73982E, 0x2D8B64A3, 0x8D725C10, 0x66C419D1, 0xAF95EE30, 0xE14762EF,
+  0x8F0CB1D6, 0xAEADA749, 0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2,
+  0x9BE7873C, 0xAD7DA18D, 0x7563BE3C, 0x99E4C5A3, 0x2A80AC22, 0x48B82D69,
+  0x71EC76FC, 0xA73C2D59, 0x2C3892CE, 0x4DD0564B, 0x7A909626, 0x0BF45A27,
+  0xC46C7F86, 0x962FABF9, 0xFADAEE80, 0xAEADA749, 0xDA2D8830, 0x931E8A9D,
+  0x2F65CE85, 0x47A98EF2, 0xFF2F55EB, 0x1A803AEE, 0x2CEBAD43, 0x8548252C,
+  0x48BF6CAD, 0x92DDCAAA, 0x68A2D8BF, 0x7AA39F92, 0x3C1B11A1, 0xBCA9B408,
+  0xF460226B, 0x183D722A, 0xD648D7B7, 0x26DC3110, 0x3B440429, 0x36794B2C,
+  0x2B216F11, 0xE9EC3328, 0x48556530, 0x8B8F0BBF, 0xFF2F55EB, 0x1A803AEE,
+  0x2CEBAD43, 0x8548252C, 0x48BF6CAD, 0x92DDCAAA, 0x68A2D8BF, 0x7AA39F92,
+  0x3C1B11A1, 0xBCA9B408, 0xF460226B, 0x183D722A, 0xD648D7B7, 0x26DC3110,
+  0x3B440429, 0x36794B2C, 0x2B216F11, 0xE9EC3328, 0x48556530, 0x8B8F0BBF,
+  0xFF2F55EB, 0x1A803AEE, 0x2CEBAD43, 0x8548252C, 0x48BF6CAD, 0x8213980C,
+  0x0B2B5145, 0x719AA894, 0x1E84911B, 0xA0C805F6, 0xC50E0985, 0xB73BEA64,
+  0x31189761, 0x0D21F9E6, 0x10FDFD9F, 0x36794B2C, 0x2B216F11, 0xE9EC3328,
+  0x48556530, 0x8B8F0BBF, 0xCA6DF2A9, 0xA67E01F0, 0x872B9AFD, 0x6507816A,
+  0xF06072FB, 0x5866E988, 0x47423E1D, 0xFBCD4BAC, 0x87CA2AF3, 0xFE2E0186,
+  0xF460226B, 0x183D722A, 0xD648D7B7, 0x26DC3110, 0x3B440429, 0x36794B2C,
+  0x2B216F11, 0xE9EC3328, 0x48556530, 0x8B8F0BBF, 0x76D5372B, 0x519982A6,
+  0x614906EB, 0xBDCA7608, 0x4EB412D9, 0x0A83ABEA, 0x4076A3D7, 0x07BAE85A,
+  0xFC5A246D, 0x98684664, 0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34,
+  0x658B7F3D, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3,
+  0x76D5372B, 0x519982A6, 0x614906EB, 0xBDCA7608, 0x4EB412D9, 0x0A83ABEA,
+  0x4076A3D7, 0x07BAE85A, 0xFC5A246D, 0x98684664, 0x6A21CC73, 0x2C641EAA,
+  0xCF0B0C47, 0xD68C1D34, 0x658B7F3D, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290,
+  0x9E365F6C, 0x3A6B05B3, 0x76D5372B, 0x519982A6, 0x614906EB, 0xBDCA7608,
+  0x4EB412D9, 0xCD7A684C, 0x42F8AEBD, 0x1C21CA3C, 0x08665127, 0xB0606C82,
+  0x35F205CD, 0xCB5F70E4, 0x289C0471, 0xB963839A, 0x505BC963, 0xEA9BEEDC,
+  0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3, 0x8B659891, 0xBD3068B0,
+  0xF5C2F075, 0x4C38DC1E, 0x2914DD27, 0xA37955B0, 0x31B593DD, 0xF4A5DEC4,
+  0xD55A4267, 0x91164E02, 0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34,
+  0x658B7F3D, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3,
+  0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815, 0x4B10E1B4, 0x17265017,
+  0xA49A2583, 0xA69F6822, 0x6E7A24D0, 0xCB527C69, 0x857D4EA6, 0x1102D42E,
+  0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0,
+  0x9A12D06D, 0x31EFCD4A, 0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815,
+  0x4B10E1B4, 0x17265017, 0xA49A2583, 0xA69F6822, 0x6E7A24D0, 0xCB527C69,
+  0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81,
+  0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A, 0x2E220056, 0xF5F71552,
+  0x92937F13, 0xE0266815, 0x4B10E1B4, 0xB717217D, 0x3D40C2E9, 0x9D967124,
+  0x23E5489E, 0x8BD33703, 0x985BEE90, 0xB82AB158, 0x49243931, 0x7D8AAB8F,
+  0x7B36D12E, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A,
+  0xAD145570, 0x888E9C90, 0xC88ED0B1, 0x9C509EA7, 0xAF400356, 0xA659726D,
+  0x11F61BBD, 0xCC0DAF20, 0x823DD562, 0xA68BE79F, 0x857D4EA6, 0x1102D42E,
+  0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0,
+  0x9A12D06D, 0x31EFCD4A, 0xF77BB2D6, 0x66495B3B, 0xD48F327A, 0xBDD2AD25,
+  0xEE04B0D4, 0xE07CDC97, 0x0DF6DE2A, 0x293CB20B, 0x4C2669E0, 0x58285609,
+  0x7A909626, 0x0BF45A27, 0xC46C7F86, 0x962FABF9, 0xFADAEE80, 0xAEADA749,
+  0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2, 0xF77BB2D6, 0x66495B3B,
+  0xD48F327A, 0xBDD2AD25, 0xEE04B0D4, 0xE07CDC97, 0x0DF6DE2A, 0x293CB20B,
+  0x4C2669E0, 0x58285609, 0x7A909626, 0x0BF45A27, 0xC46C7F86, 0x962FABF9,
+  0xFADAEE80, 0xAEADA749, 0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2,
+  0xF77BB2D6, 0x66495B3B, 0xD48F327A, 0xBDD2AD25, 0xEE04B0D4, 0x806DADFD,
+  0xE772EF4C, 0x359D7211, 0xEB73982E, 0x2D8B64A3, 0x8D725C10, 0x66C419D1,
+  0xAF95EE30, 0xE14762EF, 0x8F0CB1D6, 0xAEADA749, 0xDA2D8830, 0x931E8A9D,
+  0x2F65CE85, 0x47A98EF2, 0x9BE7873C, 0xAD7DA18D, 0x7563BE3C, 0x99E4C5A3,
+  0x2A80AC22, 0x48B82D69, 0x71EC76FC, 0xA73C2D59, 0x2C3892CE, 0x4DD0564B,
+  0x7A909626, 0x0BF45A27, 0xC46C7F86, 0x962FABF9, 0xFADAEE80, 0xAEADA749,
+  0xDA2D8830, 0x931E8A9D, 0x2F65CE85, 0x47A98EF2, 0x5DEAE921, 0x5E1D9C34,
+  0x9A55B2E9, 0xF00F87E6, 0x7320708B, 0x934F255C, 0x8EF5FD49, 0x6E5DF0D4,
+  0x58D08097, 0xBC27397A, 0xF07D0469, 0x99838430, 0xD368FAED, 0x2CD49ABA,
+  0x8799EAF7, 0xE463C236, 0x998A95EB, 0x2DE1F0FA, 0xC1096D52, 0xAD870ED5,
+  0x5DEAE921, 0x5E1D9C34, 0x9A55B2E9, 0xF00F87E6, 0x7320708B, 0x934F255C,
+  0x8EF5FD49, 0x6E5DF0D4, 0x58D08097, 0xBC27397A, 0xF07D0469, 0x99838430,
+  0xD368FAED, 0x2CD49ABA, 0x8799EAF7, 0xE463C236, 0x998A95EB, 0x2DE1F0FA,
+  0xC1096D52, 0xAD870ED5, 0x5DEAE921, 0x5E1D9C34, 0x9A55B2E9, 0xF00F87E6,
+  0x7320708B, 0x6A6A28BA, 0xDEF2A2E3, 0xA3A5F8D2, 0x36A3385D, 0x5B011EFC,
+  0x6F3CD55F, 0xAE5A1586, 0x09756333, 0x601B29D4, 0x0FD69EE1, 0xE463C236,
+  0x998A95EB, 0x2DE1F0FA, 0xC1096D52, 0xAD870ED5, 0x86373AE3, 0xAF05E112,
+  0x53627DAF, 0xDF657C68, 0x9FB6CB9D, 0x7818915E, 0x1EF2A8FB, 0x5BBDA84A,
+  0xC517C135, 0x1AD8584C, 0xF07D0469, 0x99838430, 0xD368FAED, 0x2CD49ABA,
+  0x8799EAF7, 0xE463C236, 0x998A95EB, 0x2DE1F0FA, 0xC1096D52, 0xAD870ED5,
+  0xEDE83499, 0xFBAB8F08, 0x8885899D, 0x15B3F112, 0x83E49E77, 0xC7189434,
+  0x752CA74D, 0x116AA758, 0xB5E019E3, 0x544B15C6, 0xD78C6329, 0xC93CF7FC,
+  0xCF26D5F9, 0xF4CB8F3E, 0xEA05910B, 0x5FCF6E36, 0x339B92FF, 0x517AAA16,
+  0xE643B0B6, 0x9CD664E1, 0xEDE83499, 0xFBAB8F08, 0x8885899D, 0x15B3F112,
+  0x83E49E77, 0xC7189434, 0x752CA74D, 0x116AA758, 0xB5E019E3, 0x544B15C6,
+  0xD78C6329, 0xC93CF7FC, 0xCF26D5F9, 0xF4CB8F3E, 0xEA05910B, 0x5FCF6E36,
+  0x339B92FF, 0x517AAA16, 0xE643B0B6, 0x9CD664E1, 0xEDE83499, 0xFBAB8F08,
+  0x8885899D, 0x15B3F112, 0x83E49E77, 0x1C5BBDF2, 0x72AA9C67, 0xD066BA06,
+  0xC887AE49, 0x93B7B198, 0x828B451F, 0xF6EAC882, 0x5C8219AF, 0x7422AFA8,
+  0xB88DD7A5, 0x5FCF6E36, 0x339B92FF, 0x517AAA16, 0xE643B0B6, 0x9CD664E1,
+  0x22F9A313, 0xE6DC6C0E, 0xDD73DD23, 0x665AE1DC, 0x08FA4669, 0xF14CE5CE,
+  0x97F5D657, 0x3367EE8E, 0xE78CDCB9, 0x62424118, 0xD78C6329, 0xC93CF7FC,
+  0xCF26D5F9, 0xF4CB8F3E, 0xEA05910B, 0x5FCF6E36, 0x339B92FF, 0x517AAA16,
+  0xE643B0B6, 0x9CD664E1, 0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815,
+  0x4B10E1B4, 0x17265017, 0xA49A2583, 0xA69F6822, 0x6E7A24D0, 0xCB527C69,
+  0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81,
+  0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A, 0x2E220056, 0xF5F71552,
+  0x92937F13, 0xE0266815, 0x4B10E1B4, 0x17265017, 0xA49A2583, 0xA69F6822,
+  0x6E7A24D0, 0xCB527C69, 0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919,
+  0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A,
+  0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815, 0x4B10E1B4, 0xB717217D,
+  0x3D40C2E9, 0x9D967124, 0x23E5489E, 0x8BD33703, 0x985BEE90, 0xB82AB158,
+  0x49243931, 0x7D8AAB8F, 0x7B36D12E, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0,
+  0x9A12D06D, 0x31EFCD4A, 0xAD145570, 0x888E9C90, 0xC88ED0B1, 0x9C509EA7,
+  0xAF400356, 0xA659726D, 0x11F61BBD, 0xCC0DAF20, 0x823DD562, 0xA68BE79F,
+  0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81,
+  0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A, 0x3C7A3AAE, 0x5A67D437,
+  0x6CC00686, 0x6B5E1949, 0x6350B1B0, 0xEE59DC4F, 0x67E5B586, 0x5BA04DB7,
+  0xFFCEC1B4, 0xF2C3DF35, 0xB477A516, 0xEF56E133, 0x6F1F6ECA, 0x27F4342D,
+  0x5357DA04, 0x77842905, 0xE1B93DF8, 0x92F408C5, 0x1017F5D5, 0x70C9927A,
+  0x3C7A3AAE, 0x5A67D437, 0x6CC00686, 0x6B5E1949, 0x6350B1B0, 0xEE59DC4F,
+  0x67E5B586, 0x5BA04DB7, 0xFFCEC1B4, 0xF2C3DF35, 0xB477A516, 0xEF56E133,
+  0x6F1F6ECA, 0x27F4342D, 0x5357DA04, 0x77842905, 0xE1B93DF8, 0x92F408C5,
+  0x1017F5D5, 0x70C9927A, 0x3C7A3AAE, 0x5A67D437, 0x6CC00686, 0x6B5E1949,
+  0x6350B1B0, 0x19C95D95, 0xA8ECC8D8, 0x757BEF9D, 0x09244F92, 0x46FCAB8F,
+  0x8EE90340, 0xB94A78ED, 0x0E1DE704, 0x4AB6FE13, 0x01E39DAA, 0x77842905,
+  0xE1B93DF8, 0x92F408C5, 0x1017F5D5, 0x70C9927A, 0xFB958984, 0x8FC239C1,
+  0xDC1C4C40, 0x2948C35F, 0xA6D69C36, 0x196F71F1, 0xA8204630, 0x6583CB6D,
+  0xF10D6E9A, 0x86C5C37F, 0xB477A516, 0xEF56E133, 0x6F1F6ECA, 0x27F4342D,
+  0x5357DA04, 0x77842905, 0xE1B93DF8, 0x92F408C5, 0x1017F5D5, 0x70C9927A,
+  0x1EAB505B, 0xA914D3C6, 0x22F9B2BB, 0x43D6CEE0, 0x24E02DA1, 0x776EF45A,
+  0x97F1F4F7, 0xCAAA5BAA, 0xB9280FA5, 0xCBFD494C, 0xCF8BCD13, 0xBD4476B2,
+  0xE006ED17, 0x731B1384, 0x7848F975, 0xE0948BF8, 0x60AFB1BD, 0x8C0EBD44,
+  0x19354638, 0xD855E537, 0x1EAB505B, 0xA914D3C6, 0x22F9B2BB, 0x43D6CEE0,
+  0x24E02DA1, 0x776EF45A, 0x97F1F4F7, 0xCAAA5BAA, 0xB9280FA5, 0xCBFD494C,
+  0xCF8BCD13, 0xBD4476B2, 0xE006ED17, 0x731B1384, 0x7848F975, 0xE0948BF8,
+  0x60AFB1BD, 0x8C0EBD44, 0x19354638, 0xD855E537, 0x1EAB505B, 0xA914D3C6,
+  0x22F9B2BB, 0x43D6CEE0, 0x24E02DA1, 0xA18F927C, 0x8591ABDD, 0xA4266CCC,
+  0xF48B5B7F, 0x7CF0888A, 0xB2BBE96D, 0x57263E6C, 0x3AD6ACC1, 0x7ABC2F2A,
+  0xA9C0B2DB, 0xE0948BF8, 0x60AFB1BD, 0x8C0EBD44, 0x19354638, 0xD855E537,
+  0xC2ABAEF9, 0x4C0B8CC0, 0xEB165C3D, 0xA124FF76, 0xF72D3C77, 0x50A4A5D8,
+  0xD5730BED, 0x5FB80CEC, 0xAEB2D23F, 0x4910B7D2, 0xCF8BCD13, 0xBD4476B2,
+  0xE006ED17, 0x731B1384, 0x7848F975, 0xE0948BF8, 0x60AFB1BD, 0x8C0EBD44,
+  0x19354638, 0xD855E537, 0x76D5372B, 0x519982A6, 0x614906EB, 0xBDCA7608,
+  0x4EB412D9, 0x0A83ABEA, 0x4076A3D7, 0x07BAE85A, 0xFC5A246D, 0x98684664,
+  0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34, 0x658B7F3D, 0xEA9BEEDC,
+  0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3, 0x76D5372B, 0x519982A6,
+  0x614906EB, 0xBDCA7608, 0x4EB412D9, 0x0A83ABEA, 0x4076A3D7, 0x07BAE85A,
+  0xFC5A246D, 0x98684664, 0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34,
+  0x658B7F3D, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3,
+  0x76D5372B, 0x519982A6, 0x614906EB, 0xBDCA7608, 0x4EB412D9, 0xCD7A684C,
+  0x42F8AEBD, 0x1C21CA3C, 0x08665127, 0xB0606C82, 0x35F205CD, 0xCB5F70E4,
+  0x289C0471, 0xB963839A, 0x505BC963, 0xEA9BEEDC, 0x8D24DD01, 0xEE530290,
+  0x9E365F6C, 0x3A6B05B3, 0x8B659891, 0xBD3068B0, 0xF5C2F075, 0x4C38DC1E,
+  0x2914DD27, 0xA37955B0, 0x31B593DD, 0xF4A5DEC4, 0xD55A4267, 0x91164E02,
+  0x6A21CC73, 0x2C641EAA, 0xCF0B0C47, 0xD68C1D34, 0x658B7F3D, 0xEA9BEEDC,
+  0x8D24DD01, 0xEE530290, 0x9E365F6C, 0x3A6B05B3, 0x2E220056, 0xF5F71552,
+  0x92937F13, 0xE0266815, 0x4B10E1B4, 0x17265017, 0xA49A2583, 0xA69F6822,
+  0x6E7A24D0, 0xCB527C69, 0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919,
+  0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A,
+  0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815, 0x4B10E1B4, 0x17265017,
+  0xA49A2583, 0xA69F6822, 0x6E7A24D0, 0xCB527C69, 0x857D4EA6, 0x1102D42E,
+  0xEF901B07, 0x1C51D919, 0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0,
+  0x9A12D06D, 0x31EFCD4A, 0x2E220056, 0xF5F71552, 0x92937F13, 0xE0266815,
+  0x4B10E1B4, 0xB717217D, 0x3D40C2E9, 0x9D967124, 0x23E5489E, 0x8BD33703,
+  0x985BEE90, 0xB82AB158, 0x49243931, 0x7D8AAB8F, 0x7B36D12E, 0x10CFDA81,
+  0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A, 0xAD145570, 0x888E9C90,
+  0xC88ED0B1, 0x9C509EA7, 0xAF400356, 0xA659726D, 0x11F61BBD, 0xCC0DAF20,
+  0x823DD562, 0xA68BE79F, 0x857D4EA6, 0x1102D42E, 0xEF901B07, 0x1C51D919,
+  0xFAD26798, 0x10CFDA81, 0xEBEB9C1D, 0x10A392D0, 0x9A12D06D, 0x31EFCD4A,
+  0x0CEAA956, 0xD2A225FA, 0xF1C0A7D0, 0xD96C9924, 0xE66AC42C, 0xC7B951C0,
+  0xF8CFA521, 0x1934BDAA, 0x0CEAA956, 0xD2A225FA, 0xF1C0A7D0, 0xD96C9924,
+  0xE66AC42C, 0xC7B951C0, 0xF8CFA521, 0x1934BDAA, 0x0CEAA956, 0xD2A225FA,
+  0x463BAE24, 0x8909C4A8, 0x60850C34, 0xAA631EC8, 0xF8CFA521, 0x1934BDAA,
+  0x398E35A2, 0x7ED15636, 0xCE48DA0C, 0x64E78030, 0xE66AC42C, 0xC7B951C0,
+  0xF8CFA521, 0x1934BDAA, 0x50A92460, 0xB1DA92C4, 0x725AE73A, 0x265C06BE,
+  0x3C79DD6E, 0xB357D122, 0x70D393FF, 0x53205AA0, 0x50A92460, 0xB1DA92C4,
+  0x725AE73A, 0x265C06BE, 0x3C79DD6E, 0xB357D122, 0x70D393FF, 0x53205AA0,
+  0x50A92460, 0xB1DA92C4, 0x6B9285E6, 0xA990B81A, 0x34AF9006, 0xCF01E59A,
+  0x70D393FF, 0x53205AA0, 0xAD8E9B94, 0x62319A48, 0x355C05CE, 0x97FF4002,
+  0x3C79DD6E, 0xB357D122, 0x70D393FF, 0x53205AA0, 0x596C7D7C, 0xC3E20E20,
+  0x379E0C26, 0xE987DD6A, 0x1C2AC272, 0x089C2756, 0xC6BC8F13, 0xFA5E682C,
+  0x596C7D7C, 0xC3E20E20, 0x379E0C26, 0xE987DD6A, 0x1C2AC272, 0x089C2756,
+  0xC6BC8F13, 0xFA5E682C, 0x596C7D7C, 0xC3E20E20, 0xA60AF9E2, 0xE2ACCCB6,
+  0xBBB07EEA, 0x439FAACE, 0xC6BC8F13, 0xFA5E682C, 0xDA838148, 0x915C709C,
+  0xF4B36172, 0xC59FF2C6, 0x1C2AC272, 0x089C2756, 0xC6BC8F13, 0xFA5E682C,
+  0x8C660EB3, 0xC7FE270E, 0xF860112D, 0x67826B58, 0xDA9D9059, 0xEC9BC28C,
+  0xAA039774, 0x9FAFAC46, 0x8C660EB3, 0xC7FE270E, 0xF860112D, 0x67826B58,
+  0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46, 0x8C660EB3, 0xC7FE270E,
+  0x05AFEB85, 0x546B6F8C, 0x26D37079, 0x48F195F4, 0xAA039774, 0x9FAFAC46,
+  0x59496B23, 0x9273F5FA, 0xD0349A79, 0x8983E9B4, 0xDA9D9059, 0xEC9BC28C,
+  0xAA039774, 0x9FAFAC46, 0x0CEAA956, 0xD2A225FA, 0xF1C0A7D0, 0xD96C9924,
+  0xE66AC42C, 0xC7B951C0, 0xF8CFA521, 0x1934BDAA, 0x0CEAA956, 0xD2A225FA,
+  0xF1C0A7D0, 0xD96C9924, 0xE66AC42C, 0xC7B951C0, 0xF8CFA521, 0x1934BDAA,
+  0x0CEAA956, 0xD2A225FA, 0x463BAE24, 0x8909C4A8, 0x60850C34, 0xAA631EC8,
+  0xF8CFA521, 0x1934BDAA, 0x398E35A2, 0x7ED15636, 0xCE48DA0C, 0x64E78030,
+  0xE66AC42C, 0xC7B951C0, 0xF8CFA521, 0x1934BDAA, 0x50A92460, 0xB1DA92C4,
+  0x725AE73A, 0x265C06BE, 0x3C79DD6E, 0xB357D122, 0x70D393FF, 0x53205AA0,
+  0x50A92460, 0xB1DA92C4, 0x725AE73A, 0x265C06BE, 0x3C79DD6E, 0xB357D122,
+  0x70D393FF, 0x53205AA0, 0x50A92460, 0xB1DA92C4, 0x6B9285E6, 0xA990B81A,
+  0x34AF9006, 0xCF01E59A, 0x70D393FF, 0x53205AA0, 0xAD8E9B94, 0x62319A48,
+  0x355C05CE, 0x97FF4002, 0x3C79DD6E, 0xB357D122, 0x70D393FF, 0x53205AA0,
+  0x596C7D7C, 0xC3E20E20, 0x379E0C26, 0xE987DD6A, 0x1C2AC272, 0x089C2756,
+  0xC6BC8F13, 0xFA5E682C, 0x596C7D7C, 0xC3E20E20, 0x379E0C26, 0xE987DD6A,
+  0x1C2AC272, 0x089C2756, 0xC6BC8F13, 0xFA5E682C, 0x596C7D7C, 0xC3E20E20,
+  0xA60AF9E2, 0xE2ACCCB6, 0xBBB07EEA, 0x439FAACE, 0xC6BC8F13, 0xFA5E682C,
+  0xDA838148, 0x915C709C, 0xF4B36172, 0xC59FF2C6, 0x1C2AC272, 0x089C2756,
+  0xC6BC8F13, 0xFA5E682C, 0x8C660EB3, 0xC7FE270E, 0xF860112D, 0x67826B58,
+  0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46, 0x8C660EB3, 0xC7FE270E,
+  0xF860112D, 0x67826B58, 0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46,
+  0x8C660EB3, 0xC7FE270E, 0x05AFEB85, 0x546B6F8C, 0x26D37079, 0x48F195F4,
+  0xAA039774, 0x9FAFAC46, 0x59496B23, 0x9273F5FA, 0xD0349A79, 0x8983E9B4,
+  0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46, 0x0CEAA956, 0xD2A225FA,
+  0xF1C0A7D0, 0xD96C9924, 0xE66AC42C, 0xC7B951C0, 0xF8CFA521, 0x1934BDAA,
+  0x0CEAA956, 0xD2A225FA, 0xF1C0A7D0, 0xD96C9924, 0xE66AC42C, 0xC7B951C0,
+  0xF8CFA521, 0x1934BDAA, 0x0CEAA956, 0xD2A225FA, 0x463BAE24, 0x8909C4A8,
+  0x60850C34, 0xAA631EC8, 0xF8CFA521, 0x1934BDAA, 0x398E35A2, 0x7ED15636,
+  0xCE48DA0C, 0x64E78030, 0xE66AC42C, 0xC7B951C0, 0xF8CFA521, 0x1934BDAA,
+  0x845F74B4, 0xBF1C9F18, 0x129054FE, 0xAB83BC22, 0xF05B3352, 0x6A6A42F6,
+  0x87BF9523, 0xC8C5655C, 0x845F74B4, 0xBF1C9F18, 0x129054FE, 0xAB83BC22,
+  0xF05B3352, 0x6A6A42F6, 0x87BF9523, 0xC8C5655C, 0x845F74B4, 0xBF1C9F18,
+  0x442612FA, 0x4A54DE4E, 0x6263174A, 0x8E0DE36E, 0x87BF9523, 0xC8C5655C,
+  0x9A5A13C8, 0xF6B17DAC, 0xB48D19F2, 0x63656796, 0xF05B3352, 0x6A6A42F6,
+  0x87BF9523, 0xC8C5655C, 0x883E5464, 0xA53A1628, 0x166F34AE, 0xCB4D3C72,
+  0x52E8877A, 0xB0D3DCDE, 0x01B37B9B, 0x1D9799E4, 0x883E5464, 0xA53A1628,
+  0x166F34AE, 0xCB4D3C72, 0x52E8877A, 0xB0D3DCDE, 0x01B37B9B, 0x1D9799E4,
+  0x883E5464, 0xA53A1628, 0x81B421EA, 0x6A21849E, 0xB56CF652, 0x544F96F6,
+  0x01B37B9B, 0x1D9799E4, 0x11B91D10, 0x856EB884, 0x15AAACDA, 0x09AAABEE,
+  0x52E8877A, 0xB0D3DCDE, 0x01B37B9B, 0x1D9799E4, 0x8C660EB3, 0xC7FE270E,
+  0xF860112D, 0x67826B58, 0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46,
+  0x8C660EB3, 0xC7FE270E, 0xF860112D, 0x67826B58, 0xDA9D9059, 0xEC9BC28C,
+  0xAA039774, 0x9FAFAC46, 0x8C660EB3, 0xC7FE270E, 0x05AFEB85, 0x546B6F8C,
+  0x26D37079, 0x48F195F4, 0xAA039774, 0x9FAFAC46, 0x59496B23, 0x9273F5FA,
+  0xD0349A79, 0x8983E9B4, 0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46,
+  0x9E9F1FBA, 0x089E808E, 0x099504F4, 0xA822C4D8, 0x4AD16628, 0xBDD7E26C,
+  0x22F6B5BD, 0x59B76A06, 0x9E9F1FBA, 0x089E808E, 0x099504F4, 0xA822C4D8,
+  0x4AD16628, 0xBDD7E26C, 0x22F6B5BD, 0x59B76A06, 0x9E9F1FBA, 0x089E808E,
+  0x3DD4C838, 0x9508A30C, 0xFE8E6DB0, 0x040FC054, 0x22F6B5BD, 0x59B76A06,
+  0xA0DDC846, 0x6C6C893A, 0x75F62150, 0x8FBB8DF4, 0x4AD16628, 0xBDD7E26C,
+  0x22F6B5BD, 0x59B76A06, 0x555993BC, 0xE3B3ADB0, 0x338B2266, 0xB98C583A,
+  0xDC40D0C2, 0x235AB746, 0xB86528B3, 0x5F53E6A4, 0x555993BC, 0xE3B3ADB0,
+  0x338B2266, 0xB98C583A, 0xDC40D0C2, 0x235AB746, 0xB86528B3, 0x5F53E6A4,
+  0x555993BC, 0xE3B3ADB0, 0xA1F4EA22, 0xC8D26306, 0x6466AA3A, 0x6A8C6B7E,
+  0xB86528B3, 0x5F53E6A4, 0xFAE16150, 0xEC0EC1A4, 0x2B12021A, 0x440ECA0E,
+  0xDC40D0C2, 0x235AB746, 0xB86528B3, 0x5F53E6A4, 0x596C7D7C, 0xC3E20E20,
+  0x379E0C26, 0xE987DD6A, 0x1C2AC272, 0x089C2756, 0xC6BC8F13, 0xFA5E682C,
+  0x596C7D7C, 0xC3E20E20, 0x379E0C26, 0xE987DD6A, 0x1C2AC272, 0x089C2756,
+  0xC6BC8F13, 0xFA5E682C, 0x596C7D7C, 0xC3E20E20, 0xA60AF9E2, 0xE2ACCCB6,
+  0xBBB07EEA, 0x439FAACE, 0xC6BC8F13, 0xFA5E682C, 0xDA838148, 0x915C709C,
+  0xF4B36172, 0xC59FF2C6, 0x1C2AC272, 0x089C2756, 0xC6BC8F13, 0xFA5E682C,
+  0x8C660EB3, 0xC7FE270E, 0xF860112D, 0x67826B58, 0xDA9D9059, 0xEC9BC28C,
+  0xAA039774, 0x9FAFAC46, 0x8C660EB3, 0xC7FE270E, 0xF860112D, 0x67826B58,
+  0xDA9D9059, 0xEC9BC28C, 0xAA039774, 0x9FAFAC46, 0x8C660EB3, 0xC7FE270E,
+  0x05AFEB85, 0x546B6F8C, 0x26D37079, 0x48F195F4, 0xAA039774, 0x9FAFAC46,
+  0x59496B23, 0x9273F5FA, 0xD0349A79, 0x8983E9B4, 0xDA9D9059, 0xEC9BC28C,
+  0xAA039774, 0x9FAFAC46, 0xCEC898C1, 0x2AE0C08D, 0xD29CBDEC, 0xE4F58420,
+  0xA74478FD, 0x43C60A49, 0x49D57765, 0x2AB87586, 0xCEC898C1, 0x2AE0C08D,
+  0xD29CBDEC, 0xE4F58420, 0xA74478FD, 0x43C60A49, 0x49D57765, 0x2AB87586,
+  0xCEC898C1, 0x2AE0C08D, 0xACCCAA66, 0xED0D7412, 0x7A9F1A03, 0x4A626A1B,
+  0x49D57765, 0x2AB87586, 0x90F768C7, 0x75DA0CCB, 0x7AB4DDFA, 0x3D66A302,
+  0xA74478FD, 0x43C60A49, 0x49D57765, 0x2AB87586, 0x559A1D0C, 0x17E170B0,
+  0x52D99861, 0x7415C99D, 0x11C1D428, 0xCD43547C, 0x1B744A70, 0x6F16CBBF,
+  0x559A1D0C, 0x17E170B0, 0x52D99861, 0x7415C99D, 0x11C1D428, 0xCD43547C,
+  0x1B744A70, 0x6F16CBBF, 0x559A1D0C, 0x17E170B0, 0x2377388F, 0x537A93F3,
+  0x10C19EBE, 0x115D4156, 0x1B744A70, 0x6F16CBBF, 0x14A76A12, 0x81DAFE0E,
+  0x360AE243, 0xA9204EAB, 0x11C1D428, 0xCD43547C, 0x1B744A70, 0x6F16CBBF,
+  0x461B0604, 0x3D23CA70, 0xB9529C59, 0x9958235D, 0xF3A3A528, 0x424BD274,
+  0x74522390, 0x40BD5757, 0x461B0604, 0x3D23CA70, 0xB9529C59, 0x9958235D,
+  0xF3A3A528, 0x424BD274, 0x74522390, 0x40BD5757, 0x461B0604, 0x3D23CA70,
+  0x3B8362E7, 0x78BCEDB3, 0xF2A36FBE, 0x3A48BFAE, 0x74522390, 0x40BD5757,
+  0x1A2B28E2, 0x3C44FB86, 0x753AAA53, 0xD8884463, 0xF3A3A528, 0x424BD274,
+  0x74522390, 0x40BD5757, 0x74FB5EB4, 0xB9E4B10C, 0xAE83C5C9, 0xD8F2D3A9,
+  0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243, 0x74FB5EB4, 0xB9E4B10C,
+  0xAE83C5C9, 0xD8F2D3A9, 0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243,
+  0x74FB5EB4, 0xB9E4B10C, 0x5442A017, 0x0BB0730F, 0x5BD671CE, 0x9101583A,
+  0xD3F666A0, 0xDE6FB243, 0xEB97D012, 0x47B0023A, 0x0CFB4843, 0xC69EFE57,
+  0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243, 0xCEC898C1, 0x2AE0C08D,
+  0xD29CBDEC, 0xE4F58420, 0xA74478FD, 0x43C60A49, 0x49D57765, 0x2AB87586,
+  0xCEC898C1, 0x2AE0C08D, 0xD29CBDEC, 0xE4F58420, 0xA74478FD, 0x43C60A49,
+  0x49D57765, 0x2AB87586, 0xCEC898C1, 0x2AE0C08D, 0xACCCAA66, 0xED0D7412,
+  0x7A9F1A03, 0x4A626A1B, 0x49D57765, 0x2AB87586, 0x90F768C7, 0x75DA0CCB,
+  0x7AB4DDFA, 0x3D66A302, 0xA74478FD, 0x43C60A49, 0x49D57765, 0x2AB87586,
+  0x559A1D0C, 0x17E170B0, 0x52D99861, 0x7415C99D, 0x11C1D428, 0xCD43547C,
+  0x1B744A70, 0x6F16CBBF, 0x559A1D0C, 0x17E170B0, 0x52D99861, 0x7415C99D,
+  0x11C1D428, 0xCD43547C, 0x1B744A70, 0x6F16CBBF, 0x559A1D0C, 0x17E170B0,
+  0x2377388F, 0x537A93F3, 0x10C19EBE, 0x115D4156, 0x1B744A70, 0x6F16CBBF,
+  0x14A76A12, 0x81DAFE0E, 0x360AE243, 0xA9204EAB, 0x11C1D428, 0xCD43547C,
+  0x1B744A70, 0x6F16CBBF, 0x461B0604, 0x3D23CA70, 0xB9529C59, 0x9958235D,
+  0xF3A3A528, 0x424BD274, 0x74522390, 0x40BD5757, 0x461B0604, 0x3D23CA70,
+  0xB9529C59, 0x9958235D, 0xF3A3A528, 0x424BD274, 0x74522390, 0x40BD5757,
+  0x461B0604, 0x3D23CA70, 0x3B8362E7, 0x78BCEDB3, 0xF2A36FBE, 0x3A48BFAE,
+  0x74522390, 0x40BD5757, 0x1A2B28E2, 0x3C44FB86, 0x753AAA53, 0xD8884463,
+  0xF3A3A528, 0x424BD274, 0x74522390, 0x40BD5757, 0x74FB5EB4, 0xB9E4B10C,
+  0xAE83C5C9, 0xD8F2D3A9, 0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243,
+  0x74FB5EB4, 0xB9E4B10C, 0xAE83C5C9, 0xD8F2D3A9, 0x9682B078, 0x28CF8210,
+  0xD3F666A0, 0xDE6FB243, 0x74FB5EB4, 0xB9E4B10C, 0x5442A017, 0x0BB0730F,
+  0x5BD671CE, 0x9101583A, 0xD3F666A0, 0xDE6FB243, 0xEB97D012, 0x47B0023A,
+  0x0CFB4843, 0xC69EFE57, 0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243,
+  0xCEC898C1, 0x2AE0C08D, 0xD29CBDEC, 0xE4F58420, 0xA74478FD, 0x43C60A49,
+  0x49D57765, 0x2AB87586, 0xCEC898C1, 0x2AE0C08D, 0xD29CBDEC, 0xE4F58420,
+  0xA74478FD, 0x43C60A49, 0x49D57765, 0x2AB87586, 0xCEC898C1, 0x2AE0C08D,
+  0xACCCAA66, 0xED0D7412, 0x7A9F1A03, 0x4A626A1B, 0x49D57765, 0x2AB87586,
+  0x90F768C7, 0x75DA0CCB, 0x7AB4DDFA, 0x3D66A302, 0xA74478FD, 0x43C60A49,
+  0x49D57765, 0x2AB87586, 0xA0274C0E, 0xA633F652, 0x86F70157, 0x424A6EA3,
+  0xB3C49A3A, 0xCB402A7E, 0x7D21D022, 0x38027899, 0xA0274C0E, 0xA633F652,
+  0x86F70157, 0x424A6EA3, 0xB3C49A3A, 0xCB402A7E, 0x7D21D022, 0x38027899,
+  0xA0274C0E, 0xA633F652, 0xB4F91609, 0x62E5A44D, 0x02BA28F4, 0x83793E84,
+  0x7D21D022, 0x38027899, 0x0A3BBE38, 0x89A68324, 0xE0F54925, 0xF43DF045,
+  0xB3C49A3A, 0xCB402A7E, 0x7D21D022, 0x38027899, 0x1A3C6322, 0x23867E52,
+  0x61DF97EB, 0xBF9CF6A3, 0x76ED0366, 0xA2C99326, 0xD206729E, 0x836A1BE1,
+  0x1A3C6322, 0x23867E52, 0x61DF97EB, 0xBF9CF6A3, 0x76ED0366, 0xA2C99326,
+  0xD206729E, 0x836A1BE1, 0x1A3C6322, 0x23867E52, 0x5DF114FD, 0xE0382C4D,
+  0x08C18D30, 0x3134F3CC, 0xD206729E, 0x836A1BE1, 0x31D51C64, 0xBAA8D3BC,
+  0x4AB989B1, 0x7CF75D7D, 0x76ED0366, 0xA2C99326, 0xD206729E, 0x836A1BE1,
+  0x74FB5EB4, 0xB9E4B10C, 0xAE83C5C9, 0xD8F2D3A9, 0x9682B078, 0x28CF8210,
+  0xD3F666A0, 0xDE6FB243, 0x74FB5EB4, 0xB9E4B10C, 0xAE83C5C9, 0xD8F2D3A9,
+  0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243, 0x74FB5EB4, 0xB9E4B10C,
+  0x5442A017, 0x0BB0730F, 0x5BD671CE, 0x9101583A, 0xD3F666A0, 0xDE6FB243,
+  0xEB97D012, 0x47B0023A, 0x0CFB4843, 0xC69EFE57, 0x9682B078, 0x28CF8210,
+  0xD3F666A0, 0xDE6FB243, 0x0DA79BC5, 0xE2409535, 0xA15F3DD0, 0xE817DEA8,
+  0x3EE782C9, 0xA42D2939, 0x2B34CA71, 0x8D82258E, 0x0DA79BC5, 0xE2409535,
+  0xA15F3DD0, 0xE817DEA8, 0x3EE782C9, 0xA42D2939, 0x2B34CA71, 0x8D82258E,
+  0x0DA79BC5, 0xE2409535, 0x71DDE60A, 0x8253069A, 0x3C465BCF, 0x5AFC644B,
+  0x2B34CA71, 0x8D82258E, 0x042CE7BB, 0x9F68EA63, 0x77F6B6DE, 0x5A2BD37A,
+  0x3EE782C9, 0xA42D2939, 0x2B34CA71, 0x8D82258E, 0x4C170360, 0xE8911C2C,
+  0xF3223115, 0x33DE4FC9, 0xD8E63344, 0x196D4B20, 0xD433814C, 0x67736403,
+  0x4C170360, 0xE8911C2C, 0xF3223115, 0x33DE4FC9, 0xD8E63344, 0x196D4B20,
+  0xD433814C, 0x67736403, 0x4C170360, 0xE8911C2C, 0x33664B63, 0x4F3F322F,
+  0xC39FD3CA, 0xD16C460A, 0xD433814C, 0x67736403, 0x63B44F06, 0xF9F50B3A,
+  0xF5EE9677, 0x78E40757, 0xD8E63344, 0x196D4B20, 0xD433814C, 0x67736403,
+  0x461B0604, 0x3D23CA70, 0xB9529C59, 0x9958235D, 0xF3A3A528, 0x424BD274,
+  0x74522390, 0x40BD5757, 0x461B0604, 0x3D23CA70, 0xB9529C59, 0x9958235D,
+  0xF3A3A528, 0x424BD274, 0x74522390, 0x40BD5757, 0x461B0604, 0x3D23CA70,
+  0x3B8362E7, 0x78BCEDB3, 0xF2A36FBE, 0x3A48BFAE, 0x74522390, 0x40BD5757,
+  0x1A2B28E2, 0x3C44FB86, 0x753AAA53, 0xD8884463, 0xF3A3A528, 0x424BD274,
+  0x74522390, 0x40BD5757, 0x74FB5EB4, 0xB9E4B10C, 0xAE83C5C9, 0xD8F2D3A9,
+  0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243, 0x74FB5EB4, 0xB9E4B10C,
+  0xAE83C5C9, 0xD8F2D3A9, 0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243,
+  0x74FB5EB4, 0xB9E4B10C, 0x5442A017, 0x0BB0730F, 0x5BD671CE, 0x9101583A,
+  0xD3F666A0, 0xDE6FB243, 0xEB97D012, 0x47B0023A, 0x0CFB4843, 0xC69EFE57,
+  0x9682B078, 0x28CF8210, 0xD3F666A0, 0xDE6FB243, 0xA5EC2083, 0x406D93EB,
+  0xC191832D, 0x53D51D51, 0x093C088B, 0x66F3658A, 0x93CC1D62, 0xB006A500,
+  0x96058734, 0x68164AC2, 0xFBA12417, 0xF8BD1ECF, 0x92EEE531, 0x4FDFE309,
+  0x55F9AA6F, 0x4BAFE945, 0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A,
+  0xA5EC2083, 0x406D93EB, 0xC191832D, 0x53D51D51, 0x093C088B, 0x66F3658A,
+  0x93CC1D62, 0xB006A500, 0x96058734, 0x68164AC2, 0xFBA12417, 0xF8BD1ECF,
+  0x92EEE531, 0x4FDFE309, 0x55F9AA6F, 0x4BAFE945, 0x549C295B, 0xD90B7C41,
+  0xF346C99F, 0xC6E9DA9A, 0xA5EC2083, 0x406D93EB, 0xC191832D, 0x53D51D51,
+  0x093C088B, 0x9C87412C, 0xE60062A4, 0xD098A8CE, 0x441DD8D2, 0xD79A71E4,
+  0xBB283EC9, 0xC9681B81, 0xC243E87F, 0xA85B7E97, 0x72A38521, 0x4BAFE945,
+  0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A, 0xC07FFF41, 0xB9B78BDD,
+  0x2E07FF0B, 0x1E9793EB, 0xDD35B55D, 0x6EC04EFC, 0xA5547B98, 0x6BC575DA,
+  0xEA13A7DA, 0xB3DAF4B8, 0xFBA12417, 0xF8BD1ECF, 0x92EEE531, 0x4FDFE309,
+  0x55F9AA6F, 0x4BAFE945, 0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A,
+  0x3CE139F6, 0x9BD21E36, 0x4475CEC4, 0x64E97C08, 0x500FCC32, 0xA2B0BA6F,
+  0xB11897DF, 0xE48B2B61, 0xBA51E855, 0xDD66D67B, 0x874C6F82, 0xD0365822,
+  0x73A1EAB8, 0xB9C37C00, 0xCE099366, 0xD854DB00, 0xFEA3C906, 0xD6402920,
+  0x35F81876, 0xE1E231E3, 0x3CE139F6, 0x9BD21E36, 0x4475CEC4, 0x64E97C08,
+  0x500FCC32, 0xA2B0BA6F, 0xB11897DF, 0xE48B2B61, 0xBA51E855, 0xDD66D67B,
+  0x874C6F82, 0xD0365822, 0x73A1EAB8, 0xB9C37C00, 0xCE099366, 0xD854DB00,
+  0xFEA3C906, 0xD6402920, 0x35F81876, 0xE1E231E3, 0x3CE139F6, 0x9BD21E36,
+  0x4475CEC4, 0x64E97C08, 0x500FCC32, 0x4DD5A0C5, 0x21E4D2B5, 0x3625BA0B,
+  0x53B082DF, 0xA10FAD11, 0xBFD010DC, 0xE4FF0C3C, 0xA0217E6E, 0xC3810076,
+  0xB37FF4F0, 0xD854DB00, 0xFEA3C906, 0xD6402920, 0x35F81876, 0xE1E231E3,
+  0xED77DBD4, 0x77703CF8, 0x31A3EC6A, 0x5DB91E0A, 0xCB96300C, 0x564D4E1D,
+  0xABCB4391, 0x8B88CCA7, 0x5229C867, 0xD2D58205, 0x874C6F82, 0xD0365822,
+  0x73A1EAB8, 0xB9C37C00, 0xCE099366, 0xD854DB00, 0xFEA3C906, 0xD6402920,
+  0x35F81876, 0xE1E231E3, 0x960DBACE, 0xF883FAF6, 0xA2DFA778, 0x4B851B1C,
+  0xDB94DB9A, 0x79ABF547, 0x0DCA749F, 0xF5627365, 0x53C6D479, 0x78324563,
+  0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4, 0x2B92A50E, 0xA0CBEA40,
+  0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733, 0x960DBACE, 0xF883FAF6,
+  0xA2DFA778, 0x4B851B1C, 0xDB94DB9A, 0x79ABF547, 0x0DCA749F, 0xF5627365,
+  0x53C6D479, 0x78324563, 0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4,
+  0x2B92A50E, 0xA0CBEA40, 0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733,
+  0x960DBACE, 0xF883FAF6, 0xA2DFA778, 0x4B851B1C, 0xDB94DB9A, 0xD1BF6D7D,
+  0x52579E75, 0xD5A224CF, 0xA0595643, 0x710FD319, 0xFB9AB1D4, 0x6674AE9C,
+  0xACBC5232, 0xE6B68E2A, 0xEC691E98, 0xA0CBEA40, 0xC209237E, 0xAE99677C,
+  0x265791AA, 0xCB932733, 0x038CB56C, 0x3328EAB0, 0x37BB019E, 0x2FED3E0E,
+  0x78B5510C, 0x9CF183B5, 0x8688F7E9, 0xA398ADCB, 0x2D82F4FB, 0x7FF4A305,
+  0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4, 0x2B92A50E, 0xA0CBEA40,
+  0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733, 0x16156EA5, 0x1BA54FA8,
+  0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x76668668, 0xA912EC55, 0xB48EC2FD,
+  0xD4590E9C, 0xBC67CB37, 0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01,
+  0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3,
+  0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x76668668,
+  0xA912EC55, 0xB48EC2FD, 0xD4590E9C, 0xBC67CB37, 0x5E189D09, 0x9D905EBC,
+  0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420,
+  0x5F3AE473, 0x5FA632D3, 0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879,
+  0xB7A2648E, 0x6DDB27D6, 0x4E67CCFF, 0xF9ED3747, 0x3273379A, 0x5745368D,
+  0xCAD09357, 0x88C484A2, 0xDC4F4DE2, 0x5E191E4F, 0xAFAFD81C, 0xE0DFAF93,
+  0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3, 0xC4835567, 0x4D8F1886,
+  0x9EBB55CE, 0xADDB5DB3, 0x311346A8, 0x6F28C386, 0xF61BBFB3, 0x44450B3B,
+  0x92AA0D02, 0xE035BCC1, 0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01,
+  0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3,
+  0xA5EC2083, 0x406D93EB, 0xC191832D, 0x53D51D51, 0x093C088B, 0x66F3658A,
+  0x93CC1D62, 0xB006A500, 0x96058734, 0x68164AC2, 0xFBA12417, 0xF8BD1ECF,
+  0x92EEE531, 0x4FDFE309, 0x55F9AA6F, 0x4BAFE945, 0x549C295B, 0xD90B7C41,
+  0xF346C99F, 0xC6E9DA9A, 0xA5EC2083, 0x406D93EB, 0xC191832D, 0x53D51D51,
+  0x093C088B, 0x66F3658A, 0x93CC1D62, 0xB006A500, 0x96058734, 0x68164AC2,
+  0xFBA12417, 0xF8BD1ECF, 0x92EEE531, 0x4FDFE309, 0x55F9AA6F, 0x4BAFE945,
+  0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A, 0xA5EC2083, 0x406D93EB,
+  0xC191832D, 0x53D51D51, 0x093C088B, 0x9C87412C, 0xE60062A4, 0xD098A8CE,
+  0x441DD8D2, 0xD79A71E4, 0xBB283EC9, 0xC9681B81, 0xC243E87F, 0xA85B7E97,
+  0x72A38521, 0x4BAFE945, 0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A,
+  0xC07FFF41, 0xB9B78BDD, 0x2E07FF0B, 0x1E9793EB, 0xDD35B55D, 0x6EC04EFC,
+  0xA5547B98, 0x6BC575DA, 0xEA13A7DA, 0xB3DAF4B8, 0xFBA12417, 0xF8BD1ECF,
+  0x92EEE531, 0x4FDFE309, 0x55F9AA6F, 0x4BAFE945, 0x549C295B, 0xD90B7C41,
+  0xF346C99F, 0xC6E9DA9A, 0x3CE139F6, 0x9BD21E36, 0x4475CEC4, 0x64E97C08,
+  0x500FCC32, 0xA2B0BA6F, 0xB11897DF, 0xE48B2B61, 0xBA51E855, 0xDD66D67B,
+  0x874C6F82, 0xD0365822, 0x73A1EAB8, 0xB9C37C00, 0xCE099366, 0xD854DB00,
+  0xFEA3C906, 0xD6402920, 0x35F81876, 0xE1E231E3, 0x3CE139F6, 0x9BD21E36,
+  0x4475CEC4, 0x64E97C08, 0x500FCC32, 0xA2B0BA6F, 0xB11897DF, 0xE48B2B61,
+  0xBA51E855, 0xDD66D67B, 0x874C6F82, 0xD0365822, 0x73A1EAB8, 0xB9C37C00,
+  0xCE099366, 0xD854DB00, 0xFEA3C906, 0xD6402920, 0x35F81876, 0xE1E231E3,
+  0x3CE139F6, 0x9BD21E36, 0x4475CEC4, 0x64E97C08, 0x500FCC32, 0x4DD5A0C5,
+  0x21E4D2B5, 0x3625BA0B, 0x53B082DF, 0xA10FAD11, 0xBFD010DC, 0xE4FF0C3C,
+  0xA0217E6E, 0xC3810076, 0xB37FF4F0, 0xD854DB00, 0xFEA3C906, 0xD6402920,
+  0x35F81876, 0xE1E231E3, 0xED77DBD4, 0x77703CF8, 0x31A3EC6A, 0x5DB91E0A,
+  0xCB96300C, 0x564D4E1D, 0xABCB4391, 0x8B88CCA7, 0x5229C867, 0xD2D58205,
+  0x874C6F82, 0xD0365822, 0x73A1EAB8, 0xB9C37C00, 0xCE099366, 0xD854DB00,
+  0xFEA3C906, 0xD6402920, 0x35F81876, 0xE1E231E3, 0x960DBACE, 0xF883FAF6,
+  0xA2DFA778, 0x4B851B1C, 0xDB94DB9A, 0x79ABF547, 0x0DCA749F, 0xF5627365,
+  0x53C6D479, 0x78324563, 0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4,
+  0x2B92A50E, 0xA0CBEA40, 0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733,
+  0x960DBACE, 0xF883FAF6, 0xA2DFA778, 0x4B851B1C, 0xDB94DB9A, 0x79ABF547,
+  0x0DCA749F, 0xF5627365, 0x53C6D479, 0x78324563, 0x5211CC7A, 0x6908B782,
+  0x87D8FD0C, 0x37A9ECA4, 0x2B92A50E, 0xA0CBEA40, 0xC209237E, 0xAE99677C,
+  0x265791AA, 0xCB932733, 0x960DBACE, 0xF883FAF6, 0xA2DFA778, 0x4B851B1C,
+  0xDB94DB9A, 0xD1BF6D7D, 0x52579E75, 0xD5A224CF, 0xA0595643, 0x710FD319,
+  0xFB9AB1D4, 0x6674AE9C, 0xACBC5232, 0xE6B68E2A, 0xEC691E98, 0xA0CBEA40,
+  0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733, 0x038CB56C, 0x3328EAB0,
+  0x37BB019E, 0x2FED3E0E, 0x78B5510C, 0x9CF183B5, 0x8688F7E9, 0xA398ADCB,
+  0x2D82F4FB, 0x7FF4A305, 0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4,
+  0x2B92A50E, 0xA0CBEA40, 0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733,
+  0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x76668668,
+  0xA912EC55, 0xB48EC2FD, 0xD4590E9C, 0xBC67CB37, 0x5E189D09, 0x9D905EBC,
+  0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420,
+  0x5F3AE473, 0x5FA632D3, 0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879,
+  0xB7A2648E, 0x76668668, 0xA912EC55, 0xB48EC2FD, 0xD4590E9C, 0xBC67CB37,
+  0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93,
+  0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3, 0x16156EA5, 0x1BA54FA8,
+  0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x6DDB27D6, 0x4E67CCFF, 0xF9ED3747,
+  0x3273379A, 0x5745368D, 0xCAD09357, 0x88C484A2, 0xDC4F4DE2, 0x5E191E4F,
+  0xAFAFD81C, 0xE0DFAF93, 0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3,
+  0xC4835567, 0x4D8F1886, 0x9EBB55CE, 0xADDB5DB3, 0x311346A8, 0x6F28C386,
+  0xF61BBFB3, 0x44450B3B, 0x92AA0D02, 0xE035BCC1, 0x5E189D09, 0x9D905EBC,
+  0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420,
+  0x5F3AE473, 0x5FA632D3, 0xA5EC2083, 0x406D93EB, 0xC191832D, 0x53D51D51,
+  0x093C088B, 0x66F3658A, 0x93CC1D62, 0xB006A500, 0x96058734, 0x68164AC2,
+  0xFBA12417, 0xF8BD1ECF, 0x92EEE531, 0x4FDFE309, 0x55F9AA6F, 0x4BAFE945,
+  0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A, 0xA5EC2083, 0x406D93EB,
+  0xC191832D, 0x53D51D51, 0x093C088B, 0x66F3658A, 0x93CC1D62, 0xB006A500,
+  0x96058734, 0x68164AC2, 0xFBA12417, 0xF8BD1ECF, 0x92EEE531, 0x4FDFE309,
+  0x55F9AA6F, 0x4BAFE945, 0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A,
+  0xA5EC2083, 0x406D93EB, 0xC191832D, 0x53D51D51, 0x093C088B, 0x9C87412C,
+  0xE60062A4, 0xD098A8CE, 0x441DD8D2, 0xD79A71E4, 0xBB283EC9, 0xC9681B81,
+  0xC243E87F, 0xA85B7E97, 0x72A38521, 0x4BAFE945, 0x549C295B, 0xD90B7C41,
+  0xF346C99F, 0xC6E9DA9A, 0xC07FFF41, 0xB9B78BDD, 0x2E07FF0B, 0x1E9793EB,
+  0xDD35B55D, 0x6EC04EFC, 0xA5547B98, 0x6BC575DA, 0xEA13A7DA, 0xB3DAF4B8,
+  0xFBA12417, 0xF8BD1ECF, 0x92EEE531, 0x4FDFE309, 0x55F9AA6F, 0x4BAFE945,
+  0x549C295B, 0xD90B7C41, 0xF346C99F, 0xC6E9DA9A, 0xF0C64ECC, 0x0AA9C368,
+  0x02C66252, 0x3D5AA506, 0x230D5128, 0x5E52BCB9, 0x98176015, 0xB078535B,
+  0x04BCFCAF, 0xDB1B8E35, 0x2541F050, 0xF0CD8A2C, 0x377063FE, 0x640140BE,
+  0x628616F4, 0xCE5B1B8E, 0x254E6D84, 0xFE5CC8C2, 0x04C5F258, 0x4BB7A389,
+  0xF0C64ECC, 0x0AA9C368, 0x02C66252, 0x3D5AA506, 0x230D5128, 0x5E52BCB9,
+  0x98176015, 0xB078535B, 0x04BCFCAF, 0xDB1B8E35, 0x2541F050, 0xF0CD8A2C,
+  0x377063FE, 0x640140BE, 0x628616F4, 0xCE5B1B8E, 0x254E6D84, 0xFE5CC8C2,
+  0x04C5F258, 0x4BB7A389, 0xF0C64ECC, 0x0AA9C368, 0x02C66252, 0x3D5AA506,
+  0x230D5128, 0x7B4FF2A3, 0x3D6C40BF, 0x3A140F71, 0x1B8E1765, 0x75F2EC3F,
+  0xE60AC146, 0x2BCED4D2, 0xE762BC88, 0x25CEE5C8, 0x7ECB0B3A, 0xCE5B1B8E,
+  0x254E6D84, 0xFE5CC8C2, 0x04C5F258, 0x4BB7A389, 0xA238D95E, 0x624F2086,
+  0xD8A812CC, 0x20005254, 0xDD07837E, 0x189E6AFB, 0x0ADBC7B3, 0x41DB1D45,
+  0xF5FF65ED, 0x8220F82B, 0x2541F050, 0xF0CD8A2C, 0x377063FE, 0x640140BE,
+  0x628616F4, 0xCE5B1B8E, 0x254E6D84, 0xFE5CC8C2, 0x04C5F258, 0x4BB7A389,
+  0x4D0C58D4, 0x94FC8F3C, 0x82A8FFFA, 0x22386322, 0xAA116B20, 0xF1F925C1,
+  0x4DE4BCD9, 0xD91F4203, 0x3FC1348B, 0x4257F66D, 0xE33BEFD8, 0x316639C0,
+  0xAB2ADAB6, 0x2330F6CA, 0x87B6A3FC, 0xC149AD56, 0x4176B9E8, 0x9EB4CEAA,
+  0x03FD809C, 0x99F45DE1, 0x4D0C58D4, 0x94FC8F3C, 0x82A8FFFA, 0x22386322,
+  0xAA116B20, 0xF1F925C1, 0x4DE4BCD9, 0xD91F4203, 0x3FC1348B, 0x4257F66D,
+  0xE33BEFD8, 0x316639C0, 0xAB2ADAB6, 0x2330F6CA, 0x87B6A3FC, 0xC149AD56,
+  0x4176B9E8, 0x9EB4CEAA, 0x03FD809C, 0x99F45DE1, 0x4D0C58D4, 0x94FC8F3C,
+  0x82A8FFFA, 0x22386322, 0xAA116B20, 0xC317D18B, 0xFBDCB123, 0x29E88639,
+  0x009807E1, 0x91596F97, 0x854AC24E, 0x3D724FB6, 0x9F1EC4C0, 0x74245544,
+  0x7DA0CE82, 0xC149AD56, 0x4176B9E8, 0x9EB4CEAA, 0x03FD809C, 0x99F45DE1,
+  0xDEF079A6, 0xA4C8EB42, 0xB4F0E184, 0x1668C2B0, 0x0BB04CBE, 0xEE79D443,
+  0x1CDE3B9F, 0xAA9A5C7D, 0xC9A931E9, 0x848DD66B, 0xE33BEFD8, 0x316639C0,
+  0xAB2ADAB6, 0x2330F6CA, 0x87B6A3FC, 0xC149AD56, 0x4176B9E8, 0x9EB4CEAA,
+  0x03FD809C, 0x99F45DE1, 0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879,
+  0xB7A2648E, 0x76668668, 0xA912EC55, 0xB48EC2FD, 0xD4590E9C, 0xBC67CB37,
+  0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93,
+  0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3, 0x16156EA5, 0x1BA54FA8,
+  0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x76668668, 0xA912EC55, 0xB48EC2FD,
+  0xD4590E9C, 0xBC67CB37, 0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01,
+  0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3,
+  0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x6DDB27D6,
+  0x4E67CCFF, 0xF9ED3747, 0x3273379A, 0x5745368D, 0xCAD09357, 0x88C484A2,
+  0xDC4F4DE2, 0x5E191E4F, 0xAFAFD81C, 0xE0DFAF93, 0xA74768D8, 0xC1739420,
+  0x5F3AE473, 0x5FA632D3, 0xC4835567, 0x4D8F1886, 0x9EBB55CE, 0xADDB5DB3,
+  0x311346A8, 0x6F28C386, 0xF61BBFB3, 0x44450B3B, 0x92AA0D02, 0xE035BCC1,
+  0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93,
+  0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3, 0x03B9C9CB, 0x1C1EF9E7,
+  0x26ED6D45, 0xACC0F9D5, 0x19D12D3B, 0x08D5DD12, 0x51DBCEBE, 0xD2183958,
+  0x5644ED08, 0x8D8A9D72, 0x07DDA0E7, 0xA1B91C6B, 0x211B57F9, 0x5B4AE2B5,
+  0x4EE4D7EF, 0x34F58489, 0x5C5EDAE3, 0xA7A9F575, 0x8157228F, 0x13CA8B9E,
+  0x03B9C9CB, 0x1C1EF9E7, 0x26ED6D45, 0xACC0F9D5, 0x19D12D3B, 0x08D5DD12,
+  0x51DBCEBE, 0xD2183958, 0x5644ED08, 0x8D8A9D72, 0x07DDA0E7, 0xA1B91C6B,
+  0x211B57F9, 0x5B4AE2B5, 0x4EE4D7EF, 0x34F58489, 0x5C5EDAE3, 0xA7A9F575,
+  0x8157228F, 0x13CA8B9E, 0x03B9C9CB, 0x1C1EF9E7, 0x26ED6D45, 0xACC0F9D5,
+  0x19D12D3B, 0x3B0F0094, 0x314CF0F0, 0x35D70FC6, 0x6386B876, 0x146EA794,
+  0xEAF2CF59, 0x4FFE904D, 0x55B3DEC7, 0x6AF86593, 0x6B8B8CA1, 0x34F58489,
+  0x5C5EDAE3, 0xA7A9F575, 0x8157228F, 0x13CA8B9E, 0xDB630721, 0xF5514E91,
+  0x6FC1B083, 0xEAB70C97, 0x6DFF8B35, 0x73823B5C, 0x5AC014DC, 0x69A78C32,
+  0x40A01B46, 0x44E92D30, 0x07DDA0E7, 0xA1B91C6B, 0x211B57F9, 0x5B4AE2B5,
+  0x4EE4D7EF, 0x34F58489, 0x5C5EDAE3, 0xA7A9F575, 0x8157228F, 0x13CA8B9E,
+  0xE7DCB022, 0x6182E982, 0x6F4582E4, 0x079385F0, 0x4451A276, 0x34DD039B,
+  0x24172E8B, 0x3B99F081, 0x3EB1A57D, 0x78270E5F, 0xF33D1E36, 0xDA93655E,
+  0x8FC2F1D8, 0x5D0FE030, 0x8F00FE8A, 0x807FB188, 0xA1DDD48E, 0x91A0C04C,
+  0xDBACA792, 0xDA7E9C73, 0xE7DCB022, 0x6182E982, 0x6F4582E4, 0x079385F0,
+  0x4451A276, 0x34DD039B, 0x24172E8B, 0x3B99F081, 0x3EB1A57D, 0x78270E5F,
+  0xF33D1E36, 0xDA93655E, 0x8FC2F1D8, 0x5D0FE030, 0x8F00FE8A, 0x807FB188,
+  0xA1DDD48E, 0x91A0C04C, 0xDBACA792, 0xDA7E9C73, 0xE7DCB022, 0x6182E982,
+  0x6F4582E4, 0x079385F0, 0x4451A276, 0x3EF17C91, 0xD27C9FE1, 0x771689AB,
+  0xBEDA3C67, 0xDC140ED5, 0x0EE63980, 0x894A1C68, 0xA760318E, 0x021DEBE6,
+  0x0CCDCA04, 0x807FB188, 0xA1DDD48E, 0x91A0C04C, 0xDBACA792, 0xDA7E9C73,
+  0x797C0BF8, 0x5F67C9AC, 0x00E72FFA, 0xC9920F7A, 0x1626E188, 0x7FB09FA1,
+  0xC75F32A5, 0xAA9934F7, 0xE18DA797, 0xC40DB621, 0xF33D1E36, 0xDA93655E,
+  0x8FC2F1D8, 0x5D0FE030, 0x8F00FE8A, 0x807FB188, 0xA1DDD48E, 0x91A0C04C,
+  0xDBACA792, 0xDA7E9C73, 0x960DBACE, 0xF883FAF6, 0xA2DFA778, 0x4B851B1C,
+  0xDB94DB9A, 0x79ABF547, 0x0DCA749F, 0xF5627365, 0x53C6D479, 0x78324563,
+  0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4, 0x2B92A50E, 0xA0CBEA40,
+  0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733, 0x960DBACE, 0xF883FAF6,
+  0xA2DFA778, 0x4B851B1C, 0xDB94DB9A, 0x79ABF547, 0x0DCA749F, 0xF5627365,
+  0x53C6D479, 0x78324563, 0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4,
+  0x2B92A50E, 0xA0CBEA40, 0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733,
+  0x960DBACE, 0xF883FAF6, 0xA2DFA778, 0x4B851B1C, 0xDB94DB9A, 0xD1BF6D7D,
+  0x52579E75, 0xD5A224CF, 0xA0595643, 0x710FD319, 0xFB9AB1D4, 0x6674AE9C,
+  0xACBC5232, 0xE6B68E2A, 0xEC691E98, 0xA0CBEA40, 0xC209237E, 0xAE99677C,
+  0x265791AA, 0xCB932733, 0x038CB56C, 0x3328EAB0, 0x37BB019E, 0x2FED3E0E,
+  0x78B5510C, 0x9CF183B5, 0x8688F7E9, 0xA398ADCB, 0x2D82F4FB, 0x7FF4A305,
+  0x5211CC7A, 0x6908B782, 0x87D8FD0C, 0x37A9ECA4, 0x2B92A50E, 0xA0CBEA40,
+  0xC209237E, 0xAE99677C, 0x265791AA, 0xCB932733, 0x16156EA5, 0x1BA54FA8,
+  0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x76668668, 0xA912EC55, 0xB48EC2FD,
+  0xD4590E9C, 0xBC67CB37, 0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01,
+  0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3,
+  0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879, 0xB7A2648E, 0x76668668,
+  0xA912EC55, 0xB48EC2FD, 0xD4590E9C, 0xBC67CB37, 0x5E189D09, 0x9D905EBC,
+  0xF11801FC, 0x5CC26B01, 0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420,
+  0x5F3AE473, 0x5FA632D3, 0x16156EA5, 0x1BA54FA8, 0xA4178550, 0xDDAE6879,
+  0xB7A2648E, 0x6DDB27D6, 0x4E67CCFF, 0xF9ED3747, 0x3273379A, 0x5745368D,
+  0xCAD09357, 0x88C484A2, 0xDC4F4DE2, 0x5E191E4F, 0xAFAFD81C, 0xE0DFAF93,
+  0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3, 0xC4835567, 0x4D8F1886,
+  0x9EBB55CE, 0xADDB5DB3, 0x311346A8, 0x6F28C386, 0xF61BBFB3, 0x44450B3B,
+  0x92AA0D02, 0xE035BCC1, 0x5E189D09, 0x9D905EBC, 0xF11801FC, 0x5CC26B01,
+  0xA596DCA2, 0xE0DFAF93, 0xA74768D8, 0xC1739420, 0x5F3AE473, 0x5FA632D3
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kSlipSignatures [] = {
+  0x9725B34A, 0x9725B34A, 0x9725B34A, 0x11736ED8, 0x11736ED8, 0x11736ED8,
+  0x9725B34A, 0x9725B34A, 0x9725B34A, 0x11736ED8, 0x11736ED8, 0x11736ED8
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kDiagSignatures [] = {
+  0xC67159D2, 0x54162800, 0x3397EEDA, 0x3C1E2B52, 0x6AA8A840, 0x2F5B1D5A,
+  0xC67159D2, 0x54162800, 0x3397EEDA, 0x3C1E2B52, 0x6AA8A840, 0x2F5B1D5A
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kArrowSignatures [] = {
+  0xDA24A798, 0x4A521AB8
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kBufferSignatures [] = {
+  0xFD6C5572, 0x0FCCAD62
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kDecouplerSignatures [] = {
+  0x82E42FD4, 0x7E7222B9, 0x1AB78B18, 0x4387E755
+} ;
+
+//-----------------------------------------------------------------------------
+static const uint32_t kSignalSignatures [] = {
+  0x4C77B229, 0x0C4E5D82, 0x7A533A4C, 0x4554EED1, 0xD0B59A44, 0x918395F2
+} ;
+
+//-----------------------------------------------------------------------------
+const TTGoldenSet kTTGoldenSets [kTTNumberOfTileKinds] = {
+  { kViewSignatures, sizeof (kViewSignatures) / sizeof (uint32_t) }, // kTTViewKind
+  { NULL, 0 }, // kTTTrackKind
+  { kBlockSignatures, sizeof (kBlockSignatures) / sizeof (uint32_t) }, // kTTBlockKind
+  { kPointSignatures, sizeof (kPointSignatures) / sizeof (uint32_t) }, // kTTPointKind
+  { kDoublePointSignatures, sizeof (kDoublePointSignatures) / sizeof (uint32_t) }, // kTTDoublePointKind
+  { kSlipSignatures, sizeof (kSlipSignatures) / sizeof (uint32_t) }, // kTTSlipKind
+  { kDiagSignatures, sizeof (kDiagSignatures) / sizeof (uint32_t) }, // kTTDiagKind
+  { kArrowSignatures, sizeof (kArrowSignatures) / sizeof (uint32_t) }, // kTTArrowKind
+  { kBufferSignatures, sizeof (kBufferSignatures) / sizeof (uint32_t) }, // kTTBufferKind
+  { kDecouplerSignatures, sizeof (kDecouplerSignatures) / sizeof (uint32_t) }, // kTTDecouplerKind
+  { kSignalSignatures, sizeof (kSignalSignatures) / sizeof (uint32_t) }  // kTTSignalKind
+} ;
+
+//-----------------------------------------------------------------------------
+// Primitives: maximum over the variants of the class (TRACK_TAG defined,
+// DEBUG_TRACK and TRACK_GRID undefined), any extra primitive is reported.
+// Time: fastest of the timed runs of a sample, in thousandths of the
+// calibration run. Four times the maximum over five runs of the harness on
+// the x86-64 host build (-O1). A class drawn in less than a microsecond
+// gets 0, it is only given the slack of the harness for the resolution of
+// micros ().
+const TTRenderBudget kTTRenderBudgets [kTTNumberOfTileKinds] = {
+  {    2,    0 }, // kTTViewKind
+  {    0,    0 }, // kTTTrackKind
+  {   29,  120 }, // kTTBlockKind
+  {   57,  472 }, // kTTPointKind
+  {   77, 1060 }, // kTTDoublePointKind
+  {   57,  708 }, // kTTSlipKind
+  {   81,  124 }, // kTTDiagKind
+  {   13,    0 }, // kTTArrowKind
+  {    2,    0 }, // kTTBufferKind
+  {    6,  236 }, // kTTDecouplerKind
+  {    5,    0 }  // kTTSignalKind
+} ;
+
+#endif
@@ -0,0 +1,156 @@
+//
+//  TTIngress.cpp
+//  CocoaSimulator
+//
+
+#include "TTIngress.h"
+
+#ifdef __AVR__
+  #include <util/atomic.h>
+#endif
+
+//=============================================================================
+TTIngress::Change TTIngress::sChanges [TT_INGRESS_SIZE] ;
+TTIngressIndex TTIngress::sHead (0) ;
+TTIngressIndex TTIngress::sTail (0) ;
+TTIngressCounter TTIngress::sDroppedCount (0) ;
+uint8_t TTIngress::sMaxPendingCount = 0 ;
+
+//-----------------------------------------------------------------------------
+// Index written by the other side: the change it covers is read after it.
+// On AVR one core runs both sides, keeping the compiler from moving the
+// accesses to the ring across the index is enough
+static inline uint8_t acquireIndex (TTIngressIndex & inIndex)
+{
+#ifdef __AVR__
+  const uint8_t value = inIndex ;
+  __asm__ __volatile__ ("" ::: "memory") ;
+  return value ;
+#else
+  return inIndex.load (std::memory_order_acquire) ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Index read by the other side: the change it covers is written before it
+static inline void releaseIndex (TTIngressIndex & ioIndex, const uint8_t inValue)
+{
+#ifdef __AVR__
+  __asm__ __volatile__ ("" ::: "memory") ;
+  ioIndex = inValue ;
+#else
+  ioIndex.store (inValue, std::memory_order_release) ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Index written by this side only
+static inline uint8_t ownIndex (TTIngressIndex & inIndex)
+{
+#ifdef __AVR__
+  return inIndex ;
+#else
+  return inIndex.load (std::memory_order_relaxed) ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+bool TTIngress::post (const TTIngressKind inKind,
+                      const uint8_t inIdentifier,
+                      const uint8_t inValue)
+{
+  const uint8_t head = ownIndex (sHead) ;
+  const uint8_t tail = acquireIndex (sTail) ;
+  if ((uint8_t)(head - tail) >= TT_INGRESS_SIZE) {
+    sDroppedCount++ ;
+    return false ;
+  }
+  else {
+    Change & change = sChanges [head & kMask] ;
+    change.kind = inKind ;
+    change.identifier = inIdentifier ;
+    change.value = inValue ;
+    releaseIndex (sHead, head + 1) ;
+    return true ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTIngress::postActualPosition (const uint8_t inPointId, const TTPointPosition inPosition)
+{
+  return post (kTTIngressActualPosition, inPointId, inPosition) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTIngress::postWishedPosition (const uint8_t inPointId, const TTPointPosition inPosition)
+{
+  return post (kTTIngressWishedPosition, inPointId, inPosition) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTIngress::postDecouplerPosition (const uint8_t inDecouplerId, const bool inPosition)
+{
+  return post (kTTIngressDecouplerPosition, inDecouplerId, inPosition) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTIngress::postSignalState (const uint8_t inSignalId, const TTSemaphoreState inState)
+{
+  return post (kTTIngressSignalState, inSignalId, inState) ;
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTIngress::pendingCount (void)
+{
+  return (uint8_t)(acquireIndex (sHead) - ownIndex (sTail)) ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTIngress::droppedCount (void)
+{
+#ifdef __AVR__
+  uint16_t count ;
+  ATOMIC_BLOCK (ATOMIC_RESTORESTATE) {
+    count = sDroppedCount ;
+  }
+  return count ;
+#else
+  return sDroppedCount ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTIngress::apply (const uint8_t inMaxCount)
+{
+  uint8_t tail = ownIndex (sTail) ;
+  const uint8_t head = acquireIndex (sHead) ;
+  const uint8_t pending = (uint8_t)(head - tail) ;
+  if (pending > sMaxPendingCount) {
+    sMaxPendingCount = pending ;
+  }
+  uint8_t applied = 0 ;
+  while (tail != head && (inMaxCount == 0 || applied < inMaxCount)) {
+    //--- Copied before the slot is handed back to the producer
+    const Change change = sChanges [tail & kMask] ;
+    tail++ ;
+    releaseIndex (sTail, tail) ;
+    switch (change.kind) {
+      case kTTIngressActualPosition :
+        TTAbstractPoint::setActualPositionOfPoint (change.identifier, (TTPointPosition)change.value) ;
+        break ;
+      case kTTIngressWishedPosition :
+        TTAbstractPoint::setWishedPositionOfPoint (change.identifier, (TTPointPosition)change.value) ;
+        break ;
+      case kTTIngressDecouplerPosition :
+        TTAbstractDecoupler::setPositionOfDecoupler (change.identifier, change.value != 0) ;
+        break ;
+      case kTTIngressSignalState :
+        TTAbstractSemaphore::setStateOfSignal (change.identifier, (TTSemaphoreState)change.value) ;
+        break ;
+      default :
+        break ;
+    }
+    applied++ ;
+  }
+  return applied ;
+}
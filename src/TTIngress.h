@@ -0,0 +1,87 @@
+//
+//  TTIngress.h
+//  CocoaSimulator
+//
+//  Changes of state coming from an interrupt handler or from an other
+//  thread. The static setters of the tiles invalidate and send actions, so
+//  they must only run in the main loop. The producer posts the change into
+//  a lock free single producer, single consumer ring, and the loop calls
+//  apply () which goes through the usual setters before the refresh of the
+//  displays.
+//
+//  The indexes are atomics with acquire and release ordering wherever the
+//  compiler has <atomic>, on the host and on the ARM boards. The AVR boards
+//  have no <atomic>: there the indexes are volatile bytes written by one
+//  side each, which a single core reads and writes in one access. There
+//  must be only one producer: one interrupt handler or one thread.
+//
+
+#ifndef TTIngress_h
+#define TTIngress_h
+
+#include "TTTrack.h"
+#include "TTSignal.h"
+
+#ifndef __AVR__
+  #include <atomic>
+#endif
+
+#if TT_INGRESS_SIZE > 128 || (TT_INGRESS_SIZE & (TT_INGRESS_SIZE - 1)) != 0
+  #error "TT_INGRESS_SIZE must be a power of two up to 128"
+#endif
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTIngressActualPosition,
+  kTTIngressWishedPosition,
+  kTTIngressDecouplerPosition,
+  kTTIngressSignalState
+} TTIngressKind ;
+
+#ifdef __AVR__
+  typedef volatile uint8_t TTIngressIndex ;
+  typedef volatile uint16_t TTIngressCounter ;
+#else
+  typedef std::atomic <uint8_t> TTIngressIndex ;
+  typedef std::atomic <uint16_t> TTIngressCounter ;
+#endif
+
+//-----------------------------------------------------------------------------
+class TTIngress {
+  //--- Producer side, safe in an interrupt handler. Return false, and drop
+  //    the change, when the ring is full
+  public : static bool postActualPosition (const uint8_t inPointId, const TTPointPosition inPosition) ;
+  public : static bool postWishedPosition (const uint8_t inPointId, const TTPointPosition inPosition) ;
+  public : static bool postDecouplerPosition (const uint8_t inDecouplerId, const bool inPosition) ;
+  public : static bool postSignalState (const uint8_t inSignalId, const TTSemaphoreState inState) ;
+
+  //--- Consumer side, called from loop (). Applies at most inMaxCount
+  //    changes, all of them when 0, and returns how many were applied
+  public : static uint8_t apply (const uint8_t inMaxCount = 0) ;
+
+  //--- Statistics, read by the consumer
+  public : static uint8_t pendingCount (void) ;
+  public : static uint8_t maxPendingCount (void) { return sMaxPendingCount ; }
+  //--- On AVR the 16 bit counter is read with the interrupts off
+  public : static uint16_t droppedCount (void) ;
+
+  private : static bool post (const TTIngressKind inKind,
+                              const uint8_t inIdentifier,
+                              const uint8_t inValue) ;
+
+  private : static const uint8_t kMask = TT_INGRESS_SIZE - 1 ;
+  private : typedef struct {
+    uint8_t kind ;
+    uint8_t identifier ;
+    uint8_t value ;
+  } Change ;
+
+  private : static Change sChanges [TT_INGRESS_SIZE] ;
+  //--- Free running, written by the producer and by the consumer
+  private : static TTIngressIndex sHead ;
+  private : static TTIngressIndex sTail ;
+  private : static TTIngressCounter sDroppedCount ;
+  private : static uint8_t sMaxPendingCount ;
+};
+
+#endif /* TTIngress_h */
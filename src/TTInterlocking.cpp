@@ -0,0 +1,175 @@
+//
+//  TTInterlocking.cpp
+//  CocoaSimulator
+//
+
+#include "TTInterlocking.h"
+
+#ifdef TT_INTERLOCKING
+
+//=============================================================================
+uint32_t TTInterlocking::sRoutePoints [TT_MAX_ROUTES][kTTPointMaskWords] ;
+uint32_t TTInterlocking::sBlockPoints [TT_MAX_BLOCKS][kTTPointMaskWords] ;
+uint32_t TTInterlocking::sLockedRoutes [(TT_MAX_ROUTES + 31) / 32] ;
+uint32_t TTInterlocking::sOccupiedBlocks [(TT_MAX_BLOCKS + 31) / 32] ;
+uint32_t TTInterlocking::sLockedPoints [kTTPointMaskWords] ;
+uint32_t TTInterlocking::sOccupiedPoints [kTTPointMaskWords] ;
+uint32_t TTInterlocking::sVetoedPoints [kTTPointMaskWords] ;
+uint32_t TTInterlocking::sVetoCount = 0 ;
+
+//-----------------------------------------------------------------------------
+static bool testBit (const uint32_t * inMask, const uint8_t inIndex)
+{
+  return (inMask [inIndex >> 5] & (1UL << (inIndex & 31))) != 0 ;
+}
+
+//-----------------------------------------------------------------------------
+static void setBit (uint32_t * ioMask, const uint8_t inIndex, const bool inValue)
+{
+  if (inValue) {
+    ioMask [inIndex >> 5] |= 1UL << (inIndex & 31) ;
+  }
+  else {
+    ioMask [inIndex >> 5] &= ~ (1UL << (inIndex & 31)) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTInterlocking::addPointToRoute (const uint8_t inRouteId, const uint8_t inPointId)
+{
+  if (inRouteId < TT_MAX_ROUTES && inPointId < kTTMaxNumberOfPoints) {
+    setBit (sRoutePoints [inRouteId], inPointId, true) ;
+    update () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTInterlocking::addPointToBlock (const uint8_t inBlockId, const uint8_t inPointId)
+{
+  if (inBlockId < TT_MAX_BLOCKS && inPointId < kTTMaxNumberOfPoints) {
+    setBit (sBlockPoints [inBlockId], inPointId, true) ;
+    update () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTInterlocking::clear (void)
+{
+  for (uint8_t w = 0 ; w < kTTPointMaskWords ; w++) {
+    for (uint8_t r = 0 ; r < TT_MAX_ROUTES ; r++) {
+      sRoutePoints [r][w] = 0 ;
+    }
+    for (uint8_t b = 0 ; b < TT_MAX_BLOCKS ; b++) {
+      sBlockPoints [b][w] = 0 ;
+    }
+  }
+  for (uint8_t w = 0 ; w < (TT_MAX_ROUTES + 31) / 32 ; w++) {
+    sLockedRoutes [w] = 0 ;
+  }
+  for (uint8_t w = 0 ; w < (TT_MAX_BLOCKS + 31) / 32 ; w++) {
+    sOccupiedBlocks [w] = 0 ;
+  }
+  update () ;
+}
+
+//-----------------------------------------------------------------------------
+// Out of the touch path: walks the locked routes and the occupied blocks
+void TTInterlocking::update (void)
+{
+  for (uint8_t w = 0 ; w < kTTPointMaskWords ; w++) {
+    uint32_t locked = 0 ;
+    for (uint8_t r = 0 ; r < TT_MAX_ROUTES ; r++) {
+      if (testBit (sLockedRoutes, r)) {
+        locked |= sRoutePoints [r][w] ;
+      }
+    }
+    uint32_t occupied = 0 ;
+    for (uint8_t b = 0 ; b < TT_MAX_BLOCKS ; b++) {
+      if (testBit (sOccupiedBlocks, b)) {
+        occupied |= sBlockPoints [b][w] ;
+      }
+    }
+    sLockedPoints [w] = locked ;
+    sOccupiedPoints [w] = occupied ;
+    sVetoedPoints [w] = locked | occupied ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::pointInLockedRoute (const uint8_t inPointId)
+{
+  return inPointId < kTTMaxNumberOfPoints && testBit (sLockedPoints, inPointId) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::pointInOccupiedBlock (const uint8_t inPointId)
+{
+  return inPointId < kTTMaxNumberOfPoints && testBit (sOccupiedPoints, inPointId) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::canLockRoute (const uint8_t inRouteId)
+{
+  if (inRouteId >= TT_MAX_ROUTES) return false ;
+  //--- Relocking a locked route does not conflict with itself
+  if (routeLocked (inRouteId)) return true ;
+  uint32_t conflicts = 0 ;
+  for (uint8_t w = 0 ; w < kTTPointMaskWords ; w++) {
+    conflicts |= sRoutePoints [inRouteId][w] & sVetoedPoints [w] ;
+  }
+  return conflicts == 0 ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::lockRoute (const uint8_t inRouteId)
+{
+  const bool result = canLockRoute (inRouteId) ;
+  if (result) {
+    setBit (sLockedRoutes, inRouteId, true) ;
+    update () ;
+  }
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+void TTInterlocking::unlockRoute (const uint8_t inRouteId)
+{
+  if (inRouteId < TT_MAX_ROUTES) {
+    setBit (sLockedRoutes, inRouteId, false) ;
+    update () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::routeLocked (const uint8_t inRouteId)
+{
+  return inRouteId < TT_MAX_ROUTES && testBit (sLockedRoutes, inRouteId) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::routesConflict (const uint8_t inRouteId1, const uint8_t inRouteId2)
+{
+  if (inRouteId1 >= TT_MAX_ROUTES || inRouteId2 >= TT_MAX_ROUTES) return false ;
+  uint32_t common = 0 ;
+  for (uint8_t w = 0 ; w < kTTPointMaskWords ; w++) {
+    common |= sRoutePoints [inRouteId1][w] & sRoutePoints [inRouteId2][w] ;
+  }
+  return common != 0 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTInterlocking::setBlockOccupied (const uint8_t inBlockId, const bool inOccupied)
+{
+  if (inBlockId < TT_MAX_BLOCKS && testBit (sOccupiedBlocks, inBlockId) != inOccupied) {
+    setBit (sOccupiedBlocks, inBlockId, inOccupied) ;
+    update () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTInterlocking::blockOccupied (const uint8_t inBlockId)
+{
+  return inBlockId < TT_MAX_BLOCKS && testBit (sOccupiedBlocks, inBlockId) ;
+}
+
+#endif
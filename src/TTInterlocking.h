@@ -0,0 +1,81 @@
+//
+//  TTInterlocking.h
+//  CocoaSimulator
+//
+//  Lockout of the points of the locked routes and of the occupied blocks.
+//  The sketch describes which points each route and each block contains,
+//  then locks and unlocks routes and reports the block occupancy. The set
+//  of points that can not be toggled is recomputed from bitmasks when a
+//  route or a block changes, so a touch only tests one bit of it.
+//
+//  Only the touches are vetoed, the static setters of TTAbstractPoint are
+//  obeyed: the sketch is trusted. Enabled by defining TT_INTERLOCKING in
+//  TTConfig.h, the default except on AVR.
+//
+
+#ifndef TTInterlocking_h
+#define TTInterlocking_h
+
+#include "TTTrack.h"
+
+#ifdef TT_INTERLOCKING
+
+//-----------------------------------------------------------------------------
+// One bit per point, point i in bit i % 32 of word i / 32
+static const uint8_t kTTPointMaskWords = (kTTMaxNumberOfPoints + 31) / 32 ;
+
+//-----------------------------------------------------------------------------
+class TTInterlocking {
+  //--- Description of the layout, route identifiers are below TT_MAX_ROUTES
+  //    and block identifiers below TT_MAX_BLOCKS
+  public : static void addPointToRoute (const uint8_t inRouteId, const uint8_t inPointId) ;
+  public : static void addPointToBlock (const uint8_t inBlockId, const uint8_t inPointId) ;
+  public : static void clear (void) ;
+
+  //--- Routes
+  public : static bool canLockRoute (const uint8_t inRouteId) ;
+  //--- Returns false, and locks nothing, if a point of the route is
+  //    already locked or in an occupied block
+  public : static bool lockRoute (const uint8_t inRouteId) ;
+  public : static void unlockRoute (const uint8_t inRouteId) ;
+  public : static bool routeLocked (const uint8_t inRouteId) ;
+  public : static bool routesConflict (const uint8_t inRouteId1, const uint8_t inRouteId2) ;
+
+  //--- Blocks
+  public : static void setBlockOccupied (const uint8_t inBlockId, const bool inOccupied) ;
+  public : static bool blockOccupied (const uint8_t inBlockId) ;
+
+  //--- State of a point
+  public : static bool pointInLockedRoute (const uint8_t inPointId) ;
+  public : static bool pointInOccupiedBlock (const uint8_t inPointId) ;
+
+  //--- Called by the points before a touch toggles them
+  public : static bool canToggle (const uint8_t inPointId)
+  {
+    if (inPointId < kTTMaxNumberOfPoints &&
+        (sVetoedPoints [inPointId >> 5] & (1UL << (inPointId & 31))) != 0) {
+      sVetoCount++ ;
+      return false ;
+    }
+    return true ;
+  }
+
+  //--- Touches refused since the start
+  public : static uint32_t vetoCount (void) { return sVetoCount ; }
+
+  private : static void update (void) ;
+
+  private : static uint32_t sRoutePoints [TT_MAX_ROUTES][kTTPointMaskWords] ;
+  private : static uint32_t sBlockPoints [TT_MAX_BLOCKS][kTTPointMaskWords] ;
+  private : static uint32_t sLockedRoutes [(TT_MAX_ROUTES + 31) / 32] ;
+  private : static uint32_t sOccupiedBlocks [(TT_MAX_BLOCKS + 31) / 32] ;
+  //--- Points of the locked routes and of the occupied blocks
+  private : static uint32_t sLockedPoints [kTTPointMaskWords] ;
+  private : static uint32_t sOccupiedPoints [kTTPointMaskWords] ;
+  private : static uint32_t sVetoedPoints [kTTPointMaskWords] ;
+  private : static uint32_t sVetoCount ;
+};
+
+#endif
+
+#endif /* TTInterlocking_h */
@@ -0,0 +1,191 @@
+//
+//  TTJournal.cpp
+//  CocoaSimulator
+//
+
+#include "TTJournal.h"
+
+#ifdef TT_JOURNAL
+
+#include "TTSignal.h"
+#include "TTDisplay.h"
+#include "Arduino.h"
+
+//=============================================================================
+TTJournalEvent TTJournal::sEvents [TT_JOURNAL_SIZE] ;
+uint16_t TTJournal::sFirst = 0 ;
+uint16_t TTJournal::sCount = 0 ;
+uint32_t TTJournal::sOverwrittenCount = 0 ;
+uint8_t TTJournal::sDepth = 0 ;
+bool TTJournal::sEnabled = true ;
+
+//-----------------------------------------------------------------------------
+void TTJournal::clear (void)
+{
+  sFirst = 0 ;
+  sCount = 0 ;
+  sOverwrittenCount = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+const TTJournalEvent & TTJournal::eventAtIndex (const uint16_t inIndex)
+{
+  return sEvents [(sFirst + inIndex) % TT_JOURNAL_SIZE] ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTJournal::copyEvents (TTJournalEvent * outEvents, const uint16_t inMaxCount)
+{
+  const uint16_t count = sCount < inMaxCount ? sCount : inMaxCount ;
+  for (uint16_t i = 0 ; i < count ; i++) {
+    outEvents [i] = eventAtIndex (i) ;
+  }
+  return count ;
+}
+
+//-----------------------------------------------------------------------------
+void TTJournal::record (const TTJournalEventKind inKind,
+                        const uint8_t inIdentifier,
+                        const uint8_t inValue,
+                        const AWPoint & inPoint)
+{
+  if (sEnabled) {
+    uint16_t index ;
+    if (sCount < TT_JOURNAL_SIZE) {
+      index = (sFirst + sCount) % TT_JOURNAL_SIZE ;
+      sCount++ ;
+    }
+    else {
+      index = sFirst ;
+      sFirst = (sFirst + 1) % TT_JOURNAL_SIZE ;
+      sOverwrittenCount++ ;
+    }
+    TTJournalEvent & event = sEvents [index] ;
+    event.time = micros () ;
+    event.kind = inKind ;
+    event.identifier = inIdentifier ;
+    event.value = inValue ;
+    event.derived = sDepth > 0 ;
+    event.x = (int16_t)inPoint.x ;
+    event.y = (int16_t)inPoint.y ;
+  }
+}
+
+//=============================================================================
+TTJournalScope::TTJournalScope (const TTJournalEventKind inKind,
+                                const uint8_t inIdentifier,
+                                const uint8_t inValue)
+{
+  TTJournal::record (inKind, inIdentifier, inValue, AWPoint (0, 0)) ;
+  TTJournal::sDepth++ ;
+}
+
+//-----------------------------------------------------------------------------
+TTJournalScope::TTJournalScope (const TTJournalEventKind inKind,
+                                const AWPoint & inPoint,
+                                const bool inInViewport)
+{
+  TTJournal::record (inKind, 0, inInViewport, inPoint) ;
+  TTJournal::sDepth++ ;
+}
+
+//-----------------------------------------------------------------------------
+TTJournalScope::~TTJournalScope (void)
+{
+  TTJournal::sDepth-- ;
+}
+
+//=============================================================================
+TTTile * TTJournalReplay::sTouchedTile = NULL ;
+
+//-----------------------------------------------------------------------------
+void TTJournalReplay::apply (const TTJournalEvent & inEvent)
+{
+  const AWPoint point (inEvent.x, inEvent.y) ;
+  switch (inEvent.kind) {
+    case kTTJournalActualPosition :
+      TTAbstractPoint::setActualPositionOfPoint (inEvent.identifier, (TTPointPosition)inEvent.value) ;
+      break ;
+    case kTTJournalWishedPosition :
+      TTAbstractPoint::setWishedPositionOfPoint (inEvent.identifier, (TTPointPosition)inEvent.value) ;
+      break ;
+    case kTTJournalTouchDown :
+      //--- The last constructed tile is on top. The tiles of a viewport and
+      //    the other ones have their own coordinates
+      sTouchedTile = NULL ;
+      for (TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+        if ((tile->viewport () != NULL) == (inEvent.value != 0) && tile->absoluteFrame ().containsPoint (point)) {
+          sTouchedTile = tile ;
+        }
+      }
+      if (sTouchedTile != NULL) {
+        sTouchedTile->touchDown (point) ;
+      }
+      break ;
+    case kTTJournalTouchMove :
+      if (sTouchedTile != NULL) {
+        sTouchedTile->touchMove (point) ;
+      }
+      break ;
+    case kTTJournalTouchUp :
+      if (sTouchedTile != NULL) {
+        sTouchedTile->touchUp (point) ;
+        sTouchedTile = NULL ;
+      }
+      break ;
+    case kTTJournalDecouplerToggle :
+      if (TTAbstractDecoupler::decouplerExists (inEvent.identifier)) {
+        TTAbstractDecoupler::sDecouplerForIdentifier [inEvent.identifier]->toggle () ;
+      }
+      break ;
+    case kTTJournalDecouplerPosition :
+      TTAbstractDecoupler::setPositionOfDecoupler (inEvent.identifier, inEvent.value != 0) ;
+      break ;
+    case kTTJournalSignalState :
+      TTAbstractSemaphore::setStateOfSignal (inEvent.identifier, (TTSemaphoreState)inEvent.value) ;
+      break ;
+    default :
+      break ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTReplayResult TTJournalReplay::replay (const TTJournalEvent * inEvents,
+                                        const uint16_t inCount,
+                                        TTDisplay * inDisplay)
+{
+  TTReplayResult result ;
+  result.eventCount = 0 ;
+  result.skippedCount = 0 ;
+  result.dispatch = 0 ;
+  result.redraw = 0 ;
+  result.slowestEvent = 0 ;
+  //--- The replayed calls must not be journaled again
+  const bool wasEnabled = TTJournal::enabled () ;
+  TTJournal::setEnabled (false) ;
+  sTouchedTile = NULL ;
+  for (uint16_t i = 0 ; i < inCount ; i++) {
+    if (inEvents [i].derived) {
+      result.skippedCount++ ;
+    }
+    else {
+      const uint32_t start = micros () ;
+      apply (inEvents [i]) ;
+      const uint32_t dispatched = micros () ;
+      if (inDisplay != NULL) {
+        inDisplay->refresh () ;
+      }
+      const uint32_t end = micros () ;
+      result.dispatch += dispatched - start ;
+      result.redraw += end - dispatched ;
+      if (end - start > result.slowestEvent) {
+        result.slowestEvent = end - start ;
+      }
+      result.eventCount++ ;
+    }
+  }
+  TTJournal::setEnabled (wasEnabled) ;
+  return result ;
+}
+
+#endif
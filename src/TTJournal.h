@@ -0,0 +1,117 @@
+//
+//  TTJournal.h
+//  CocoaSimulator
+//
+//  Ring buffer recording the state changing calls of an operating session
+//  with their time, and a replay driver feeding a captured journal back
+//  into a layout to measure the dispatch and redraw costs under a
+//  realistic load. Enabled by defining TT_JOURNAL in TTConfig.h.
+//
+
+#ifndef TTJournal_h
+#define TTJournal_h
+
+#include "TTTrack.h"
+
+#ifdef TT_JOURNAL
+
+class TTDisplay ;
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTJournalActualPosition,
+  kTTJournalWishedPosition,
+  kTTJournalTouchDown,
+  kTTJournalTouchMove,
+  kTTJournalTouchUp,
+  kTTJournalDecouplerToggle,
+  kTTJournalDecouplerPosition,
+  kTTJournalSignalState
+} TTJournalEventKind ;
+
+//-----------------------------------------------------------------------------
+// identifier and value are used by the point, decoupler and signal events,
+// x and y, in the coordinates of the tiles, by the touch events. The value
+// of a touch event is 1 when the tile is in a TTViewport, x and y are then
+// in the coordinates of the layout of the viewport. An event
+// recorded while an other one is processed is a consequence of it and is
+// not replayed.
+typedef struct {
+  uint32_t time ;
+  uint8_t kind ;
+  uint8_t identifier ;
+  uint8_t value ;
+  bool derived ;
+  int16_t x ;
+  int16_t y ;
+} TTJournalEvent ;
+
+//-----------------------------------------------------------------------------
+class TTJournal {
+  public : static void setEnabled (const bool inEnabled) { sEnabled = inEnabled ; }
+  public : static bool enabled (void) { return sEnabled ; }
+  public : static void clear (void) ;
+
+  //--- Events from the oldest to the most recent, the oldest ones are
+  //    overwritten when the buffer is full
+  public : static uint16_t count (void) { return sCount ; }
+  public : static const TTJournalEvent & eventAtIndex (const uint16_t inIndex) ;
+  public : static uint16_t copyEvents (TTJournalEvent * outEvents, const uint16_t inMaxCount) ;
+  public : static uint32_t overwrittenCount (void) { return sOverwrittenCount ; }
+
+  private : static void record (const TTJournalEventKind inKind,
+                                const uint8_t inIdentifier,
+                                const uint8_t inValue,
+                                const AWPoint & inPoint) ;
+
+  private : static TTJournalEvent sEvents [TT_JOURNAL_SIZE] ;
+  private : static uint16_t sFirst ;
+  private : static uint16_t sCount ;
+  private : static uint32_t sOverwrittenCount ;
+  private : static uint8_t sDepth ;
+  private : static bool sEnabled ;
+
+  friend class TTJournalScope ;
+};
+
+//-----------------------------------------------------------------------------
+// Records an event at the beginning of a state changing call. The events
+// recorded until the end of the scope are marked derived.
+class TTJournalScope {
+  public : TTJournalScope (const TTJournalEventKind inKind,
+                           const uint8_t inIdentifier,
+                           const uint8_t inValue) ;
+  public : TTJournalScope (const TTJournalEventKind inKind,
+                           const AWPoint & inPoint,
+                           const bool inInViewport) ;
+  public : ~TTJournalScope (void) ;
+
+  private : TTJournalScope (const TTJournalScope &) ;
+  private : TTJournalScope & operator = (const TTJournalScope &) ;
+};
+
+//-----------------------------------------------------------------------------
+// Times in microseconds.
+typedef struct {
+  uint16_t eventCount ;
+  uint16_t skippedCount ;
+  uint32_t dispatch ;
+  uint32_t redraw ;
+  uint32_t slowestEvent ;
+} TTReplayResult ;
+
+//-----------------------------------------------------------------------------
+class TTJournalReplay {
+  //--- Applies the events as fast as possible. When inDisplay is not NULL,
+  //    it is refreshed after each event and the time is counted as redraw
+  public : static TTReplayResult replay (const TTJournalEvent * inEvents,
+                                         const uint16_t inCount,
+                                         TTDisplay * inDisplay = NULL) ;
+
+  private : static void apply (const TTJournalEvent & inEvent) ;
+  private : static TTTile * sTouchedTile ;
+};
+
+#endif
+
+#endif /* TTJournal_h */
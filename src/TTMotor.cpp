@@ -0,0 +1,235 @@
+//
+//  TTMotor.cpp
+//  CocoaSimulator
+//
+
+#include "TTMotor.h"
+#include "TTChange.h"
+#include "TTTimeout.h"
+#include "Arduino.h"
+
+//-----------------------------------------------------------------------------
+// The deadline of a wish counts from the send of its command, a queued
+// wish does not fail because of the budget
+static void stopDeadline (const uint8_t inPointId)
+{
+#ifdef TT_WISH_TIMEOUT
+  TTWishTimeout::stop (inPointId) ;
+#else
+  (void) inPointId ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+static void startDeadline (const uint8_t inPointId)
+{
+#ifdef TT_WISH_TIMEOUT
+  if (TTAbstractPoint::wishedPositionOfPoint (inPointId) !=
+      TTAbstractPoint::actualPositionOfPoint (inPointId)) {
+    TTWishTimeout::start (inPointId) ;
+  }
+#else
+  (void) inPointId ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+TTMotorScheduler::TTMotorScheduler (TTMotorFunction inFunction,
+                                    void * inContext,
+                                    const uint8_t inMaxConcurrent,
+                                    const uint16_t inInterval) :
+mFunction (inFunction),
+mContext (inContext),
+mMaxConcurrent (1),
+mInterval (inInterval),
+mCount (0),
+mSlotUsed (0),
+mNextSlot (0)
+{
+  setBudget (inMaxConcurrent, inInterval) ;
+  for (uint8_t i = 0 ; i < kTTMaxNumberOfPoints ; i++) {
+    mSentPosition [i] = kNoPosition ;
+  }
+  resetStatistics () ;
+}
+
+//-----------------------------------------------------------------------------
+void TTMotorScheduler::setBudget (const uint8_t inMaxConcurrent, const uint16_t inInterval)
+{
+  if (inMaxConcurrent < 1) {
+    mMaxConcurrent = 1 ;
+  }
+  else if (inMaxConcurrent > kTTMaxMotorSlots) {
+    mMaxConcurrent = kTTMaxMotorSlots ;
+  }
+  else {
+    mMaxConcurrent = inMaxConcurrent ;
+  }
+  mInterval = inInterval ;
+  //--- The ring is rebuilt for the new size, the last sends are forgotten
+  mSlotUsed = 0 ;
+  mNextSlot = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTMotorScheduler::attach (void)
+{
+  return TTChangeNotifier::subscribeToWishes (0, kTTMaxNumberOfPoints - 1, wishChanged, this) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTMotorScheduler::detach (void)
+{
+  TTChangeNotifier::unsubscribe (this) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTMotorScheduler::wishChanged (const uint8_t inPointId,
+                                    const TTPointPosition /* inOldPosition */,
+                                    const TTPointPosition inNewPosition,
+                                    const TTChangeSource inSource,
+                                    void * inContext)
+{
+  //--- The board a synced wish comes from drives the motor
+  if (inSource != kTTSyncSource) {
+    ((TTMotorScheduler *)inContext)->enqueue (inPointId, inNewPosition, inSource) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTMotorScheduler::enqueue (const uint8_t inPointId,
+                                const TTPointPosition inPosition,
+                                const TTChangeSource inSource,
+                                const uint32_t inNow)
+{
+  if (inPointId >= kTTMaxNumberOfPoints) return false ;
+  for (uint8_t i = 0 ; i < mCount ; i++) {
+    Command & command = mQueue [i] ;
+    if (command.pointId == inPointId) {
+      mSupersededCount++ ;
+      if (inPosition == mSentPosition [inPointId]) {
+        //--- Back to where the motor is: nothing to send
+        for (uint8_t j = i + 1 ; j < mCount ; j++) {
+          mQueue [j - 1] = mQueue [j] ;
+        }
+        mCount-- ;
+        startDeadline (inPointId) ;
+      }
+      else {
+        //--- Keeps its place and its time, a touch raises its priority
+        command.position = inPosition ;
+        if (inSource == kTTTouchSource) {
+          command.source = kTTTouchSource ;
+        }
+        stopDeadline (inPointId) ;
+      }
+      return true ;
+    }
+  }
+  Command & command = mQueue [mCount] ;
+  command.time = inNow ;
+  command.pointId = inPointId ;
+  command.position = inPosition ;
+  command.source = inSource ;
+  mCount++ ;
+  stopDeadline (inPointId) ;
+  if (mCount > mMaxQueueDepth) {
+    mMaxQueueDepth = mCount ;
+  }
+  return true ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTMotorScheduler::enqueue (const uint8_t inPointId,
+                                const TTPointPosition inPosition,
+                                const TTChangeSource inSource)
+{
+  return enqueue (inPointId, inPosition, inSource, millis ()) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTMotorScheduler::cancelAll (void)
+{
+  //--- The dropped wishes will not be sent, they may fail
+  for (uint8_t i = 0 ; i < mCount ; i++) {
+    startDeadline (mQueue [i].pointId) ;
+  }
+  mSupersededCount += mCount ;
+  mCount = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTMotorScheduler::slotAvailable (const uint32_t inNow) const
+{
+  //--- When the ring is full, mNextSlot is the oldest send
+  return mSlotUsed < mMaxConcurrent ||
+         (uint32_t)(inNow - mSlotTimes [mNextSlot]) >= mInterval ;
+}
+
+//-----------------------------------------------------------------------------
+// The first touch command, or the first command if there is none
+int8_t TTMotorScheduler::nextCommand (void) const
+{
+  for (uint8_t i = 0 ; i < mCount ; i++) {
+    if (mQueue [i].source == kTTTouchSource) {
+      return (int8_t)i ;
+    }
+  }
+  return mCount > 0 ? 0 : -1 ;
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTMotorScheduler::run (const uint32_t inNow)
+{
+  uint8_t sent = 0 ;
+  while (mCount > 0 && slotAvailable (inNow)) {
+    const uint8_t index = (uint8_t)nextCommand () ;
+    const Command command = mQueue [index] ;
+    for (uint8_t j = index + 1 ; j < mCount ; j++) {
+      mQueue [j - 1] = mQueue [j] ;
+    }
+    mCount-- ;
+    //--- Take the slot before calling out, the function may enqueue
+    mSlotTimes [mNextSlot] = inNow ;
+    mNextSlot = (mNextSlot + 1) % mMaxConcurrent ;
+    if (mSlotUsed < mMaxConcurrent) {
+      mSlotUsed++ ;
+    }
+    mSentPosition [command.pointId] = command.position ;
+    const uint32_t wait = inNow - command.time ;
+    mTotalWait += wait ;
+    if (wait > mMaxWait) {
+      mMaxWait = wait ;
+    }
+    mSentCount++ ;
+    sent++ ;
+    //--- Before the call, the function may report the feedback at once
+    startDeadline (command.pointId) ;
+    if (mFunction != NULL) {
+      mFunction (command.pointId, (TTPointPosition)command.position, mContext) ;
+    }
+  }
+  return sent ;
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTMotorScheduler::run (void)
+{
+  return run (millis ()) ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTMotorScheduler::averageWait (void) const
+{
+  return mSentCount > 0 ? mTotalWait / mSentCount : 0 ;
+}
+
+//-----------------------------------------------------------------------------
+void TTMotorScheduler::resetStatistics (void)
+{
+  mMaxQueueDepth = mCount ;
+  mSentCount = 0 ;
+  mSupersededCount = 0 ;
+  mTotalWait = 0 ;
+  mMaxWait = 0 ;
+}
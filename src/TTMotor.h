@@ -0,0 +1,116 @@
+//
+//  TTMotor.h
+//  CocoaSimulator
+//
+//  Scheduler of the point motor commands. A capacitor discharge unit can
+//  only fire a few solenoids before it has to recharge, so the wished
+//  positions set in bulk can not all be sent to the hardware at once. The
+//  scheduler queues one command per point and sends them to the motor
+//  function within a budget: at most maxConcurrent commands in any window
+//  of interval milliseconds.
+//
+//  The commands coming from a touch go before the ones set by the sketch,
+//  then the oldest goes first. A new wish for a point replaces its queued
+//  command, and cancels it when the motor is already in that position.
+//
+//  The deadline of a wish (see TTTimeout.h) is held while its command is
+//  queued and starts when it is sent, or when it is dropped.
+//
+
+#ifndef TTMotor_h
+#define TTMotor_h
+
+#include "TTTrack.h"
+
+//-----------------------------------------------------------------------------
+typedef void (*TTMotorFunction) (const uint8_t inPointId,
+                                 const TTPointPosition inPosition,
+                                 void * inContext) ;
+
+static const uint8_t kTTMaxMotorSlots = 8 ;
+
+//-----------------------------------------------------------------------------
+class TTMotorScheduler {
+  //--- Two solenoids per 200 ms by default
+  public : TTMotorScheduler (TTMotorFunction inFunction,
+                             void * inContext = NULL,
+                             const uint8_t inMaxConcurrent = 2,
+                             const uint16_t inInterval = 200) ;
+
+  //--- inMaxConcurrent is clamped to 1 .. kTTMaxMotorSlots
+  public : void setBudget (const uint8_t inMaxConcurrent, const uint16_t inInterval) ;
+  public : uint8_t maxConcurrent (void) const { return mMaxConcurrent ; }
+  public : uint16_t interval (void) const { return mInterval ; }
+
+  //--- Queues the wishes of the points through TTChangeNotifier, except the
+  //    ones applied by TTSyncDecoder
+  public : bool attach (void) ;
+  public : void detach (void) ;
+
+  //--- Returns false if inPointId is out of range
+  public : bool enqueue (const uint8_t inPointId,
+                         const TTPointPosition inPosition,
+                         const TTChangeSource inSource,
+                         const uint32_t inNow) ;
+  public : bool enqueue (const uint8_t inPointId,
+                         const TTPointPosition inPosition,
+                         const TTChangeSource inSource = kTTRemoteSource) ;
+  //--- Drops every queued command
+  public : void cancelAll (void) ;
+
+  //--- Sends the commands the budget allows, called from loop ()
+  public : uint8_t run (const uint32_t inNow) ;
+  public : uint8_t run (void) ;
+
+  //--- Statistics, times in milliseconds
+  public : uint8_t queueDepth (void) const { return mCount ; }
+  public : uint8_t maxQueueDepth (void) const { return mMaxQueueDepth ; }
+  public : uint32_t sentCount (void) const { return mSentCount ; }
+  public : uint32_t supersededCount (void) const { return mSupersededCount ; }
+  public : uint32_t maxWait (void) const { return mMaxWait ; }
+  public : uint32_t averageWait (void) const ;
+  public : void resetStatistics (void) ;
+
+  private : static void wishChanged (const uint8_t inPointId,
+                                     const TTPointPosition inOldPosition,
+                                     const TTPointPosition inNewPosition,
+                                     const TTChangeSource inSource,
+                                     void * inContext) ;
+
+  private : bool slotAvailable (const uint32_t inNow) const ;
+  private : int8_t nextCommand (void) const ;
+
+  private : typedef struct {
+    uint32_t time ;
+    uint8_t pointId ;
+    uint8_t position ;
+    uint8_t source ;
+  } Command ;
+
+  private : TTMotorFunction mFunction ;
+  private : void * mContext ;
+  private : uint8_t mMaxConcurrent ;
+  private : uint16_t mInterval ;
+
+  //--- Queued commands, one per point at most, in the order they came
+  private : Command mQueue [kTTMaxNumberOfPoints] ;
+  private : uint8_t mCount ;
+  //--- Position last sent to each motor, kNoPosition if none
+  private : uint8_t mSentPosition [kTTMaxNumberOfPoints] ;
+  //--- Times of the last sends, a ring of mMaxConcurrent entries
+  private : uint32_t mSlotTimes [kTTMaxMotorSlots] ;
+  private : uint8_t mSlotUsed ;
+  private : uint8_t mNextSlot ;
+
+  private : uint8_t mMaxQueueDepth ;
+  private : uint32_t mSentCount ;
+  private : uint32_t mSupersededCount ;
+  private : uint32_t mTotalWait ;
+  private : uint32_t mMaxWait ;
+
+  //--- No copy
+  private : TTMotorScheduler (const TTMotorScheduler &) ;
+  private : TTMotorScheduler & operator = (const TTMotorScheduler &) ;
+};
+
+#endif /* TTMotor_h */
@@ -0,0 +1,153 @@
+//
+//  TTPixelKernels.cpp
+//  CocoaSimulator
+//
+
+#include "TTPixelKernels.h"
+#include <string.h>
+
+#if defined (__SSE2__)
+  #include <emmintrin.h>
+#elif defined (__ARM_NEON)
+  #include <arm_neon.h>
+#endif
+
+//--- 32 bit stores into the 16 bit rows
+typedef uint32_t __attribute__ ((__may_alias__)) TTWord ;
+
+//-----------------------------------------------------------------------------
+void ttFillRow (uint16_t * outRow, const uint16_t inPixel, uint32_t inCount)
+{
+  //--- Align on 32 bits
+  if (((uintptr_t)outRow & 2) != 0 && inCount > 0) {
+    * outRow++ = inPixel ;
+    inCount-- ;
+  }
+#if defined (__SSE2__)
+  const __m128i v = _mm_set1_epi16 ((short)inPixel) ;
+  while (inCount >= 8) {
+    _mm_storeu_si128 ((__m128i *)outRow, v) ;
+    outRow += 8 ;
+    inCount -= 8 ;
+  }
+#elif defined (__ARM_NEON)
+  const uint16x8_t v = vdupq_n_u16 (inPixel) ;
+  while (inCount >= 8) {
+    vst1q_u16 (outRow, v) ;
+    outRow += 8 ;
+    inCount -= 8 ;
+  }
+#endif
+  const uint32_t pair = ((uint32_t)inPixel << 16) | inPixel ;
+  TTWord * words = (TTWord *)outRow ;
+  while (inCount >= 8) {
+    words [0] = pair ;
+    words [1] = pair ;
+    words [2] = pair ;
+    words [3] = pair ;
+    words += 4 ;
+    inCount -= 8 ;
+  }
+  while (inCount >= 2) {
+    * words++ = pair ;
+    inCount -= 2 ;
+  }
+  if (inCount > 0) {
+    * (uint16_t *)words = inPixel ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void ttFillRow (uint32_t * outRow, const uint32_t inPixel, uint32_t inCount)
+{
+#if defined (__SSE2__)
+  const __m128i v = _mm_set1_epi32 ((int)inPixel) ;
+  while (inCount >= 4) {
+    _mm_storeu_si128 ((__m128i *)outRow, v) ;
+    outRow += 4 ;
+    inCount -= 4 ;
+  }
+#elif defined (__ARM_NEON)
+  const uint32x4_t v = vdupq_n_u32 (inPixel) ;
+  while (inCount >= 4) {
+    vst1q_u32 (outRow, v) ;
+    outRow += 4 ;
+    inCount -= 4 ;
+  }
+#endif
+  while (inCount >= 4) {
+    outRow [0] = inPixel ;
+    outRow [1] = inPixel ;
+    outRow [2] = inPixel ;
+    outRow [3] = inPixel ;
+    outRow += 4 ;
+    inCount -= 4 ;
+  }
+  while (inCount > 0) {
+    * outRow++ = inPixel ;
+    inCount-- ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// The memmove of the C libraries of the targets is already vectorized
+void ttCopyRow (uint16_t * outRow, const uint16_t * inRow, const uint32_t inCount)
+{
+  memmove (outRow, inRow, inCount * sizeof (uint16_t)) ;
+}
+
+//-----------------------------------------------------------------------------
+void ttCopyRow (uint32_t * outRow, const uint32_t * inRow, const uint32_t inCount)
+{
+  memmove (outRow, inRow, inCount * sizeof (uint32_t)) ;
+}
+
+//-----------------------------------------------------------------------------
+// Tracks are long thin rectangles and diagonals are drawn as 1 pixel wide
+// columns, both are special cased
+void ttFillRect (uint16_t * outTopLeft,
+                 const uint32_t inStride,
+                 const uint32_t inWidth,
+                 const uint32_t inHeight,
+                 const uint16_t inPixel)
+{
+  if (inWidth == 1) {
+    for (uint32_t y = 0 ; y < inHeight ; y++) {
+      * outTopLeft = inPixel ;
+      outTopLeft += inStride ;
+    }
+  }
+  else if (inWidth == inStride) {
+    ttFillRow (outTopLeft, inPixel, inWidth * inHeight) ;
+  }
+  else {
+    for (uint32_t y = 0 ; y < inHeight ; y++) {
+      ttFillRow (outTopLeft, inPixel, inWidth) ;
+      outTopLeft += inStride ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void ttFillRect (uint32_t * outTopLeft,
+                 const uint32_t inStride,
+                 const uint32_t inWidth,
+                 const uint32_t inHeight,
+                 const uint32_t inPixel)
+{
+  if (inWidth == 1) {
+    for (uint32_t y = 0 ; y < inHeight ; y++) {
+      * outTopLeft = inPixel ;
+      outTopLeft += inStride ;
+    }
+  }
+  else if (inWidth == inStride) {
+    ttFillRow (outTopLeft, inPixel, inWidth * inHeight) ;
+  }
+  else {
+    for (uint32_t y = 0 ; y < inHeight ; y++) {
+      ttFillRow (outTopLeft, inPixel, inWidth) ;
+      outTopLeft += inStride ;
+    }
+  }
+}
@@ -0,0 +1,37 @@
+//
+//  TTPixelKernels.h
+//  CocoaSimulator
+//
+//  Row fill and copy loops of the framebuffer backends. Almost everything
+//  the tiles draw ends up as solid rectangles, so these loops are where a
+//  framebuffer spends its time. They store 128 bits at a time with SSE2 or
+//  NEON when the compiler targets them and 32 bits at a time otherwise
+//  (ESP32). The caller clips, once per rectangle.
+//
+
+#ifndef TTPixelKernels_h
+#define TTPixelKernels_h
+
+#include <stdint.h>
+
+//-----------------------------------------------------------------------------
+void ttFillRow (uint16_t * outRow, const uint16_t inPixel, uint32_t inCount) ;
+void ttFillRow (uint32_t * outRow, const uint32_t inPixel, uint32_t inCount) ;
+
+//--- The rows may overlap, as when scrolling
+void ttCopyRow (uint16_t * outRow, const uint16_t * inRow, const uint32_t inCount) ;
+void ttCopyRow (uint32_t * outRow, const uint32_t * inRow, const uint32_t inCount) ;
+
+//--- inStride is the distance between two rows, in pixels
+void ttFillRect (uint16_t * outTopLeft,
+                 const uint32_t inStride,
+                 const uint32_t inWidth,
+                 const uint32_t inHeight,
+                 const uint16_t inPixel) ;
+void ttFillRect (uint32_t * outTopLeft,
+                 const uint32_t inStride,
+                 const uint32_t inWidth,
+                 const uint32_t inHeight,
+                 const uint32_t inPixel) ;
+
+#endif /* TTPixelKernels_h */
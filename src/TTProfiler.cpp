@@ -0,0 +1,93 @@
+//
+//  TTProfiler.cpp
+//  CocoaSimulator
+//
+
+#include "TTProfiler.h"
+
+#ifdef TT_PROFILE
+
+//=============================================================================
+uint16_t TTProfiler::sFrame = 0 ;
+TTDrawCounters TTProfiler::sClassCounters [kTTNumberOfTileKinds] ;
+const TTTile * TTProfiler::sMostExpensiveTile = NULL ;
+uint32_t TTProfiler::sMostExpensivePixels = 0 ;
+const TTTile * TTProfiler::sCurrentTile = NULL ;
+TTDrawCounters * TTProfiler::sCurrentTileCounters = NULL ;
+TTTileKind TTProfiler::sCurrentKind = kTTTrackKind ;
+
+//-----------------------------------------------------------------------------
+void TTProfiler::beginFrame (void)
+{
+  //--- Tile counters are stamped with the frame and reset lazily
+  sFrame++ ;
+  for (uint8_t k = 0 ; k < kTTNumberOfTileKinds ; k++) {
+    sClassCounters [k].reset () ;
+  }
+  sMostExpensiveTile = NULL ;
+  sMostExpensivePixels = 0 ;
+}
+
+//-----------------------------------------------------------------------------
+const TTDrawCounters & TTProfiler::classCounters (const TTTileKind inKind)
+{
+  return sClassCounters [inKind] ;
+}
+
+//-----------------------------------------------------------------------------
+TTDrawCounters TTProfiler::frameCounters (void)
+{
+  TTDrawCounters result ;
+  for (uint8_t k = 0 ; k < kTTNumberOfTileKinds ; k++) {
+    result.add (sClassCounters [k]) ;
+  }
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+void TTProfiler::record (const TTPrimitiveKind inPrimitive, const uint32_t inPixels)
+{
+  sClassCounters [sCurrentKind].add (inPrimitive, inPixels) ;
+  if (sCurrentTileCounters != NULL) {
+    sCurrentTileCounters->add (inPrimitive, inPixels) ;
+  }
+}
+
+//=============================================================================
+TTProfileScope::TTProfileScope (const TTTile * inTile) :
+mPreviousTile (TTProfiler::sCurrentTile),
+mPreviousTileCounters (TTProfiler::sCurrentTileCounters),
+mPreviousKind (TTProfiler::sCurrentKind)
+{
+  TTProfiler::sCurrentTile = inTile ;
+  TTProfiler::sCurrentTileCounters = & inTile->drawCountersOfFrame (TTProfiler::sFrame) ;
+  TTProfiler::sCurrentKind = inTile->tileKind () ;
+}
+
+//-----------------------------------------------------------------------------
+TTProfileScope::TTProfileScope (const TTTileKind inKind) :
+mPreviousTile (TTProfiler::sCurrentTile),
+mPreviousTileCounters (TTProfiler::sCurrentTileCounters),
+mPreviousKind (TTProfiler::sCurrentKind)
+{
+  TTProfiler::sCurrentTile = NULL ;
+  TTProfiler::sCurrentTileCounters = NULL ;
+  TTProfiler::sCurrentKind = inKind ;
+}
+
+//-----------------------------------------------------------------------------
+TTProfileScope::~TTProfileScope (void)
+{
+  if (TTProfiler::sCurrentTile != NULL) {
+    const uint32_t pixels = TTProfiler::sCurrentTileCounters->totalPixels () ;
+    if (pixels > TTProfiler::sMostExpensivePixels) {
+      TTProfiler::sMostExpensivePixels = pixels ;
+      TTProfiler::sMostExpensiveTile = TTProfiler::sCurrentTile ;
+    }
+  }
+  TTProfiler::sCurrentTile = mPreviousTile ;
+  TTProfiler::sCurrentTileCounters = mPreviousTileCounters ;
+  TTProfiler::sCurrentKind = mPreviousKind ;
+}
+
+#endif /* TT_PROFILE */
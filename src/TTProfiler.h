@@ -0,0 +1,64 @@
+//
+//  TTProfiler.h
+//  CocoaSimulator
+//
+//  Per frame counting of the drawing primitives issued by the tiles.
+//  Enabled by defining TT_PROFILE in TTConfig.h. A frame starts with
+//  TTProfiler::beginFrame () ; the counters of the class and of each tile
+//  then accumulate until the next call.
+//
+
+#ifndef TTProfiler_h
+#define TTProfiler_h
+
+#include "TTTrack.h"
+
+#ifdef TT_PROFILE
+
+//-----------------------------------------------------------------------------
+class TTProfiler {
+  //--- Frame handling
+  public : static void beginFrame (void) ;
+  public : static uint16_t frame (void) { return sFrame ; }
+
+  //--- Counters of a class of tile for the current frame
+  public : static const TTDrawCounters & classCounters (const TTTileKind inKind) ;
+  //--- Counters of all the tiles for the current frame
+  public : static TTDrawCounters frameCounters (void) ;
+  //--- Tile that covered the largest number of pixels in the current frame
+  public : static const TTTile * mostExpensiveTile (void) { return sMostExpensiveTile ; }
+
+  //--- Called by TTDraw for each primitive
+  public : static void record (const TTPrimitiveKind inPrimitive, const uint32_t inPixels) ;
+
+  private : static uint16_t sFrame ;
+  private : static TTDrawCounters sClassCounters [kTTNumberOfTileKinds] ;
+  private : static const TTTile * sMostExpensiveTile ;
+  private : static uint32_t sMostExpensivePixels ;
+
+  private : static const TTTile * sCurrentTile ;
+  private : static TTDrawCounters * sCurrentTileCounters ;
+  private : static TTTileKind sCurrentKind ;
+
+  friend class TTProfileScope ;
+};
+
+//-----------------------------------------------------------------------------
+// Declared at the top of drawInRegion, attributes the primitives to the tile
+// and to its class until the end of the method.
+class TTProfileScope {
+  public : TTProfileScope (const TTTile * inTile) ;
+  public : TTProfileScope (const TTTileKind inKind) ;
+  public : ~TTProfileScope (void) ;
+
+  private : const TTTile * mPreviousTile ;
+  private : TTDrawCounters * mPreviousTileCounters ;
+  private : TTTileKind mPreviousKind ;
+
+  private : TTProfileScope (const TTProfileScope &) ;
+  private : TTProfileScope & operator = (const TTProfileScope &) ;
+};
+
+#endif /* TT_PROFILE */
+
+#endif /* TTProfiler_h */
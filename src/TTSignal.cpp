@@ -8,9 +8,19 @@
 
 #include "TTSignal.h"
 #include "TTConfig.h"
+#include "TTProfiler.h"
+#include "TTJournal.h"
+#include "TTSnapshot.h"
+#include "TTGeneration.h"
 #include "AWContext.h"
 #include "AWLine.h"
 
+//=============================================================================
+// Pinned like the track tiles (see TTTrack.cpp)
+#ifndef TT_PROFILE
+static_assert (sizeof (TTSemaphoreF) <= sizeof (TTTile) + 8, "TTSemaphoreF grew") ;
+#endif
+
 //=============================================================================
 TTSignal::TTSignal (const AWPoint &inLocation, const bool inDirection) :
 TTTile (inLocation),
@@ -18,6 +28,13 @@ mDirection (inDirection)
 {
 }
 
+//-----------------------------------------------------------------------------
+TTSignal::TTSignal (const AWRect &inFrame, const bool inDirection) :
+TTTile (inFrame),
+mDirection (inDirection)
+{
+}
+
 //-----------------------------------------------------------------------------
 bool TTSignal::isOpaque() const
 {
@@ -25,61 +42,144 @@ bool TTSignal::isOpaque() const
 }
 
 //=============================================================================
-TTSemaphoreF::TTSemaphoreF (const AWPoint &inLocation, const bool inDirection) :
-TTSignal (inLocation, inDirection),
-mState (kTTSemaphore)
+TTAbstractSemaphore::TTAbstractSemaphore (const AWRect &inFrame,
+                                          const bool inDirection,
+                                          const uint8_t inSignalId) :
+TTSignal (inFrame, inDirection),
+mState (kTTSemaphore),
+mSignalId (inSignalId)
 {
+  if (inSignalId < kTTMaxNumberOfSignals) {
+    sSignalForIdentifier[inSignalId] = this ;
+#ifdef TT_GENERATION
+    TTGeneration::touch (kTTSignalObject, inSignalId) ;
+#endif
+  }
 }
 
 //-----------------------------------------------------------------------------
-void TTSemaphoreF::setState (const TTSemaphoreState inState)
+TTAbstractSemaphore::~TTAbstractSemaphore (void)
 {
+  if (mSignalId < kTTMaxNumberOfSignals && sSignalForIdentifier[mSignalId] == this) {
+    sSignalForIdentifier[mSignalId] = NULL ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTAbstractSemaphore * TTAbstractSemaphore::sSignalForIdentifier[kTTMaxNumberOfSignals] = { NULL } ;
+
+//-----------------------------------------------------------------------------
+void TTAbstractSemaphore::setState (const TTSemaphoreState inState)
+{
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalSignalState, mSignalId, inState) ;
+#endif
+#ifdef TT_GENERATION
+  if (mState != inState) {
+    TTGeneration::touch (kTTSignalObject, mSignalId) ;
+  }
+#endif
   mState = inState ;
-  setNeedsDisplay () ;
+  invalidate () ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractSemaphore::saveState (TTStateWriter & ioWriter) const
+{
+  ioWriter.write (mState, 2) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractSemaphore::restoreState (TTStateReader & ioReader)
+{
+  mState = (TTSemaphoreState)ioReader.read (2) ;
+}
+
+//-----------------------------------------------------------------------------
+TTSemaphoreState TTAbstractSemaphore::stateOfSignal (const uint8_t inSignalId)
+{
+  if (inSignalId < kTTMaxNumberOfSignals && sSignalForIdentifier[inSignalId] != NULL) {
+    return sSignalForIdentifier[inSignalId]->state () ;
+  }
+  else {
+    return kTTSemaphore ;
+  }
 }
 
 //-----------------------------------------------------------------------------
-void TTSemaphoreF::drawInRegion (const AWRegion & inDrawRegion) const
+void TTAbstractSemaphore::setStateOfSignal (const uint8_t inSignalId,
+                                            const TTSemaphoreState inState)
 {
+  if (inSignalId < kTTMaxNumberOfSignals && sSignalForIdentifier[inSignalId] != NULL) {
+    sSignalForIdentifier[inSignalId]->setState (inState) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTAbstractSemaphore::signalExists (const uint8_t inSignalId)
+{
+  return inSignalId < kTTMaxNumberOfSignals && sSignalForIdentifier[inSignalId] != NULL ;
+}
+
+//=============================================================================
+template <class M>
+TTSemaphoreFT <M>::TTSemaphoreFT (const AWPoint &inLocation,
+                                  const bool inDirection,
+                                  const uint8_t inSignalId) :
+TTAbstractSemaphore (M::tileFrame (inLocation, 1, 1), inDirection, inSignalId)
+{
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTSemaphoreFT <M>::drawInRegion (const AWRegion & inDrawRegion) const
+{
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect r = absoluteFrame () ;
-    r.size.width = TILE_PIXEL_GRID - 2 ;
-    r.size.height = (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 - 1;
+    r.size.width = M::kGrid - M::scaled (2) ;
+    r.size.height = M::kTrackOffset - 1;
   if (! direction ()) {
-    r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + STRAIGHT_TRACK_WIDTH + 1;
-    r.origin.x += 2 ;
+    r.origin.y += M::kTrackOffset + M::kStraightWidth + 1;
+    r.origin.x += M::scaled (2) ;
   }
-  AWContext::setColor (AWColor::black()) ;
-  r.fillRoundRectInRegion ( TILE_PIXEL_GRID / 8, inDrawRegion) ;
+  TTDraw::setColor (AWColor::black()) ;
+  TTDraw::fillRoundRect (r, M::kGrid / 8, inDrawRegion) ;
   if (direction()) {
     const AWPoint p1 (r.origin.x + 2 * r.size.width / 3, r.origin.y + r.size.height) ;
-    const AWPoint p2 (p1.x, p1.y + STRAIGHT_TRACK_WIDTH / 2) ;
-    p1.strokeLineInRegion (p2, inDrawRegion) ;
+    const AWPoint p2 (p1.x, p1.y + M::kStraightWidth / 2) ;
+    TTDraw::strokeLine (p1, p2, inDrawRegion) ;
     AWRect light = r ;
-    light.inset (TILE_PIXEL_GRID / 10, TILE_PIXEL_GRID / 10) ;
+    light.inset (M::kGrid / 10, M::kGrid / 10) ;
     light.size.width = light.size.height ;
-    AWContext::setColor (mState == kTTVoieLibre ? AWColor::green() : AWColor::gray()) ;
-    light.fillOvalInRegion(inDrawRegion) ;
-    light.origin.x += light.size.width + 2 ;
-    AWContext::setColor (mState == kTTSemaphore ? AWColor::red() : AWColor::gray()) ;
-    light.fillOvalInRegion(inDrawRegion) ;
-    light.origin.x += light.size.width + 2;
-    AWContext::setColor (mState == kTTRalentissement ? AWColor::yellow() : AWColor::gray()) ;
-    light.fillOvalInRegion(inDrawRegion) ;
+    TTDraw::setColor (state () == kTTVoieLibre ? AWColor::green() : AWColor::gray()) ;
+    TTDraw::fillOval (light, inDrawRegion) ;
+    light.origin.x += light.size.width + M::scaled (2) ;
+    TTDraw::setColor (state () == kTTSemaphore ? AWColor::red() : AWColor::gray()) ;
+    TTDraw::fillOval (light, inDrawRegion) ;
+    light.origin.x += light.size.width + M::scaled (2) ;
+    TTDraw::setColor (state () == kTTRalentissement ? AWColor::yellow() : AWColor::gray()) ;
+    TTDraw::fillOval (light, inDrawRegion) ;
   }
   else {
     const AWPoint p1 (r.origin.x + r.size.width / 3, r.origin.y) ;
-    const AWPoint p2 (p1.x, p1.y - STRAIGHT_TRACK_WIDTH / 2 - 1) ;
-    p1.strokeLineInRegion (p2, inDrawRegion) ;
+    const AWPoint p2 (p1.x, p1.y - M::kStraightWidth / 2 - 1) ;
+    TTDraw::strokeLine (p1, p2, inDrawRegion) ;
     AWRect light = r ;
-    light.inset (TILE_PIXEL_GRID / 10, TILE_PIXEL_GRID / 10) ;
+    light.inset (M::kGrid / 10, M::kGrid / 10) ;
     light.size.width = light.size.height ;
-    AWContext::setColor (mState == kTTRalentissement ? AWColor::green() : AWColor::gray()) ;
-    light.fillOvalInRegion(inDrawRegion) ;
-    light.origin.x += light.size.width + 2 ;
-    AWContext::setColor (mState == kTTSemaphore ? AWColor::red() : AWColor::gray()) ;
-    light.fillOvalInRegion(inDrawRegion) ;
-    light.origin.x += light.size.width + 2;
-    AWContext::setColor (mState == kTTVoieLibre ? AWColor::yellow() : AWColor::gray()) ;
-    light.fillOvalInRegion(inDrawRegion) ;
+    TTDraw::setColor (state () == kTTRalentissement ? AWColor::green() : AWColor::gray()) ;
+    TTDraw::fillOval (light, inDrawRegion) ;
+    light.origin.x += light.size.width + M::scaled (2) ;
+    TTDraw::setColor (state () == kTTSemaphore ? AWColor::red() : AWColor::gray()) ;
+    TTDraw::fillOval (light, inDrawRegion) ;
+    light.origin.x += light.size.width + M::scaled (2) ;
+    TTDraw::setColor (state () == kTTVoieLibre ? AWColor::yellow() : AWColor::gray()) ;
+    TTDraw::fillOval (light, inDrawRegion) ;
   }
 }
+
+//=============================================================================
+template class TTSemaphoreFT <TTDefaultMetrics> ;
+template class TTSemaphoreFT <TTOverviewMetrics> ;
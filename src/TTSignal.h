@@ -15,28 +15,60 @@
 class TTSignal : public TTTile
 {
   public : TTSignal (const AWPoint &inLocation, const bool inDirection) ;
+  public : TTSignal (const AWRect &inFrame, const bool inDirection) ;
   
   private : bool mDirection ;
   public : bool direction () const { return mDirection ; }
 
   //--- Tell the view is opaque or not
   public : virtual bool isOpaque (void) const ;
+
+  public : virtual TTTileKind tileKind (void) const { return kTTSignalKind ; }
 };
 
 //-----------------------------------------------------------------------------
 typedef enum { kTTSemaphore, kTTRalentissement, kTTVoieLibre } TTSemaphoreState;
 
 //-----------------------------------------------------------------------------
-class TTSemaphoreF : public TTSignal
+static const int kTTMaxNumberOfSignals = 64 ;
+static const uint8_t kTTNoSignalId = 0xFF ;
+
+//-----------------------------------------------------------------------------
+class TTAbstractSemaphore : public TTSignal
 {
-  public : TTSemaphoreF (const AWPoint &inLocation, const bool inDirection) ;
-  
-  private : TTSemaphoreState mState ;
+  public : TTAbstractSemaphore (const AWRect &inFrame,
+                                const bool inDirection,
+                                const uint8_t inSignalId) ;
+  public : virtual ~TTAbstractSemaphore (void) ;
+
+  private : TTSemaphoreState mState : 2 ;
+  private : uint8_t mSignalId ;
   public : TTSemaphoreState state () const { return mState ; }
-  
+  public : uint8_t identifier () const { return mSignalId ; }
+
   public : void setState (const TTSemaphoreState inState) ;
-  
+
+  public : virtual void saveState (TTStateWriter & ioWriter) const ;
+  public : virtual void restoreState (TTStateReader & ioReader) ;
+
+  //--- static data and methods to handle the collection of signals
+  private : static TTAbstractSemaphore * sSignalForIdentifier[kTTMaxNumberOfSignals] ;
+  public : static TTSemaphoreState stateOfSignal (const uint8_t inSignalId) ;
+  public : static void setStateOfSignal (const uint8_t inSignalId, const TTSemaphoreState inState) ;
+  public : static bool signalExists (const uint8_t inSignalId) ;
+};
+
+//-----------------------------------------------------------------------------
+template <class M> class TTSemaphoreFT : public TTAbstractSemaphore
+{
+  public : TTSemaphoreFT (const AWPoint &inLocation,
+                          const bool inDirection,
+                          const uint8_t inSignalId = kTTNoSignalId) ;
+
   public : virtual void drawInRegion (const AWRegion & inDrawRegion) const ;
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
 };
 
+typedef TTSemaphoreFT <TTDefaultMetrics> TTSemaphoreF ;
+
 #endif /* TTSignal_h */
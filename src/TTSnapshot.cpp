@@ -0,0 +1,147 @@
+//
+//  TTSnapshot.cpp
+//  CocoaSimulator
+//
+
+#include "TTSnapshot.h"
+#include "TTSync.h"
+#include "TTGeneration.h"
+
+//-----------------------------------------------------------------------------
+static const uint8_t kSnapshotMagic = 'T' ;
+static const uint8_t kSnapshotVersion = 1 ;
+static const uint16_t kSnapshotHeaderLength = 4 ;
+
+//=============================================================================
+TTStateWriter::TTStateWriter (uint8_t * outBuffer, const uint16_t inSize) :
+mBuffer (outBuffer),
+mSize (inSize),
+mBitCount (0),
+mOverflow (false)
+{
+}
+
+//-----------------------------------------------------------------------------
+// With a NULL buffer, only the bits are counted
+void TTStateWriter::write (const uint8_t inValue, const uint8_t inBitCount)
+{
+  for (uint8_t bit = 0 ; bit < inBitCount ; bit++) {
+    const uint16_t byteIndex = mBitCount / 8 ;
+    if (mBuffer != NULL) {
+      if (byteIndex >= mSize) {
+        mOverflow = true ;
+        return ;
+      }
+      const uint8_t mask = 1 << (mBitCount % 8) ;
+      if (mBitCount % 8 == 0) {
+        mBuffer [byteIndex] = 0 ;
+      }
+      if ((inValue >> bit) & 1) {
+        mBuffer [byteIndex] |= mask ;
+      }
+    }
+    mBitCount++ ;
+  }
+}
+
+//=============================================================================
+TTStateReader::TTStateReader (const uint8_t * inBuffer, const uint16_t inLength) :
+mBuffer (inBuffer),
+mLength (inLength),
+mBitCount (0),
+mOverflow (false)
+{
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTStateReader::read (const uint8_t inBitCount)
+{
+  uint8_t result = 0 ;
+  for (uint8_t bit = 0 ; bit < inBitCount ; bit++) {
+    const uint16_t byteIndex = mBitCount / 8 ;
+    if (byteIndex >= mLength) {
+      mOverflow = true ;
+      return result ;
+    }
+    if ((mBuffer [byteIndex] >> (mBitCount % 8)) & 1) {
+      result |= 1 << bit ;
+    }
+    mBitCount++ ;
+  }
+  return result ;
+}
+
+//=============================================================================
+static uint16_t tileCount (void)
+{
+  uint16_t count = 0 ;
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    count++ ;
+  }
+  return count ;
+}
+
+//-----------------------------------------------------------------------------
+static uint16_t payloadLength (void)
+{
+  TTStateWriter counter (NULL, 0) ;
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    tile->saveState (counter) ;
+  }
+  return counter.length () ;
+}
+
+//-----------------------------------------------------------------------------
+static uint8_t crcOf (const uint8_t * inBuffer, const uint16_t inLength)
+{
+  uint8_t crc = 0 ;
+  for (uint16_t i = 0 ; i < inLength ; i++) {
+    crc = ttSyncCRC (crc, inBuffer [i]) ;
+  }
+  return crc ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTSnapshot::size (void)
+{
+  return kSnapshotHeaderLength + payloadLength () + 1 ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTSnapshot::save (uint8_t * outBuffer, const uint16_t inSize)
+{
+  if (inSize < kSnapshotHeaderLength + 1) return 0 ;
+  const uint16_t count = tileCount () ;
+  outBuffer [0] = kSnapshotMagic ;
+  outBuffer [1] = kSnapshotVersion ;
+  outBuffer [2] = count & 0xFF ;
+  outBuffer [3] = count >> 8 ;
+  TTStateWriter writer (outBuffer + kSnapshotHeaderLength, inSize - kSnapshotHeaderLength - 1) ;
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    tile->saveState (writer) ;
+  }
+  if (writer.overflow ()) return 0 ;
+  const uint16_t length = kSnapshotHeaderLength + writer.length () ;
+  outBuffer [length] = crcOf (outBuffer, length) ;
+  return length + 1 ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTSnapshot::restore (const uint8_t * inBuffer, const uint16_t inLength)
+{
+  if (inLength < kSnapshotHeaderLength + 1) return false ;
+  if (inBuffer [0] != kSnapshotMagic || inBuffer [1] != kSnapshotVersion) return false ;
+  const uint16_t count = inBuffer [2] | ((uint16_t)inBuffer [3] << 8) ;
+  if (count != tileCount ()) return false ;
+  const uint16_t length = inLength - 1 ;
+  if (length - kSnapshotHeaderLength != payloadLength ()) return false ;
+  if (crcOf (inBuffer, length) != inBuffer [length]) return false ;
+  TTStateReader reader (inBuffer + kSnapshotHeaderLength, length - kSnapshotHeaderLength) ;
+  for (TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    tile->restoreState (reader) ;
+  }
+#ifdef TT_GENERATION
+  TTGeneration::touchAll () ;
+#endif
+  return ! reader.overflow () ;
+}
@@ -0,0 +1,61 @@
+//
+//  TTSnapshot.h
+//  CocoaSimulator
+//
+//  Packing of the state of all the tiles into a few bytes, to be stored in
+//  EEPROM or flash and restored at power up before the first paint. Each
+//  tile writes its own bits, in construction order, so a snapshot can only
+//  be restored by the sketch that built it. The tile count and a CRC are
+//  checked before anything is restored.
+//
+//  Format: 'T' | version | tile count (2 bytes) | state bits | CRC-8
+//
+
+#ifndef TTSnapshot_h
+#define TTSnapshot_h
+
+#include "TTTrack.h"
+
+//-----------------------------------------------------------------------------
+class TTStateWriter {
+  public : TTStateWriter (uint8_t * outBuffer, const uint16_t inSize) ;
+
+  public : void write (const uint8_t inValue, const uint8_t inBitCount) ;
+
+  //--- Number of bytes used, the last one may be partial
+  public : uint16_t length (void) const { return (mBitCount + 7) / 8 ; }
+  public : bool overflow (void) const { return mOverflow ; }
+
+  private : uint8_t * mBuffer ;
+  private : uint16_t mSize ;
+  private : uint32_t mBitCount ;
+  private : bool mOverflow ;
+};
+
+//-----------------------------------------------------------------------------
+class TTStateReader {
+  public : TTStateReader (const uint8_t * inBuffer, const uint16_t inLength) ;
+
+  public : uint8_t read (const uint8_t inBitCount) ;
+  public : bool overflow (void) const { return mOverflow ; }
+
+  private : const uint8_t * mBuffer ;
+  private : uint16_t mLength ;
+  private : uint32_t mBitCount ;
+  private : bool mOverflow ;
+};
+
+//-----------------------------------------------------------------------------
+class TTSnapshot {
+  //--- Number of bytes of a snapshot of the current tiles
+  public : static uint16_t size (void) ;
+
+  //--- Returns the length of the snapshot, 0 if inSize is too small
+  public : static uint16_t save (uint8_t * outBuffer, const uint16_t inSize) ;
+
+  //--- Returns false, leaving the tiles unchanged, if the snapshot does not
+  //    match the current tiles
+  public : static bool restore (const uint8_t * inBuffer, const uint16_t inLength) ;
+};
+
+#endif /* TTSnapshot_h */
@@ -0,0 +1,419 @@
+//
+//  TTStress.cpp
+//  CocoaSimulator
+//
+
+#include "TTStress.h"
+
+#ifndef ARDUINO
+
+#include "TTSignal.h"
+#include "TTDisplay.h"
+#include "TTConfig.h"
+#include "TTArena.h"
+#include "Arduino.h"
+
+//--- Metrics of the tiles of the generated layouts
+typedef TTDefaultMetrics M ;
+
+//-----------------------------------------------------------------------------
+static uint32_t nextRandom (uint32_t & ioSeed)
+{
+  //--- xorshift32, the seed must not be 0
+  if (ioSeed == 0) ioSeed = 1 ;
+  ioSeed ^= ioSeed << 13 ;
+  ioSeed ^= ioSeed >> 17 ;
+  ioSeed ^= ioSeed << 5 ;
+  return ioSeed ;
+}
+
+//-----------------------------------------------------------------------------
+static void drawTile (const TTTile * inTile)
+{
+  const AWRegion region (inTile->absoluteFrame ()) ;
+  inTile->drawInRegion (region) ;
+}
+
+//=============================================================================
+TTLayoutGenerator::TTLayoutGenerator (void) :
+mTiles (NULL),
+mTileCount (0),
+mColumns (0),
+mRows (0),
+mPointCount (0),
+mDecouplerCount (0),
+mPointTiles (NULL),
+mPointTileCount (0)
+{
+  for (uint8_t i = 0 ; i < kTTMaxNumberOfPoints ; i++) {
+    mTileOfPoint [i] = NULL ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTLayoutGenerator::~TTLayoutGenerator (void)
+{
+  clear () ;
+}
+
+//-----------------------------------------------------------------------------
+void TTLayoutGenerator::clear (void)
+{
+  //--- Unlinked in one walk, the destructors then have nothing to look for
+  TTTile::removeFromTileList (mTiles, mTileCount) ;
+  for (uint16_t i = 0 ; i < mTileCount ; i++) {
+    delete mTiles [i] ;
+  }
+  delete [] mTiles ;
+  mTiles = NULL ;
+  mTileCount = 0 ;
+  delete [] mPointTiles ;
+  mPointTiles = NULL ;
+  mPointTileCount = 0 ;
+  mRows = 0 ;
+  mPointCount = 0 ;
+  mDecouplerCount = 0 ;
+  for (uint8_t i = 0 ; i < kTTMaxNumberOfPoints ; i++) {
+    mTileOfPoint [i] = NULL ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTLayoutGenerator::generate (const uint16_t inTileCount,
+                                  const AWInt inColumns,
+                                  const uint32_t inSeed)
+{
+  clear () ;
+  mTiles = new TTTile * [inTileCount] ;
+  mPointTiles = new PointTile [2 * (uint32_t)inTileCount] ;
+  mColumns = inColumns ;
+  uint32_t seed = inSeed ;
+  AWInt x = 0 ;
+  AWInt y = 0 ;
+  uint8_t pointId = 0 ;
+  uint8_t decouplerId = 0 ;
+  //--- The tiles are laid out in bands 3 tiles high
+  while (mTileCount < inTileCount) {
+    const uint32_t draw = nextRandom (seed) ;
+    const uint8_t kind = draw % 100 ;
+    const bool way = (draw >> 8) & 1 ;
+    AWInt width ;
+    if (kind < 30) {
+      width = 2 + (draw >> 9) % 4 ;  // Block
+    }
+    else if (kind < 40) {
+      width = 2 ;                    // Diagonal
+    }
+    else if (kind < 60) {
+      width = 2 ;                    // Point
+    }
+    else if (kind < 68) {
+      width = 2 ;                    // Double point
+    }
+    else if (kind < 73) {
+      width = 3 ;                    // Slip
+    }
+    else {
+      width = 1 ;                    // Decoupler, signal
+    }
+    if (x + width > inColumns) {
+      x = 0 ;
+      y += 3 ;
+    }
+    const AWPoint origin (x, y) ;
+    TTTile * tile ;
+    if (kind < 30) {
+      tile = new TTBlock (origin, width) ;
+    }
+    else if (kind < 40) {
+      tile = new TTDiag (origin, width, way) ;
+    }
+    else if (kind < 60) {
+      const uint8_t id = pointId < kTTMaxNumberOfPoints ? pointId++ : kTTMaxNumberOfPoints ;
+      TTPoint * point = new TTPoint (origin, id, way, kStraight, kStraight) ;
+      if (id < kTTMaxNumberOfPoints) mTileOfPoint [id] = point ;
+      addPointTile (point, id) ;
+      tile = point ;
+    }
+    else if (kind < 68) {
+      const uint8_t topId = pointId < kTTMaxNumberOfPoints ? pointId++ : kTTMaxNumberOfPoints ;
+      const uint8_t bottomId = pointId < kTTMaxNumberOfPoints ? pointId++ : kTTMaxNumberOfPoints ;
+      TTDoublePoint * point = new TTDoublePoint (origin, topId, bottomId, way) ;
+      if (topId < kTTMaxNumberOfPoints) mTileOfPoint [topId] = point ;
+      if (bottomId < kTTMaxNumberOfPoints) mTileOfPoint [bottomId] = point ;
+      //--- Unregistered, both halves answer to the same identifier
+      addPointTile (point, topId) ;
+      if (bottomId != topId) {
+        addPointTile (point, bottomId) ;
+      }
+      tile = point ;
+    }
+    else if (kind < 73) {
+      tile = new TTSlip (origin, kSlipLeft, way) ;
+    }
+    else if (kind < 85) {
+      const uint8_t id = decouplerId < kTTMaxNumberOfDecouplers ? decouplerId++ : kTTMaxNumberOfDecouplers ;
+      tile = new TTDecoupler (origin, id) ;
+    }
+    else {
+      tile = new TTSemaphoreF (origin, way) ;
+    }
+    mTiles [mTileCount++] = tile ;
+    x += width ;
+  }
+  mRows = y + 3 ;
+  mPointCount = pointId ;
+  mDecouplerCount = decouplerId ;
+}
+
+//-----------------------------------------------------------------------------
+void TTLayoutGenerator::addPointTile (TTAbstractPoint * inPoint, const uint8_t inPointId)
+{
+  mPointTiles [mPointTileCount].point = inPoint ;
+  mPointTiles [mPointTileCount].identifier = inPointId ;
+  mPointTileCount++ ;
+}
+
+//-----------------------------------------------------------------------------
+void TTLayoutGenerator::addToView (AWView * inView) const
+{
+  for (uint16_t i = 0 ; i < mTileCount ; i++) {
+    inView->addSubView (mTiles [i]) ;
+  }
+}
+
+//=============================================================================
+TTStressResult TTStressBenchmark::measure (const uint16_t inTileCount,
+                                           const AWInt inColumns,
+                                           const uint16_t inIterations,
+                                           const uint32_t inSeed)
+{
+  TTLayoutGenerator layout ;
+  layout.generate (inTileCount, inColumns, inSeed) ;
+  uint32_t seed = inSeed ;
+  TTStressResult result ;
+  result.tileCount = inTileCount ;
+  result.fullRepaint = fullRepaint (layout) ;
+  result.singlePointUpdate = singlePointUpdate (layout, inIterations, seed) ;
+  result.bulkFeedbackUpdate = bulkFeedbackUpdate (layout) ;
+  result.touchDispatch = touchDispatch (layout, inIterations, seed) ;
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTStressBenchmark::fullRepaint (const TTLayoutGenerator & inLayout)
+{
+  const uint32_t start = micros () ;
+  for (uint16_t i = 0 ; i < inLayout.tileCount () ; i++) {
+    drawTile (inLayout.tileAtIndex (i)) ;
+  }
+  return micros () - start ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTStressBenchmark::singlePointUpdate (const TTLayoutGenerator & inLayout,
+                                               const uint16_t inIterations,
+                                               uint32_t & ioSeed)
+{
+  if (inLayout.pointTileCount () == 0 || inIterations == 0) {
+    return 0 ;
+  }
+  const uint32_t start = micros () ;
+  for (uint16_t i = 0 ; i < inIterations ; i++) {
+    const uint16_t index = nextRandom (ioSeed) % inLayout.pointTileCount () ;
+    TTAbstractPoint * point = inLayout.pointTileAtIndex (index) ;
+    const uint8_t id = inLayout.pointIdAtIndex (index) ;
+    //--- The setter of the tile, the registered points go through it too
+    const TTPointPosition position =
+      point->actualPosition (id) == kStraightPosition ? kDiagonalPosition : kStraightPosition ;
+    point->setActualPosition (id, position) ;
+    drawTile (point) ;
+  }
+  return (micros () - start) / inIterations ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTStressBenchmark::bulkFeedbackUpdate (const TTLayoutGenerator & inLayout)
+{
+  const uint32_t start = micros () ;
+  for (uint16_t i = 0 ; i < inLayout.pointTileCount () ; i++) {
+    TTAbstractPoint * point = inLayout.pointTileAtIndex (i) ;
+    const uint8_t id = inLayout.pointIdAtIndex (i) ;
+    const TTPointPosition position =
+      point->actualPosition (id) == kStraightPosition ? kDiagonalPosition : kStraightPosition ;
+    point->setActualPosition (id, position) ;
+  }
+  //--- Every point changed, each tile is drawn once even when both halves
+  //    of a double point changed
+  for (uint16_t i = 0 ; i < inLayout.tileCount () ; i++) {
+    const TTTile * tile = inLayout.tileAtIndex (i) ;
+    const TTTileKind kind = tile->tileKind () ;
+    if (kind == kTTPointKind || kind == kTTDoublePointKind) {
+      drawTile (tile) ;
+    }
+  }
+  return micros () - start ;
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTStressBenchmark::touchDispatch (const TTLayoutGenerator & inLayout,
+                                           const uint16_t inIterations,
+                                           uint32_t & ioSeed)
+{
+  if (inLayout.tileCount () == 0 || inIterations == 0) {
+    return 0 ;
+  }
+  const AWInt width = inLayout.columns () * M::kGrid ;
+  const AWInt height = inLayout.rows () * M::kGrid ;
+  const uint32_t start = micros () ;
+  for (uint16_t i = 0 ; i < inIterations ; i++) {
+    const AWPoint touch (nextRandom (ioSeed) % width, nextRandom (ioSeed) % height) ;
+    //--- Hit test from the top: the last constructed tile is on top
+    TTTile * target = NULL ;
+    for (uint16_t t = inLayout.tileCount () ; t > 0 && target == NULL ; t--) {
+      if (inLayout.tileAtIndex (t - 1)->absoluteFrame ().containsPoint (touch)) {
+        target = inLayout.tileAtIndex (t - 1) ;
+      }
+    }
+    if (target != NULL) {
+      target->touchDown (touch) ;
+      target->touchUp (touch) ;
+    }
+  }
+  return (micros () - start) / inIterations ;
+}
+
+//-----------------------------------------------------------------------------
+TTMergeResult TTStressBenchmark::routeInvalidation (const TTLayoutGenerator & inLayout,
+                                                    const uint8_t inRouteLength,
+                                                    const uint16_t inSetupCost)
+{
+  //--- The display is never refreshed, it only collects the rectangles
+  TTDisplay display (NULL, AWRect (AWPoint (0, 0),
+                                   AWSize (inLayout.columns () * M::kGrid,
+                                           inLayout.rows () * M::kGrid))) ;
+  TTDirtyRegion & region = display.dirtyRegion () ;
+  region.setSetupCost (inSetupCost) ;
+  region.clear () ;
+  region.resetStatistics () ;
+  const uint8_t length = inRouteLength < inLayout.pointCount () ? inRouteLength : inLayout.pointCount () ;
+  const uint32_t start = micros () ;
+  for (uint8_t id = 0 ; id < length ; id++) {
+    const TTPointPosition position =
+      TTAbstractPoint::actualPositionOfPoint (id) == kStraightPosition ? kDiagonalPosition : kStraightPosition ;
+    TTAbstractPoint::setWishedPositionOfPoint (id, position) ;
+  }
+  for (uint8_t id = 0 ; id < length ; id++) {
+    TTAbstractPoint::setActualPositionOfPoint (id, TTAbstractPoint::wishedPositionOfPoint (id)) ;
+  }
+  TTMergeResult result ;
+  result.micros = micros () - start ;
+  result.invalidations = region.addedCount () ;
+  result.rects = region.count () ;
+  result.invalidatedPixels = region.addedPixels () ;
+  result.mergedPixels = region.pixels () ;
+  result.unmergedCost = region.addedPixels () + region.addedCount () * (uint32_t)inSetupCost ;
+  result.mergedCost = region.cost () ;
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+typedef struct {
+  const char * name ;
+  uint16_t width ;
+  uint16_t height ;
+} TTFillShape ;
+
+static const TTFillShape kTTFillShapes [kTTFillShapeCount] = {
+  { "straight track", M::kGrid, M::kStraightWidth },
+  { "diagonal column", 1, M::kDiagonalWidth },
+  { "block dash", (6 * M::kGrid) / 25, M::kStraightWidth },
+  { "button", M::kGrid - 2 * M::kMargin, M::kGrid - 2 * M::kMargin },
+  { "tile background", M::kGrid, M::kGrid },
+  { "long block", 5 * M::kGrid, M::kStraightWidth }
+} ;
+
+static const uint16_t kTTFillBufferWidth = 6 * M::kGrid ;
+static const uint16_t kTTFillBufferHeight = 2 * M::kGrid ;
+
+//--- Keeps the stores of the benchmark
+static volatile TTPixel gFillSink ;
+
+//-----------------------------------------------------------------------------
+TTFootprintResult TTStressBenchmark::footprint (const TTLayoutGenerator & inLayout)
+{
+  TTFootprintResult result ;
+  result.classSize [kTTViewKind] = sizeof (TTTile) ;
+  result.classSize [kTTTrackKind] = sizeof (TTTrack) ;
+  result.classSize [kTTBlockKind] = sizeof (TTBlock) ;
+  result.classSize [kTTPointKind] = sizeof (TTPoint) ;
+  result.classSize [kTTDoublePointKind] = sizeof (TTDoublePoint) ;
+  result.classSize [kTTSlipKind] = sizeof (TTSlip) ;
+  result.classSize [kTTDiagKind] = sizeof (TTDiag) ;
+  result.classSize [kTTArrowKind] = sizeof (TTArrow) ;
+  result.classSize [kTTBufferKind] = sizeof (TTBuffer) ;
+  result.classSize [kTTDecouplerKind] = sizeof (TTDecoupler) ;
+  result.classSize [kTTSignalKind] = sizeof (TTSemaphoreF) ;
+  for (uint8_t k = 0 ; k < kTTNumberOfTileKinds ; k++) {
+    result.classCount [k] = 0 ;
+  }
+  result.tileCount = inLayout.tileCount () ;
+  result.tileBytes = 0 ;
+  for (uint16_t i = 0 ; i < inLayout.tileCount () ; i++) {
+    const TTTileKind kind = inLayout.tileAtIndex (i)->tileKind () ;
+    result.classCount [kind]++ ;
+    result.tileBytes += TTArena::allocationSize (result.classSize [kind]) ;
+  }
+  result.linkBytes = (uint32_t)inLayout.tileCount () * sizeof (TTTile *) ;
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+static void scalarFill (TTPixel * outPixels,
+                        const AWRect & inRect,
+                        const TTPixel inPixel)
+{
+  for (AWInt y = inRect.origin.y ; y < inRect.origin.y + inRect.size.height ; y++) {
+    if (y >= 0 && y < kTTFillBufferHeight) {
+      const AWInt left = inRect.origin.x > 0 ? inRect.origin.x : 0 ;
+      const AWInt right = inRect.origin.x + inRect.size.width < kTTFillBufferWidth
+                        ? inRect.origin.x + inRect.size.width : kTTFillBufferWidth ;
+      for (AWInt x = left ; x < right ; x++) {
+        outPixels [(uint32_t)y * kTTFillBufferWidth + x] = inPixel ;
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTStressBenchmark::fillKernels (TTFillSample outSamples [kTTFillShapeCount],
+                                     const uint16_t inIterations)
+{
+  TTPixel * pixels = new TTPixel [(uint32_t)kTTFillBufferWidth * kTTFillBufferHeight] ;
+  for (uint8_t s = 0 ; s < kTTFillShapeCount ; s++) {
+    const TTFillShape & shape = kTTFillShapes [s] ;
+    //--- Odd origins, as the tiles produce, so the rows are not aligned
+    uint32_t start = micros () ;
+    for (uint16_t i = 0 ; i < inIterations ; i++) {
+      const AWRect r (AWPoint (1 + i % 3, 1 + i % 5), AWSize (shape.width, shape.height)) ;
+      scalarFill (pixels, r, (TTPixel)i) ;
+    }
+    const uint32_t scalar = micros () - start ;
+    gFillSink = pixels [kTTFillBufferWidth + 1] ;
+    start = micros () ;
+    for (uint16_t i = 0 ; i < inIterations ; i++) {
+      ttFillRect (pixels + (uint32_t)(1 + i % 5) * kTTFillBufferWidth + 1 + i % 3,
+                  kTTFillBufferWidth, shape.width, shape.height, (TTPixel)i) ;
+    }
+    const uint32_t kernel = micros () - start ;
+    gFillSink = pixels [kTTFillBufferWidth + 1] ;
+    outSamples [s].shape = shape.name ;
+    outSamples [s].width = shape.width ;
+    outSamples [s].height = shape.height ;
+    outSamples [s].scalar = scalar ;
+    outSamples [s].kernel = kernel ;
+  }
+  delete [] pixels ;
+}
+
+#endif
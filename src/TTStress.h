@@ -0,0 +1,161 @@
+//
+//  TTStress.h
+//  CocoaSimulator
+//
+//  Procedural generation of large layouts and measurement of how the
+//  library scales with the number of tiles. Host only, so the sketches do
+//  not carry the generator nor the benchmarks.
+//
+
+#ifndef TTStress_h
+#define TTStress_h
+
+#ifndef ARDUINO
+
+#include "TTTrack.h"
+#include "TTDirtyRegion.h"
+#include "TTFrameBuffer.h"
+
+//-----------------------------------------------------------------------------
+// Builds a layout of an arbitrary number of tiles mixing blocks, diagonals,
+// points, double points, slips, decouplers and signals. Points and
+// decouplers get consecutive identifiers until the registries are full,
+// the following ones are not registered. The benchmarks reach every point
+// through the list of the point tiles, so they scale with the layout
+// whatever the size of the registries.
+class TTLayoutGenerator {
+  public : TTLayoutGenerator (void) ;
+  public : ~TTLayoutGenerator (void) ;
+
+  public : void generate (const uint16_t inTileCount,
+                          const AWInt inColumns = 40,
+                          const uint32_t inSeed = 1) ;
+  public : void clear (void) ;
+  public : void addToView (AWView * inView) const ;
+
+  public : uint16_t tileCount (void) const { return mTileCount ; }
+  public : TTTile * tileAtIndex (const uint16_t inIndex) const { return mTiles [inIndex] ; }
+  public : AWInt columns (void) const { return mColumns ; }
+  public : AWInt rows (void) const { return mRows ; }
+
+  //--- Registered identifiers are 0 .. pointCount () - 1
+  public : uint8_t pointCount (void) const { return mPointCount ; }
+  public : TTTile * tileOfPoint (const uint8_t inPointId) const { return mTileOfPoint [inPointId] ; }
+  public : uint8_t decouplerCount (void) const { return mDecouplerCount ; }
+
+  //--- Every point of the layout with the identifier it answers to,
+  //    kTTMaxNumberOfPoints when it is not registered. A registered double
+  //    point appears twice, once per identifier
+  public : uint16_t pointTileCount (void) const { return mPointTileCount ; }
+  public : TTAbstractPoint * pointTileAtIndex (const uint16_t inIndex) const { return mPointTiles [inIndex].point ; }
+  public : uint8_t pointIdAtIndex (const uint16_t inIndex) const { return mPointTiles [inIndex].identifier ; }
+
+  private : TTTile ** mTiles ;
+  private : uint16_t mTileCount ;
+  private : AWInt mColumns ;
+  private : AWInt mRows ;
+  private : uint8_t mPointCount ;
+  private : uint8_t mDecouplerCount ;
+  private : TTTile * mTileOfPoint [kTTMaxNumberOfPoints] ;
+  private : typedef struct {
+    TTAbstractPoint * point ;
+    uint8_t identifier ;
+  } PointTile ;
+  private : PointTile * mPointTiles ;
+  private : uint16_t mPointTileCount ;
+  private : void addPointTile (TTAbstractPoint * inPoint, const uint8_t inPointId) ;
+
+  private : TTLayoutGenerator (const TTLayoutGenerator &) ;
+  private : TTLayoutGenerator & operator = (const TTLayoutGenerator &) ;
+};
+
+//-----------------------------------------------------------------------------
+// Times in microseconds. Update and touch times are averages per operation.
+typedef struct {
+  uint16_t tileCount ;
+  uint32_t fullRepaint ;
+  uint32_t singlePointUpdate ;
+  uint32_t bulkFeedbackUpdate ;
+  uint32_t touchDispatch ;
+} TTStressResult ;
+
+//-----------------------------------------------------------------------------
+// Invalidations of a route, as seen by a TTDisplay covering the layout.
+// Costs in pixels, see TTDirtyRegion. The time is the one of the route,
+// invalidations and merges included, in microseconds.
+typedef struct {
+  uint16_t invalidations ;
+  uint8_t rects ;
+  uint32_t invalidatedPixels ;
+  uint32_t mergedPixels ;
+  uint32_t unmergedCost ;
+  uint32_t mergedCost ;
+  uint32_t micros ;
+} TTMergeResult ;
+
+//-----------------------------------------------------------------------------
+// Fill of inIterations rectangles of a shape drawn by the tiles, with a
+// pixel per pixel loop clipping each row and with ttFillRect, in
+// microseconds.
+typedef struct {
+  const char * shape ;
+  uint16_t width ;
+  uint16_t height ;
+  uint32_t scalar ;
+  uint32_t kernel ;
+} TTFillSample ;
+
+static const uint8_t kTTFillShapeCount = 6 ;
+
+//-----------------------------------------------------------------------------
+// RAM of the tiles of a layout, in bytes. The sizes are the sizeof of the
+// classes at the default scale, kTTViewKind giving the one of TTTile. A
+// tile takes its size rounded as TTArena rounds it. linkBytes is the part
+// of tileBytes spent on the list of all the tiles (TTTile::nextTile).
+typedef struct {
+  uint16_t classSize [kTTNumberOfTileKinds] ;
+  uint16_t classCount [kTTNumberOfTileKinds] ;
+  uint16_t tileCount ;
+  uint32_t tileBytes ;
+  uint32_t linkBytes ;
+} TTFootprintResult ;
+
+//-----------------------------------------------------------------------------
+class TTStressBenchmark {
+  //--- Generates a layout of inTileCount tiles and runs all the measures
+  public : static TTStressResult measure (const uint16_t inTileCount,
+                                          const AWInt inColumns = 40,
+                                          const uint16_t inIterations = 100,
+                                          const uint32_t inSeed = 1) ;
+
+  //--- Draw every tile once
+  public : static uint32_t fullRepaint (const TTLayoutGenerator & inLayout) ;
+  //--- Change the actual position of one random point of the layout and
+  //    redraw it
+  public : static uint32_t singlePointUpdate (const TTLayoutGenerator & inLayout,
+                                              const uint16_t inIterations,
+                                              uint32_t & ioSeed) ;
+  //--- Position feedback of every point at once, then redraw the point
+  //    tiles. The touch feedback of the buttons is left alone
+  public : static uint32_t bulkFeedbackUpdate (const TTLayoutGenerator & inLayout) ;
+  //--- Find the topmost tile under a random touch, the last constructed
+  //    one as in TTViewport and TTJournalReplay, and send it touchDown /
+  //    touchUp
+  public : static uint32_t touchDispatch (const TTLayoutGenerator & inLayout,
+                                          const uint16_t inIterations,
+                                          uint32_t & ioSeed) ;
+  //--- Wish then feedback for the first inRouteLength points, as when a
+  //    route is set
+  public : static TTMergeResult routeInvalidation (const TTLayoutGenerator & inLayout,
+                                                   const uint8_t inRouteLength = 12,
+                                                   const uint16_t inSetupCost = TTDirtyRegion::kDefaultSetupCost) ;
+  //--- Size of every tile class and bytes taken by the tiles of the layout
+  public : static TTFootprintResult footprint (const TTLayoutGenerator & inLayout) ;
+  //--- One sample per shape
+  public : static void fillKernels (TTFillSample outSamples [kTTFillShapeCount],
+                                    const uint16_t inIterations = 1000) ;
+};
+
+#endif
+
+#endif /* TTStress_h */
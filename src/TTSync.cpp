@@ -0,0 +1,309 @@
+//
+//  TTSync.cpp
+//  CocoaSimulator
+//
+
+#include "TTSync.h"
+#include "TTGeneration.h"
+
+//-----------------------------------------------------------------------------
+uint8_t ttSyncCRC (const uint8_t inCRC, const uint8_t inByte)
+{
+  uint8_t crc = inCRC ^ inByte ;
+  for (uint8_t bit = 0 ; bit < 8 ; bit++) {
+    crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1) ;
+  }
+  return crc ;
+}
+
+//-----------------------------------------------------------------------------
+static uint8_t closeFrame (uint8_t * ioFrame, const uint8_t inLength)
+{
+  uint8_t crc = 0 ;
+  for (uint8_t i = 1 ; i < inLength ; i++) {
+    crc = ttSyncCRC (crc, ioFrame [i]) ;
+  }
+  ioFrame [inLength] = crc ;
+  return inLength + 1 ;
+}
+
+//=============================================================================
+TTSyncEncoder::TTSyncEncoder (const uint8_t inContents,
+                              const uint16_t inSnapshotPeriod) :
+mContents (inContents),
+mSnapshotPeriod (inSnapshotPeriod),
+mFramesSinceSnapshot (0),
+mSnapshotInProgress (true),
+mSnapshotCursor (0),
+mSequence (0)
+{
+#ifdef TT_GENERATION
+  mGeneration = 0 ;
+#endif
+  for (uint16_t i = 0 ; i < kTTSyncNumberOfKinds * kTTSyncMaxIdentifiers ; i++) {
+    mShadow [i] = kTTSyncUnknown ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTSyncEncoder::requestSnapshot (void)
+{
+  mSnapshotInProgress = true ;
+  mSnapshotCursor = 0 ;
+#ifdef TT_GENERATION
+  //--- The changes made while the snapshot is sent go in the next deltas
+  mGeneration = TTGeneration::current () ;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+void TTSyncEncoder::setShadow (const TTSyncRecordKind inKind,
+                               const uint8_t inIdentifier,
+                               const uint8_t inValue)
+{
+  if (inKind < kTTSyncNumberOfKinds && inIdentifier < kTTSyncMaxIdentifiers) {
+    mShadow [inKind * kTTSyncMaxIdentifiers + inIdentifier] = inValue ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTSyncEncoder::currentValue (const uint8_t inEntry) const
+{
+  const uint8_t kind = inEntry / kTTSyncMaxIdentifiers ;
+  const uint8_t identifier = inEntry % kTTSyncMaxIdentifiers ;
+  if ((mContents & (1 << kind)) == 0) {
+    return kTTSyncUnknown ;
+  }
+  switch (kind) {
+    case kTTSyncPointActual :
+      return TTAbstractPoint::pointExists (identifier) ?
+        (uint8_t)TTAbstractPoint::actualPositionOfPoint (identifier) : kTTSyncUnknown ;
+    case kTTSyncPointWished :
+      return TTAbstractPoint::pointExists (identifier) ?
+        (uint8_t)TTAbstractPoint::wishedPositionOfPoint (identifier) : kTTSyncUnknown ;
+    case kTTSyncDecoupler :
+      return TTAbstractDecoupler::decouplerExists (identifier) ?
+        (uint8_t)TTAbstractDecoupler::positionOfDecoupler (identifier) : kTTSyncUnknown ;
+    case kTTSyncSignal :
+      return TTAbstractSemaphore::signalExists (identifier) ?
+        (uint8_t)TTAbstractSemaphore::stateOfSignal (identifier) : kTTSyncUnknown ;
+    default :
+      return kTTSyncUnknown ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTSyncEncoder::encode (uint8_t * outFrame)
+{
+  if (! mSnapshotInProgress && mSnapshotPeriod > 0 && mFramesSinceSnapshot >= mSnapshotPeriod) {
+    requestSnapshot () ;
+  }
+  const bool snapshot = mSnapshotInProgress ;
+  const uint16_t entryCount = kTTSyncNumberOfKinds * kTTSyncMaxIdentifiers ;
+  uint8_t * keys = outFrame + 4 ;
+  uint8_t values [kTTSyncMaxRecords] ;
+  uint8_t count = 0 ;
+  if (snapshot) {
+    while (mSnapshotCursor < entryCount && count < kTTSyncMaxRecords) {
+      const uint8_t value = currentValue ((uint8_t)mSnapshotCursor) ;
+      if (value != kTTSyncUnknown) {
+        keys [count] = (uint8_t)mSnapshotCursor ;
+        values [count] = value ;
+        mShadow [mSnapshotCursor] = value ;
+        count++ ;
+      }
+      mSnapshotCursor++ ;
+    }
+    if (mSnapshotCursor == entryCount) {
+      mSnapshotInProgress = false ;
+      mFramesSinceSnapshot = 0 ;
+    }
+  }
+  else {
+    mFramesSinceSnapshot++ ;
+#ifdef TT_GENERATION
+    //--- Only the objects changed since the previous delta are compared to
+    //    the shadow. The walk goes from the newest change to the oldest, so
+    //    when the frame is full the next delta walks from the same
+    //    generation: the objects already sent match their shadow
+    uint32_t reached = TTGeneration::current () ;
+    for (TTChangedObjects changed (mGeneration) ; changed.next () ; ) {
+      uint8_t entries [2] ;
+      uint8_t recordCount = 0 ;
+      switch (changed.kind ()) {
+        case kTTPointObject :
+          entries [recordCount++] = kTTSyncPointActual * kTTSyncMaxIdentifiers + changed.identifier () ;
+          entries [recordCount++] = kTTSyncPointWished * kTTSyncMaxIdentifiers + changed.identifier () ;
+          break ;
+        case kTTDecouplerObject :
+          entries [recordCount++] = kTTSyncDecoupler * kTTSyncMaxIdentifiers + changed.identifier () ;
+          break ;
+        case kTTSignalObject :
+          entries [recordCount++] = kTTSyncSignal * kTTSyncMaxIdentifiers + changed.identifier () ;
+          break ;
+        default :
+          break ;
+      }
+      if (count + recordCount > kTTSyncMaxRecords) {
+        reached = mGeneration ;
+        break ;
+      }
+      for (uint8_t i = 0 ; i < recordCount ; i++) {
+        const uint8_t entry = entries [i] ;
+        const uint8_t value = currentValue (entry) ;
+        if (value != kTTSyncUnknown && value != mShadow [entry]) {
+          keys [count] = entry ;
+          values [count] = value ;
+          mShadow [entry] = value ;
+          count++ ;
+        }
+      }
+    }
+    mGeneration = reached ;
+#else
+    //--- Every object is compared to the shadow
+    for (uint16_t entry = 0 ; entry < entryCount && count < kTTSyncMaxRecords ; entry++) {
+      const uint8_t value = currentValue ((uint8_t)entry) ;
+      if (value != kTTSyncUnknown && value != mShadow [entry]) {
+        keys [count] = (uint8_t)entry ;
+        values [count] = value ;
+        mShadow [entry] = value ;
+        count++ ;
+      }
+    }
+#endif
+  }
+  if (count == 0) {
+    return 0 ;
+  }
+  else {
+    outFrame [0] = kTTSyncStartByte ;
+    outFrame [1] = snapshot ? kTTSyncSnapshot : kTTSyncDelta ;
+    outFrame [2] = mSequence ;
+    outFrame [3] = count ;
+    mSequence++ ;
+    uint8_t length = 4 + count ;
+    for (uint8_t i = 0 ; i < count ; i += 4) {
+      uint8_t packed = 0 ;
+      for (uint8_t j = 0 ; j < 4 && i + j < count ; j++) {
+        packed |= (values [i + j] & 0x3) << (2 * j) ;
+      }
+      outFrame [length] = packed ;
+      length++ ;
+    }
+    return closeFrame (outFrame, length) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTSyncEncoder::encodeSnapshotRequest (uint8_t * outFrame)
+{
+  outFrame [0] = kTTSyncStartByte ;
+  outFrame [1] = kTTSyncSnapshotRequest ;
+  outFrame [2] = 0 ;
+  outFrame [3] = 0 ;
+  return closeFrame (outFrame, 4) ;
+}
+
+//=============================================================================
+TTSyncDecoder::TTSyncDecoder (void) :
+mEncoder (NULL),
+mLength (0),
+mExpectedLength (0),
+mExpectedSequence (0),
+mSynchronized (false),
+mSnapshotRequested (false),
+mLostFrames (false),
+mFrameCount (0),
+mCRCErrorCount (0),
+mLostFrameCount (0)
+{
+}
+
+//-----------------------------------------------------------------------------
+bool TTSyncDecoder::receive (const uint8_t inByte)
+{
+  bool result = false ;
+  if (mLength == 0) {
+    if (inByte == kTTSyncStartByte) {
+      mFrame [0] = inByte ;
+      mLength = 1 ;
+    }
+  }
+  else {
+    mFrame [mLength] = inByte ;
+    mLength++ ;
+    if (mLength == 4) {
+      const uint8_t type = mFrame [1] ;
+      const uint8_t count = mFrame [3] ;
+      if (type < kTTSyncDelta || type > kTTSyncSnapshotRequest || count > kTTSyncMaxRecords) {
+        //--- Not a frame, wait for the next start byte
+        mLength = 0 ;
+      }
+      else {
+        mExpectedLength = 4 + count + (count + 3) / 4 + 1 ;
+      }
+    }
+    if (mLength > 4 && mLength == mExpectedLength) {
+      uint8_t crc = 0 ;
+      for (uint8_t i = 1 ; i < mLength - 1 ; i++) {
+        crc = ttSyncCRC (crc, mFrame [i]) ;
+      }
+      if (crc == mFrame [mLength - 1]) {
+        apply () ;
+        mFrameCount++ ;
+        result = true ;
+      }
+      else {
+        mCRCErrorCount++ ;
+      }
+      mLength = 0 ;
+    }
+  }
+  return result ;
+}
+
+//-----------------------------------------------------------------------------
+void TTSyncDecoder::apply (void)
+{
+  const uint8_t type = mFrame [1] ;
+  if (type == kTTSyncSnapshotRequest) {
+    mSnapshotRequested = true ;
+  }
+  else {
+    const uint8_t sequence = mFrame [2] ;
+    if (mSynchronized && sequence != mExpectedSequence) {
+      mLostFrameCount += (uint8_t)(sequence - mExpectedSequence) ;
+      mLostFrames = true ;
+    }
+    mSynchronized = true ;
+    mExpectedSequence = sequence + 1 ;
+    const uint8_t count = mFrame [3] ;
+    const uint8_t * keys = mFrame + 4 ;
+    const uint8_t * values = keys + count ;
+    for (uint8_t i = 0 ; i < count ; i++) {
+      const TTSyncRecordKind kind = (TTSyncRecordKind)(keys [i] / kTTSyncMaxIdentifiers) ;
+      const uint8_t identifier = keys [i] % kTTSyncMaxIdentifiers ;
+      const uint8_t value = (values [i / 4] >> (2 * (i % 4))) & 0x3 ;
+      if (mEncoder != NULL) {
+        mEncoder->setShadow (kind, identifier, value) ;
+      }
+      switch (kind) {
+        case kTTSyncPointActual :
+          TTAbstractPoint::setActualPositionOfPoint (identifier, (TTPointPosition)value) ;
+          break ;
+        case kTTSyncPointWished :
+          TTAbstractPoint::setWishedPositionOfPoint (identifier, (TTPointPosition)value, kTTSyncSource) ;
+          break ;
+        case kTTSyncDecoupler :
+          TTAbstractDecoupler::setPositionOfDecoupler (identifier, value != 0, kTTSyncSource) ;
+          break ;
+        case kTTSyncSignal :
+          TTAbstractSemaphore::setStateOfSignal (identifier, (TTSemaphoreState)value) ;
+          break ;
+        default :
+          break ;
+      }
+    }
+  }
+}
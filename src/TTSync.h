@@ -0,0 +1,138 @@
+//
+//  TTSync.h
+//  CocoaSimulator
+//
+//  Binary protocol to keep the state of two boards in sync over a serial
+//  link. Only the changes are sent, with a sequence number, a CRC and a
+//  full snapshot every few frames so a lost frame is recovered.
+//
+//  Frame:  0xA5 | type | sequence | n | n keys | (n + 3) / 4 values | CRC-8
+//  key:    record kind (2 bits) | identifier (6 bits)
+//  values: 2 bits per record, the first record in the low bits
+//  CRC-8:  polynomial 0x07 over type .. values
+//
+//  The encoder and the decoder work on byte buffers, any stream fits: a
+//  UART on the boards, a pty pair on the host (see TTSyncPty.h).
+//
+//  The decoder applies the values with kTTSyncSource: the action of the
+//  points is not sent and TTMotorScheduler does not queue a command, the
+//  board the change comes from drives its motors itself.
+//
+
+#ifndef TTSync_h
+#define TTSync_h
+
+#include "TTTrack.h"
+#include "TTSignal.h"
+
+//-----------------------------------------------------------------------------
+typedef enum {
+  kTTSyncPointActual,
+  kTTSyncPointWished,
+  kTTSyncDecoupler,
+  kTTSyncSignal,
+  kTTSyncNumberOfKinds
+} TTSyncRecordKind ;
+
+typedef enum {
+  kTTSyncDelta = 1,
+  kTTSyncSnapshot = 2,
+  kTTSyncSnapshotRequest = 3
+} TTSyncFrameType ;
+
+//--- Contents of an encoder
+static const uint8_t kTTSyncPointActualMask = 1 << kTTSyncPointActual ;
+static const uint8_t kTTSyncPointWishedMask = 1 << kTTSyncPointWished ;
+static const uint8_t kTTSyncDecouplerMask = 1 << kTTSyncDecoupler ;
+static const uint8_t kTTSyncSignalMask = 1 << kTTSyncSignal ;
+
+static const uint8_t kTTSyncStartByte = 0xA5 ;
+static const uint8_t kTTSyncUnknown = 0xFF ;
+static const uint8_t kTTSyncMaxIdentifiers = 64 ;
+static const uint8_t kTTSyncMaxRecords = 64 ;
+static const uint8_t kTTSyncMaxFrameSize = 4 + kTTSyncMaxRecords + kTTSyncMaxRecords / 4 + 1 ;
+
+//-----------------------------------------------------------------------------
+uint8_t ttSyncCRC (const uint8_t inCRC, const uint8_t inByte) ;
+
+//-----------------------------------------------------------------------------
+// Sends the state of the local tiles. encode () is called periodically, it
+// fills a frame with the values that changed since the previous frame and
+// returns its length, 0 when there is nothing to send.
+class TTSyncEncoder {
+  public : TTSyncEncoder (const uint8_t inContents,
+                          const uint16_t inSnapshotPeriod = 50) ;
+
+  public : uint8_t encode (uint8_t * outFrame) ;
+  public : static uint8_t encodeSnapshotRequest (uint8_t * outFrame) ;
+
+  //--- The next frames carry every value
+  public : void requestSnapshot (void) ;
+
+  //--- Value known by the other side, set by the decoder of this side so
+  //    the values it applies are not sent back
+  public : void setShadow (const TTSyncRecordKind inKind,
+                           const uint8_t inIdentifier,
+                           const uint8_t inValue) ;
+
+  private : uint8_t currentValue (const uint8_t inEntry) const ;
+
+  private : uint8_t mContents ;
+  private : uint16_t mSnapshotPeriod ;
+  private : uint16_t mFramesSinceSnapshot ;
+  private : bool mSnapshotInProgress ;
+  private : uint16_t mSnapshotCursor ;
+  private : uint8_t mSequence ;
+  //--- The delta frames look at the objects changed after this generation,
+  //    without TT_GENERATION they compare every object with the shadow
+#ifdef TT_GENERATION
+  private : uint32_t mGeneration ;
+#endif
+  //--- Last value sent for each kind and identifier, kTTSyncUnknown at start
+  private : uint8_t mShadow [kTTSyncNumberOfKinds * kTTSyncMaxIdentifiers] ;
+
+  //--- No copy
+  private : TTSyncEncoder (const TTSyncEncoder &) ;
+  private : TTSyncEncoder & operator = (const TTSyncEncoder &) ;
+};
+
+//-----------------------------------------------------------------------------
+// Applies the frames received from the other side, fed one byte at a time.
+class TTSyncDecoder {
+  public : TTSyncDecoder (void) ;
+
+  //--- Returns true when the byte completes a valid frame
+  public : bool receive (const uint8_t inByte) ;
+
+  //--- Encoder of this side, its shadow is updated with the applied values
+  public : void setEncoder (TTSyncEncoder * inEncoder) { mEncoder = inEncoder ; }
+
+  //--- The other side sent a snapshot request: requestSnapshot () on the
+  //    encoder of this side
+  public : bool snapshotRequested (void) const { return mSnapshotRequested ; }
+  public : void clearSnapshotRequest (void) { mSnapshotRequested = false ; }
+  //--- A frame is missing: send a snapshot request to the other side
+  public : bool lostFrames (void) const { return mLostFrames ; }
+  public : void clearLostFrames (void) { mLostFrames = false ; }
+
+  //--- Statistics
+  public : uint32_t frameCount (void) const { return mFrameCount ; }
+  public : uint32_t crcErrorCount (void) const { return mCRCErrorCount ; }
+  public : uint32_t lostFrameCount (void) const { return mLostFrameCount ; }
+
+  private : void apply (void) ;
+
+  private : TTSyncEncoder * mEncoder ;
+  private : uint8_t mFrame [kTTSyncMaxFrameSize] ;
+  private : uint8_t mLength ;
+  private : uint8_t mExpectedLength ;
+  private : uint8_t mExpectedSequence ;
+  private : bool mSynchronized ;
+  private : bool mSnapshotRequested ;
+  private : bool mLostFrames ;
+  private : uint32_t mFrameCount ;
+  private : uint32_t mCRCErrorCount ;
+  private : uint32_t mLostFrameCount ;
+};
+
+#endif /* TTSync_h */
@@ -0,0 +1,196 @@
+//
+//  TTSyncPty.cpp
+//  CocoaSimulator
+//
+//  Host harness of the sync protocol over a pty pair.
+//
+
+#include "TTSyncPty.h"
+
+#if defined (__unix__) || defined (__APPLE__)
+
+#include "TTMotor.h"
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+//=============================================================================
+TTSyncPty::TTSyncPty (void) :
+mMaster (-1),
+mSlave (-1)
+{
+}
+
+//-----------------------------------------------------------------------------
+TTSyncPty::~TTSyncPty (void)
+{
+  close () ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTSyncPty::open (void)
+{
+  close () ;
+  mMaster = posix_openpt (O_RDWR | O_NOCTTY) ;
+  bool ok = mMaster >= 0 ;
+  if (ok) {
+    ok = grantpt (mMaster) == 0 && unlockpt (mMaster) == 0 ;
+  }
+  if (ok) {
+    const char * name = ptsname (mMaster) ;
+    mSlave = (name == NULL) ? -1 : ::open (name, O_RDWR | O_NOCTTY | O_NONBLOCK) ;
+    ok = mSlave >= 0 ;
+  }
+  //--- Raw on both sides: no echo, no line buffering, no CR/LF mapping of
+  //    the binary frames
+  struct termios attributes ;
+  if (ok) {
+    ok = tcgetattr (mSlave, & attributes) == 0 ;
+  }
+  if (ok) {
+    cfmakeraw (& attributes) ;
+    ok = tcsetattr (mSlave, TCSANOW, & attributes) == 0 ;
+  }
+  if (ok && tcgetattr (mMaster, & attributes) == 0) {
+    cfmakeraw (& attributes) ;
+    tcsetattr (mMaster, TCSANOW, & attributes) ;
+  }
+  if (! ok) {
+    close () ;
+  }
+  return ok ;
+}
+
+//-----------------------------------------------------------------------------
+void TTSyncPty::close (void)
+{
+  if (mSlave >= 0) {
+    ::close (mSlave) ;
+    mSlave = -1 ;
+  }
+  if (mMaster >= 0) {
+    ::close (mMaster) ;
+    mMaster = -1 ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+const char * TTSyncPty::slaveName (void) const
+{
+  return (mMaster >= 0) ? ptsname (mMaster) : NULL ;
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTSyncPty::send (TTSyncEncoder & ioEncoder)
+{
+  uint8_t frame [kTTSyncMaxFrameSize] ;
+  const uint8_t length = isOpen () ? ioEncoder.encode (frame) : 0 ;
+  uint8_t written = 0 ;
+  while (written < length) {
+    const ssize_t n = write (mMaster, frame + written, length - written) ;
+    if (n <= 0) {
+      break ;
+    }
+    written += (uint8_t)n ;
+  }
+  return written ;
+}
+
+//-----------------------------------------------------------------------------
+uint16_t TTSyncPty::receive (TTSyncDecoder & ioDecoder)
+{
+  uint16_t frames = 0 ;
+  uint8_t buffer [kTTSyncMaxFrameSize] ;
+  ssize_t n = isOpen () ? read (mSlave, buffer, sizeof (buffer)) : 0 ;
+  while (n > 0) {
+    for (ssize_t i = 0 ; i < n ; i++) {
+      if (ioDecoder.receive (buffer [i])) {
+        frames++ ;
+      }
+    }
+    n = read (mSlave, buffer, sizeof (buffer)) ;
+  }
+  return frames ;
+}
+
+//=============================================================================
+static uint8_t sActionCount ;
+static uint8_t sMotorCount ;
+
+//-----------------------------------------------------------------------------
+static void countAction (AWView * /* inSender */)
+{
+  sActionCount++ ;
+}
+
+//-----------------------------------------------------------------------------
+static void countMotor (const uint8_t /* inPointId */,
+                        const TTPointPosition /* inPosition */,
+                        void * /* inContext */)
+{
+  sMotorCount++ ;
+}
+
+//-----------------------------------------------------------------------------
+uint8_t TTSyncPty::selfTest (void)
+{
+  uint8_t failures = 0 ;
+  uint8_t pointId = kTTMaxNumberOfPoints ;
+  while (pointId > 0 && TTAbstractPoint::pointExists (pointId - 1)) {
+    pointId-- ;
+  }
+  TTSyncPty pty ;
+  if (pointId == 0 || pointId > kTTSyncMaxIdentifiers || ! pty.open ()) {
+    failures++ ;
+  }
+  else {
+    pointId-- ;
+    TTPoint point (AWPoint (0, 0), pointId, false, false, false) ;
+    TTAbstractPoint::setActionOfPoint (pointId, countAction) ;
+    TTMotorScheduler scheduler (countMotor) ;
+    const bool attached = scheduler.attach () ;
+    TTSyncEncoder encoder (kTTSyncPointWishedMask, 0) ;
+    TTSyncDecoder decoder ;
+    //--- Both sides start from the same snapshot
+    pty.send (encoder) ;
+    pty.receive (decoder) ;
+    //--- The wish made on this side is encoded, then reverted locally so
+    //    the decoder has something to apply
+    TTAbstractPoint::setWishedPositionOfPoint (pointId, kDiagonalPosition) ;
+    if (pty.send (encoder) == 0) {
+      failures++ ;
+    }
+    TTAbstractPoint::setWishedPositionOfPoint (pointId, kStraightPosition) ;
+    scheduler.cancelAll () ;
+    sActionCount = 0 ;
+    sMotorCount = 0 ;
+    if (pty.receive (decoder) != 1) {
+      failures++ ;
+    }
+    if (TTAbstractPoint::wishedPositionOfPoint (pointId) != kDiagonalPosition) {
+      failures++ ;
+    }
+    if (sActionCount != 0) {
+      failures++ ;
+    }
+    if (attached && scheduler.queueDepth () != 0) {
+      failures++ ;
+    }
+    scheduler.run () ;
+    if (sMotorCount != 0) {
+      failures++ ;
+    }
+    if (decoder.crcErrorCount () != 0 || decoder.lostFrameCount () != 0) {
+      failures++ ;
+    }
+    if (attached) {
+      scheduler.detach () ;
+    }
+    TTAbstractPoint::setActionOfPoint (pointId, NULL) ;
+  }
+  return failures ;
+}
+
+#endif
@@ -0,0 +1,53 @@
+//
+//  TTSyncPty.h
+//  CocoaSimulator
+//
+//  Host harness of the sync protocol. A pty pair stands for the serial
+//  link: the frames of an encoder are written to the master side and the
+//  bytes read from the slave side are fed to a decoder, through the same
+//  raw line discipline as a USB serial adapter. The slave name may also be
+//  given to another program which plays the other board. POSIX hosts only.
+//
+
+#ifndef TTSyncPty_h
+#define TTSyncPty_h
+
+#include "TTSync.h"
+
+#if defined (__unix__) || defined (__APPLE__)
+
+//-----------------------------------------------------------------------------
+class TTSyncPty {
+  public : TTSyncPty (void) ;
+  public : ~TTSyncPty (void) ;
+
+  //--- Opens the pair in raw mode, returns false on failure
+  public : bool open (void) ;
+  public : void close (void) ;
+  public : bool isOpen (void) const { return mMaster >= 0 ; }
+  public : const char * slaveName (void) const ;
+
+  //--- Encodes one frame and writes it to the master side, returns its
+  //    length, 0 when there was nothing to send
+  public : uint8_t send (TTSyncEncoder & ioEncoder) ;
+  //--- Feeds the bytes waiting on the slave side to the decoder, returns
+  //    the number of valid frames
+  public : uint16_t receive (TTSyncDecoder & ioDecoder) ;
+
+  //--- A wish encoded on one side, pumped through the pty and applied by
+  //    the decoder must change the point without sending its action and
+  //    without queueing a command in a TTMotorScheduler. Returns the
+  //    number of failed checks. Uses the highest free point identifier.
+  public : static uint8_t selfTest (void) ;
+
+  private : int mMaster ;
+  private : int mSlave ;
+
+  //--- No copy
+  private : TTSyncPty (const TTSyncPty &) ;
+  private : TTSyncPty & operator = (const TTSyncPty &) ;
+};
+
+#endif
+
+#endif /* TTSyncPty_h */
@@ -0,0 +1,189 @@
+//
+//  TTTimeout.cpp
+//  CocoaSimulator
+//
+
+#include "TTTimeout.h"
+#include "Arduino.h"
+
+#ifdef TT_WISH_TIMEOUT
+
+//-----------------------------------------------------------------------------
+TTTimingWheel::TTTimingWheel (void) :
+mCurrentTick (0),
+mCount (0)
+{
+  for (uint8_t i = 0 ; i < 2 * kSlots ; i++) {
+    mHeads [i] = kNone ;
+  }
+  for (uint8_t i = 0 ; i < kTTMaxTimers ; i++) {
+    mSlot [i] = kNone ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTTimingWheel::insert (const uint8_t inTimerId)
+{
+  const uint32_t delta = mExpiry [inTimerId] - mCurrentTick ;
+  const uint8_t slot = delta < kSlots ?
+    (uint8_t)(mExpiry [inTimerId] % kSlots) :
+    (uint8_t)(kSlots + (mExpiry [inTimerId] / kSlots) % kSlots) ;
+  mSlot [inTimerId] = slot ;
+  mPrevious [inTimerId] = kNone ;
+  mNext [inTimerId] = mHeads [slot] ;
+  if (mHeads [slot] != kNone) {
+    mPrevious [mHeads [slot]] = inTimerId ;
+  }
+  mHeads [slot] = inTimerId ;
+}
+
+//-----------------------------------------------------------------------------
+void TTTimingWheel::unlink (const uint8_t inTimerId)
+{
+  const uint8_t next = mNext [inTimerId] ;
+  const uint8_t previous = mPrevious [inTimerId] ;
+  if (previous != kNone) {
+    mNext [previous] = next ;
+  }
+  else {
+    mHeads [mSlot [inTimerId]] = next ;
+  }
+  if (next != kNone) {
+    mPrevious [next] = previous ;
+  }
+  mSlot [inTimerId] = kNone ;
+}
+
+//-----------------------------------------------------------------------------
+void TTTimingWheel::schedule (const uint8_t inTimerId, const uint16_t inDelay)
+{
+  if (inTimerId < kTTMaxTimers) {
+    if (mSlot [inTimerId] != kNone) {
+      unlink (inTimerId) ;
+    }
+    else {
+      mCount++ ;
+    }
+    uint16_t delay = inDelay ;
+    if (delay < 1) {
+      delay = 1 ;
+    }
+    else if (delay > kHorizon) {
+      delay = kHorizon ;
+    }
+    mExpiry [inTimerId] = mCurrentTick + delay ;
+    insert (inTimerId) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTTimingWheel::cancel (const uint8_t inTimerId)
+{
+  if (inTimerId < kTTMaxTimers && mSlot [inTimerId] != kNone) {
+    unlink (inTimerId) ;
+    mCount-- ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTTimingWheel::cancelAll (void)
+{
+  for (uint8_t i = 0 ; i < kTTMaxTimers ; i++) {
+    cancel (i) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTTimingWheel::scheduled (const uint8_t inTimerId) const
+{
+  return inTimerId < kTTMaxTimers && mSlot [inTimerId] != kNone ;
+}
+
+//-----------------------------------------------------------------------------
+void TTTimingWheel::tick (TTTimerFunction inFunction, void * inContext)
+{
+  mCurrentTick++ ;
+  //--- The timers of the level 1 slot now expire in less than kSlots ticks
+  if (mCurrentTick % kSlots == 0) {
+    const uint8_t slot = (uint8_t)(kSlots + (mCurrentTick / kSlots) % kSlots) ;
+    uint8_t timer = mHeads [slot] ;
+    mHeads [slot] = kNone ;
+    while (timer != kNone) {
+      const uint8_t next = mNext [timer] ;
+      insert (timer) ;
+      timer = next ;
+    }
+  }
+  //--- A timer scheduled by inFunction is at least one tick ahead, it does
+  //    not go into this slot
+  const uint8_t slot = (uint8_t)(mCurrentTick % kSlots) ;
+  while (mHeads [slot] != kNone) {
+    const uint8_t timer = mHeads [slot] ;
+    unlink (timer) ;
+    mCount-- ;
+    if (inFunction != NULL) {
+      inFunction (timer, inContext) ;
+    }
+  }
+}
+
+//=============================================================================
+TTTimingWheel TTWishTimeout::sWheel ;
+uint16_t TTWishTimeout::sTimeoutTicks = 3000 / TTWishTimeout::kTickLength ;
+uint32_t TTWishTimeout::sLastUpdate = 0 ;
+uint32_t TTWishTimeout::sElapsed = 0 ;
+bool TTWishTimeout::sStarted = false ;
+uint32_t TTWishTimeout::sFailureCount = 0 ;
+
+//-----------------------------------------------------------------------------
+void TTWishTimeout::setTimeout (const uint32_t inTimeout)
+{
+  const uint32_t ticks = (inTimeout + kTickLength - 1) / kTickLength ;
+  sTimeoutTicks = ticks > TTTimingWheel::kHorizon ? (uint16_t)TTTimingWheel::kHorizon : (uint16_t)ticks ;
+}
+
+//-----------------------------------------------------------------------------
+void TTWishTimeout::start (const uint8_t inPointId)
+{
+  sWheel.schedule (inPointId, sTimeoutTicks) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTWishTimeout::stop (const uint8_t inPointId)
+{
+  sWheel.cancel (inPointId) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTWishTimeout::expired (const uint8_t inPointId, void * /* inContext */)
+{
+  sFailureCount++ ;
+  TTAbstractPoint::setWishFailedOfPoint (inPointId) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTWishTimeout::update (const uint32_t inNow)
+{
+  if (! sStarted) {
+    sStarted = true ;
+  }
+  else {
+    sElapsed += inNow - sLastUpdate ;
+  }
+  sLastUpdate = inNow ;
+  uint32_t ticks = sElapsed / kTickLength ;
+  sElapsed %= kTickLength ;
+  while (ticks > 0 && sWheel.count () > 0) {
+    sWheel.tick (expired, NULL) ;
+    ticks-- ;
+  }
+  sWheel.skip (ticks) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTWishTimeout::update (void)
+{
+  update (millis ()) ;
+}
+
+#endif
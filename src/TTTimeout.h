@@ -0,0 +1,109 @@
+//
+//  TTTimeout.h
+//  CocoaSimulator
+//
+//  Deadline of the pending wishes. A point whose motor never reports the
+//  wished position stays pending forever; TTWishTimeout arms a timer when
+//  a wish becomes pending and disarms it when the feedback matches. When
+//  the timer expires the point is drawn in wishFailedColor and the wish
+//  failure subscribers of TTChangeNotifier are called.
+//
+//  The timers live in a two level timing wheel: arming, disarming and each
+//  tick cost the same whatever the number of pending points, no timestamp
+//  is compared per point in the loop.
+//
+//  When a TTMotorScheduler is attached, the deadline of a wish starts when
+//  its command is sent, not when it is queued.
+//
+//  Enabled by defining TT_WISH_TIMEOUT in TTConfig.h, the default except on
+//  AVR. Without it a wish only fails through setWishFailedOfPoint.
+//
+
+#ifndef TTTimeout_h
+#define TTTimeout_h
+
+#include "TTTrack.h"
+
+#ifdef TT_WISH_TIMEOUT
+
+//-----------------------------------------------------------------------------
+typedef void (*TTTimerFunction) (const uint8_t inTimerId, void * inContext) ;
+
+static const uint8_t kTTMaxTimers = kTTMaxNumberOfPoints ;
+
+//-----------------------------------------------------------------------------
+// Timers identified by 0 .. kTTMaxTimers - 1, each in an intrusive list of
+// a slot. Level 0 has one slot per tick, level 1 one slot per kSlots
+// ticks; the slot of level 1 reached by the current tick is moved down to
+// level 0 once every kSlots ticks.
+class TTTimingWheel {
+  public : static const uint8_t kSlots = 64 ;
+  public : static const uint16_t kHorizon = (uint16_t)kSlots * kSlots - 1 ;
+
+  public : TTTimingWheel (void) ;
+
+  //--- inDelay in ticks, clamped to 1 .. kHorizon. Rearms a running timer
+  public : void schedule (const uint8_t inTimerId, const uint16_t inDelay) ;
+  public : void cancel (const uint8_t inTimerId) ;
+  public : void cancelAll (void) ;
+  public : bool scheduled (const uint8_t inTimerId) const ;
+  public : uint8_t count (void) const { return mCount ; }
+
+  //--- Advances one tick and calls inFunction for the expired timers,
+  //    which are disarmed before the call
+  public : void tick (TTTimerFunction inFunction, void * inContext) ;
+  //--- Advances inTicks ticks when no timer is armed
+  public : void skip (const uint32_t inTicks) { mCurrentTick += inTicks ; }
+
+  private : static const uint8_t kNone = 0xFF ;
+  private : void insert (const uint8_t inTimerId) ;
+  private : void unlink (const uint8_t inTimerId) ;
+
+  private : uint32_t mCurrentTick ;
+  private : uint8_t mCount ;
+  private : uint8_t mHeads [2 * kSlots] ;
+  private : uint8_t mNext [kTTMaxTimers] ;
+  private : uint8_t mPrevious [kTTMaxTimers] ;
+  //--- Index in mHeads, kNone when the timer is not armed
+  private : uint8_t mSlot [kTTMaxTimers] ;
+  private : uint32_t mExpiry [kTTMaxTimers] ;
+
+  //--- No copy
+  private : TTTimingWheel (const TTTimingWheel &) ;
+  private : TTTimingWheel & operator = (const TTTimingWheel &) ;
+};
+
+//-----------------------------------------------------------------------------
+// The deadlines are counted from the tick reached by the last update (),
+// which is called from loop ().
+class TTWishTimeout {
+  public : static const uint16_t kTickLength = 50 ;
+
+  //--- 3 s by default, at most kTickLength * TTTimingWheel::kHorizon
+  public : static void setTimeout (const uint32_t inTimeout) ;
+  public : static uint32_t timeout (void) { return (uint32_t)sTimeoutTicks * kTickLength ; }
+
+  //--- Called by the points
+  public : static void start (const uint8_t inPointId) ;
+  public : static void stop (const uint8_t inPointId) ;
+
+  public : static void update (const uint32_t inNow) ;
+  public : static void update (void) ;
+
+  //--- Statistics
+  public : static uint8_t pendingCount (void) { return sWheel.count () ; }
+  public : static uint32_t failureCount (void) { return sFailureCount ; }
+
+  private : static void expired (const uint8_t inPointId, void * inContext) ;
+
+  private : static TTTimingWheel sWheel ;
+  private : static uint16_t sTimeoutTicks ;
+  private : static uint32_t sLastUpdate ;
+  private : static uint32_t sElapsed ;
+  private : static bool sStarted ;
+  private : static uint32_t sFailureCount ;
+};
+
+#endif
+
+#endif /* TTTimeout_h */
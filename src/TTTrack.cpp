@@ -10,6 +10,18 @@
 #include "AWContext.h"
 #include "AW-settings.h"
 #include "TTConfig.h"
+#include "TTProfiler.h"
+#include "TTViewport.h"
+#include "TTDisplay.h"
+#include "TTDirtyRegion.h"
+#include "TTJournal.h"
+#include "TTSnapshot.h"
+#include "TTChange.h"
+#include "TTInterlocking.h"
+#include "TTTimeout.h"
+#include "TTBlink.h"
+#include "TTGeneration.h"
+#include "TTArena.h"
 
 //#define DEBUG_TRACK
 //#define TRACK_GRID
@@ -17,33 +29,65 @@
 
 #include <stdio.h>
 
+//=============================================================================
+// Sizes of the tiles, a layout has hundreds of them. TTTile adds the tile
+// list link to AWView, the track classes add one word of state at most.
+// The draw counters of TT_PROFILE are not counted
+#ifndef TT_PROFILE
+static_assert (sizeof (TTTile) <= sizeof (AWView) + sizeof (TTTile *), "TTTile grew") ;
+static_assert (sizeof (TTTrack) <= sizeof (TTTile) + 8, "TTTrack grew") ;
+static_assert (sizeof (TTBlock) <= sizeof (TTTile) + 8, "TTBlock grew") ;
+static_assert (sizeof (TTPoint) <= sizeof (TTTile) + 8, "TTPoint grew") ;
+static_assert (sizeof (TTDoublePoint) <= sizeof (TTTile) + 8, "TTDoublePoint grew") ;
+static_assert (sizeof (TTSlip) <= sizeof (TTTile) + 8, "TTSlip grew") ;
+static_assert (sizeof (TTDiag) <= sizeof (TTTile) + 8, "TTDiag grew") ;
+static_assert (sizeof (TTArrow) <= sizeof (TTTile) + 8, "TTArrow grew") ;
+static_assert (sizeof (TTBuffer) <= sizeof (TTTile) + 8, "TTBuffer grew") ;
+static_assert (sizeof (TTDecoupler) <= sizeof (TTTile) + 8, "TTDecoupler grew") ;
+#endif
+
+//=============================================================================
+// A touch toggles a point unless TTInterlocking vetoes it
+static inline bool canToggle (const uint8_t inPointId)
+{
+#ifdef TT_INTERLOCKING
+  return TTInterlocking::canToggle (inPointId) ;
+#else
+  (void) inPointId ;
+  return true ;
+#endif
+}
+
 //=============================================================================
 AWRect computeTileRelativeFrame(const AWPoint & inOrigin,
                                 const AWInt inWidth,
                                 const AWInt inHeight)
 {
-  AWRect r (AWPoint (inOrigin.x * TILE_PIXEL_GRID, inOrigin.y * TILE_PIXEL_GRID),
-            AWSize (inWidth * TILE_PIXEL_GRID, inHeight * TILE_PIXEL_GRID)) ;
-  return r ;
+  //--- The tiles built from grid coordinates are at the default scale, the
+  //    other scales go through the tileFrame of their metrics
+  return TTDefaultMetrics::tileFrame (inOrigin, inWidth, inHeight) ;
 }
 
-//—————————————————————————————————————————————————————————————————————————————
-static AWRect computeTileRelativeFrameWithMargin (const AWPoint & inOrigin,
-                                                  const AWInt inWidth,
-                                                  const AWInt inHeight)
+//=============================================================================
+TTView::TTView (const AWPoint & inOrigin,
+                const AWInt inSizeX,
+                const AWInt inSizeY,
+                const String & inTitle) :
+AWView (AWRect(inOrigin, AWSize(inSizeX * TTDefaultMetrics::kGrid, inSizeY * TTDefaultMetrics::kGrid)), TTBackColor),
+mTitle (inTitle),
+mGrid (TTDefaultMetrics::kGrid)
 {
-  AWRect r (AWPoint (inOrigin.x * TILE_PIXEL_GRID - DIAGONAL_TRACK_WIDTH / 2, inOrigin.y * TILE_PIXEL_GRID - DIAGONAL_TRACK_WIDTH / 2),
-            AWSize (inWidth * TILE_PIXEL_GRID + 2 * (DIAGONAL_TRACK_WIDTH / 2), inHeight * TILE_PIXEL_GRID + 2 * (DIAGONAL_TRACK_WIDTH / 2))) ;
-  return r ;
 }
 
-//=============================================================================
+//—————————————————————————————————————————————————————————————————————————————
 TTView::TTView (const AWPoint & inOrigin,
                 const AWInt inSizeX,
                 const AWInt inSizeY,
+                const AWInt inGrid,
                 const String & inTitle) :
-AWView (AWRect(inOrigin, AWSize(inSizeX * TILE_PIXEL_GRID, inSizeY * TILE_PIXEL_GRID)), TTBackColor),
-mTitle (inTitle)
+AWView (AWRect(inOrigin, AWSize(inSizeX * inGrid, inSizeY * inGrid)), TTBackColor),
+mTitle (inTitle),
+mGrid (inGrid)
 {
 }
 
@@ -56,46 +100,274 @@ bool TTView::isOpaque() const
 //—————————————————————————————————————————————————————————————————————————————
 void TTView::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (kTTViewKind) ;
+#endif
   AWRect r = absoluteFrame() ;
-  AWContext::setColor(backColor()) ;
-  r.fillRectInRegion(inDrawRegion) ;
+  TTDraw::setColor(backColor()) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 #ifdef TRACK_GRID
-  AWContext::setColor(trackGridColor) ;
+  TTDraw::setColor(trackGridColor) ;
   AWRect h = AWRect::horizontalLine(r.origin.x, r.origin.y, r.size.width);
-  for (int coord = 0; coord < r.size.height; coord += TILE_PIXEL_GRID) {
-    h.fillRectInRegion(inDrawRegion) ;
-    h.translateBy(0, TILE_PIXEL_GRID) ;
+  for (int coord = 0; coord < r.size.height; coord += mGrid) {
+    TTDraw::fillRect (h, inDrawRegion) ;
+    h.translateBy(0, mGrid) ;
   }
   AWRect v = AWRect::verticalLine(r.origin.x, r.origin.y, r.size.height);
-  for (int coord = 0; coord < r.size.width; coord += TILE_PIXEL_GRID) {
-    v.fillRectInRegion(inDrawRegion) ;
-    v.translateBy(TILE_PIXEL_GRID, 0) ;
+  for (int coord = 0; coord < r.size.width; coord += mGrid) {
+    TTDraw::fillRect (v, inDrawRegion) ;
+    v.translateBy(mGrid, 0) ;
   }
 #endif
-  AWContext::setColor(awkTextColor) ;
-  awkDefaultFont.drawStringInRegion(r.origin.x + 10, r.origin.y + 10, mTitle, inDrawRegion) ;
+  //--- Title offset designed for the 25 pixels grid, like TTGridMetrics::scaled
+  const AWInt titleOffset = (10 * mGrid) / 25 ;
+  TTDraw::setColor(awkTextColor) ;
+  TTDraw::drawString (awkDefaultFont, r.origin.x + titleOffset, r.origin.y + titleOffset, mTitle, inDrawRegion) ;
 }
 
 
 //=============================================================================
 TTTile::TTTile(const AWPoint & inOrigin) :
-AWView(computeTileRelativeFrame( inOrigin, 1, 1), TTBackColor)
+AWView(computeTileRelativeFrame( inOrigin, 1, 1), TTBackColor),
+mNextTile (NULL)
 {
+  appendToTileList () ;
+#ifdef TT_PROFILE
+  mDrawCountersFrame = 0 ;
+#endif
 }
 
 //—————————————————————————————————————————————————————————————————————————————
 TTTile::TTTile(const AWPoint & inOrigin,
                const AWInt inWidth,
                const AWInt inHeight) :
-AWView(computeTileRelativeFrame( inOrigin, inWidth, inHeight), TTBackColor)
+AWView(computeTileRelativeFrame( inOrigin, inWidth, inHeight), TTBackColor),
+mNextTile (NULL)
 {
+  appendToTileList () ;
+#ifdef TT_PROFILE
+  mDrawCountersFrame = 0 ;
+#endif
 }
 
 //—————————————————————————————————————————————————————————————————————————————
 TTTile::TTTile(const AWRect & inFrame) :
-AWView(inFrame, TTBackColor)
+AWView(inFrame, TTBackColor),
+mNextTile (NULL)
+{
+  appendToTileList () ;
+#ifdef TT_PROFILE
+  mDrawCountersFrame = 0 ;
+#endif
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+TTTile::~TTTile (void)
+{
+  TTViewport * const viewport = TTViewport::viewportOf (this) ;
+  if (viewport != NULL) {
+    viewport->removeTile (this) ;
+  }
+  TTBlinkClock::setBlinking (this, false) ;
+  TTTile * previous = NULL ;
+  //--- A tile already unlinked by removeFromTileList points to itself
+  TTTile * tile = (mNextTile == this) ? NULL : sFirstTile ;
+  while (tile != NULL && tile != this) {
+    previous = tile ;
+    tile = tile->mNextTile ;
+  }
+  if (tile != NULL) {
+    if (previous == NULL) {
+      sFirstTile = mNextTile ;
+    }
+    else {
+      previous->mNextTile = mNextTile ;
+    }
+    if (sLastTile == this) {
+      sLastTile = previous ;
+    }
+  }
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+TTTile * TTTile::sFirstTile = NULL ;
+TTTile * TTTile::sLastTile = NULL ;
+
+//—————————————————————————————————————————————————————————————————————————————
+void * TTTile::operator new (size_t inSize)
+{
+  return TTArena::allocate (inSize) ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void * TTTile::operator new (size_t /* inSize */, void * inPlace)
+{
+  return inPlace ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::operator delete (void * inPointer)
+{
+  TTArena::release (inPointer) ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::appendToTileList (void)
+{
+  if (sLastTile == NULL) {
+    sFirstTile = this ;
+  }
+  else {
+    sLastTile->mNextTile = this ;
+  }
+  sLastTile = this ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::removeFromTileList (TTTile * const * inTiles,
+                                 const uint16_t inCount)
+{
+  uint16_t index = 0 ;
+  TTTile * previous = NULL ;
+  TTTile * tile = sFirstTile ;
+  while (tile != NULL && index < inCount) {
+    TTTile * next = tile->mNextTile ;
+    if (tile == inTiles [index]) {
+      if (previous == NULL) {
+        sFirstTile = next ;
+      }
+      else {
+        previous->mNextTile = next ;
+      }
+      if (sLastTile == tile) {
+        sLastTile = previous ;
+      }
+      tile->mNextTile = tile ;
+      index++ ;
+    }
+    else {
+      previous = tile ;
+    }
+    tile = next ;
+  }
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::invalidate (void)
+{
+  //--- The frame of a tile of a viewport is in the coordinates of the
+  //    layout, the displays show the screen tiles only
+  TTViewport * const viewport = TTViewport::viewportOf (this) ;
+  if (viewport != NULL) {
+    viewport->invalidateLayoutRect (absoluteFrame ()) ;
+  }
+  else {
+    TTDisplay::invalidateOnAllDisplays (absoluteFrame ()) ;
+    if (sInvalidatedRegion != NULL) {
+      sInvalidatedRegion->add (absoluteFrame ()) ;
+    }
+    else {
+      setNeedsDisplay () ;
+    }
+  }
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::invalidateRect (const AWRect & inRect)
+{
+  if (viewport () == NULL) {
+    TTDisplay::invalidateOnAllDisplays (inRect) ;
+  }
+  invalidateView (inRect) ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::invalidateView (const AWRect & inRect)
+{
+  TTViewport * const viewport = TTViewport::viewportOf (this) ;
+  if (viewport != NULL) {
+    viewport->invalidateLayoutRect (inRect) ;
+  }
+  else if (sInvalidatedRegion != NULL) {
+    sInvalidatedRegion->add (inRect) ;
+  }
+  else {
+    setNeedsDisplayInRect (inRect) ;
+  }
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+AWView * TTTile::sInvalidatedView = NULL ;
+TTDirtyRegion * TTTile::sInvalidatedRegion = NULL ;
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::mergeInvalidations (AWView * inView, TTDirtyRegion * ioRegion)
+{
+  flushInvalidations () ;
+  const bool merge = inView != NULL && ioRegion != NULL ;
+  sInvalidatedView = merge ? inView : NULL ;
+  sInvalidatedRegion = merge ? ioRegion : NULL ;
+  if (merge) {
+    ioRegion->clear () ;
+  }
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::flushInvalidations (void)
+{
+  if (sInvalidatedRegion != NULL) {
+    for (uint8_t i = 0 ; i < sInvalidatedRegion->count () ; i++) {
+      sInvalidatedView->setNeedsDisplayInRect (sInvalidatedRegion->rectAtIndex (i)) ;
+    }
+    sInvalidatedRegion->clear () ;
+  }
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+TTViewport * TTTile::viewport (void) const
+{
+  return TTViewport::viewportOf (this) ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::updateBlinking (void)
+{
+  TTBlinkClock::setBlinking (this, blinking ()) ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+TTTileKind TTTile::tileKind (void) const
+{
+  return kTTTrackKind ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::saveState (TTStateWriter & /* ioWriter */) const
+{
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+void TTTile::restoreState (TTStateReader & /* ioReader */)
+{
+}
+
+#ifdef TT_PROFILE
+//—————————————————————————————————————————————————————————————————————————————
+const TTDrawCounters & TTTile::drawCounters (void) const
+{
+  return drawCountersOfFrame (TTProfiler::frame ()) ;
+}
+
+//—————————————————————————————————————————————————————————————————————————————
+TTDrawCounters & TTTile::drawCountersOfFrame (const uint16_t inFrame) const
 {
+  if (mDrawCountersFrame != inFrame) {
+    mDrawCountersFrame = inFrame ;
+    mDrawCounters.reset () ;
+  }
+  return mDrawCounters ;
 }
+#endif
 
 //=============================================================================
 TTTrack::TTTrack (const AWPoint & inOrigin,
@@ -103,8 +375,7 @@ TTTrack::TTTrack (const AWPoint & inOrigin,
                   const AWInt inHeight,
                   const bool inIsReverted) :
 TTTile (inOrigin, inWidth, inHeight),
-mIsReverted (inIsReverted),
-mDirection (kForward)
+mIsReverted (inIsReverted)
 {
 }
 
@@ -112,16 +383,15 @@ mDirection (kForward)
 TTTrack::TTTrack (const AWRect & inRect,
                   const bool inIsReverted) :
 TTTile (inRect),
-mIsReverted (inIsReverted),
-mDirection (kForward)
+mIsReverted (inIsReverted)
 {
 }
 
 //-----------------------------------------------------------------------------
 void TTTrack::drawFrame ( const AWRegion & inDrawRegion ) const
 {
-  AWContext::setColor( AWColor::black() ) ;
-  absoluteFrame().frameRectInRegion( inDrawRegion ) ;
+  TTDraw::setColor( AWColor::black() ) ;
+  TTDraw::frameRect (absoluteFrame (), inDrawRegion) ;
 }
 
 //—————————————————————————————————————————————————————————————————————————————
@@ -131,27 +401,75 @@ bool TTTrack::isOpaque (void) const
 }
 
 //=============================================================================
-TTBlock::TTBlock (const AWPoint & inOrigin,
-                  const AWInt inLength,
-                  const BlockInOutShape inInShape,
-                  const BlockInOutShape inOutShape,
-                  const bool inIsReverted) :
-TTTrack ( computeTileRelativeFrameWithMargin(inOrigin, inLength, 1), inIsReverted ),
+template <class M>
+TTBlockT <M>::TTBlockT (const AWPoint & inOrigin,
+                        const AWInt inLength,
+                        const BlockInOutShape inInShape,
+                        const BlockInOutShape inOutShape,
+                        const bool inIsReverted) :
+TTTrack ( M::tileFrameWithMargin (inOrigin, inLength, 1), inIsReverted ),
 mInShape(inInShape),
 mOutShape(inOutShape),
-mDashed (false)
+mDashed (false),
+mAlarm (false)
+{
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTBlockT <M>::setAlarm (const bool inAlarm)
+{
+  if (mAlarm != inAlarm) {
+    mAlarm = inAlarm ;
+    invalidate () ;
+    updateBlinking () ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+bool TTBlockT <M>::blinking (void) const
+{
+  return mAlarm && TTBlinkClock::blinks (kTTBlinkAlarms) ;
+}
+
+//-----------------------------------------------------------------------------
+// The body of the block, its ends do not blink
+template <class M>
+AWRect TTBlockT <M>::blinkRect (void) const
+{
+  AWRect bodyRect = absoluteFrame () ;
+  bodyRect.inset (M::kGrid / 2 + M::kMargin, M::kTrackOffset + M::kMargin) ;
+  return bodyRect ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTBlockT <M>::saveState (TTStateWriter & ioWriter) const
 {
+  ioWriter.write (mDashed, 1) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTBlock::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTBlockT <M>::restoreState (TTStateReader & ioReader)
 {
+  mDashed = ioReader.read (1) != 0 ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTBlockT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
+{
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect trackRect = absoluteFrame() ;
 #ifdef DEBUG_TRACK
   drawFrame( inDrawRegion ) ;
 #endif
-  trackRect.inset(TILE_PIXEL_GRID / 2 + 3, (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3) ;
-  AWContext::setColor( activeTrackColor ) ;
+  trackRect.inset(M::kGrid / 2 + M::kMargin, M::kTrackOffset + M::kMargin) ;
+  TTDraw::setColor (mAlarm && TTBlinkClock::visible (kTTBlinkAlarms) ? alarmColor : activeTrackColor) ;
   if (mDashed) {
     AWRect dash = trackRect ;
     dash.size.width = dash.size.height * 3 ;
@@ -159,51 +477,51 @@ void TTBlock::drawInRegion ( const AWRegion & inDrawRegion ) const
       if (dash.origin.x + dash.size.width > trackRect.origin.x + trackRect.size.width) {
         dash.size.width = trackRect.origin.x + trackRect.size.width - dash.origin.x ;
       }
-      dash.fillRectInRegion (inDrawRegion) ;
+      TTDraw::fillRect (dash, inDrawRegion) ;
       dash.origin.x += dash.size.height * 5 ;
     }
   }
   else {
-    trackRect.fillRectInRegion( inDrawRegion ) ;
+    TTDraw::fillRect (trackRect, inDrawRegion) ;
   }
   AWInt xOffset ;
   AWInt yOffset ;
   AWInt initialYOffset ;
 
   trackRect = absoluteFrame() ;
-  trackRect.inset(3, (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3) ;
+  trackRect.inset(M::kMargin, M::kTrackOffset + M::kMargin) ;
   switch (mInShape) {
     case kMiddle :
-      trackRect.origin.x += isReverted() ? trackRect.size.width - TILE_PIXEL_GRID / 2 : 0 ;
-      trackRect.size.width = TILE_PIXEL_GRID / 2 ;
-      trackRect.fillRectInRegion(inDrawRegion) ;
+      trackRect.origin.x += isReverted() ? trackRect.size.width - M::kGrid / 2 : 0 ;
+      trackRect.size.width = M::kGrid / 2 ;
+      TTDraw::fillRect (trackRect, inDrawRegion) ;
       break ;
     case kTopDiagonal :
-      trackRect.origin.x += isReverted() ? trackRect.size.width - TILE_PIXEL_GRID / 2 - 1 : TILE_PIXEL_GRID / 2 ;
+      trackRect.origin.x += isReverted() ? trackRect.size.width - M::kGrid / 2 - 1 : M::kGrid / 2 ;
       trackRect.origin.y += isReverted() ? -1 : 0 ;
       xOffset = isReverted() ? 1 : -1 ;
       yOffset = isReverted() ? -1 : 1 ;
       initialYOffset = isReverted() ? 0 : -1 ;
       trackRect.size.width = 1 ;
-      trackRect.size.height = DIAGONAL_TRACK_WIDTH - 1 ;
-      for (AWInt x = 0; x <= TILE_PIXEL_GRID / 2; x++) {
-        trackRect.fillRectInRegion (inDrawRegion) ;
-        trackRect.size.height = DIAGONAL_TRACK_WIDTH ;
+      trackRect.size.height = M::kDiagonalWidth - 1 ;
+      for (AWInt x = 0; x <= M::kGrid / 2; x++) {
+        TTDraw::fillRect (trackRect, inDrawRegion) ;
+        trackRect.size.height = M::kDiagonalWidth ;
         trackRect.translateBy(xOffset, yOffset + initialYOffset) ;
         initialYOffset = 0 ;
       }
       break ;
     case kBottomDiagonal :
-      trackRect.origin.x += isReverted() ? trackRect.size.width - TILE_PIXEL_GRID / 2 - 1 : TILE_PIXEL_GRID / 2 ;
+      trackRect.origin.x += isReverted() ? trackRect.size.width - M::kGrid / 2 - 1 : M::kGrid / 2 ;
       trackRect.origin.y += isReverted() ? 0 : -1 ;
       xOffset = isReverted() ? 1 : -1 ;
       yOffset = isReverted() ? 1 : -1 ;
       initialYOffset = isReverted() ? -1 : 0 ;
       trackRect.size.width = 1 ;
-      trackRect.size.height = DIAGONAL_TRACK_WIDTH - 1 ;
-      for (AWInt x = 0; x <= TILE_PIXEL_GRID / 2; x++) {
-        trackRect.fillRectInRegion (inDrawRegion) ;
-        trackRect.size.height = DIAGONAL_TRACK_WIDTH ;
+      trackRect.size.height = M::kDiagonalWidth - 1 ;
+      for (AWInt x = 0; x <= M::kGrid / 2; x++) {
+        TTDraw::fillRect (trackRect, inDrawRegion) ;
+        trackRect.size.height = M::kDiagonalWidth ;
         trackRect.translateBy(xOffset, yOffset + initialYOffset) ;
         initialYOffset = 0 ;
       }
@@ -211,39 +529,39 @@ void TTBlock::drawInRegion ( const AWRegion & inDrawRegion ) const
   }
 
   trackRect = absoluteFrame() ;
-  trackRect.inset(3, (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3) ;
+  trackRect.inset(M::kMargin, M::kTrackOffset + M::kMargin) ;
   switch (mOutShape) {
     case kMiddle :
-      trackRect.origin.x += isReverted() ? 0 : trackRect.size.width - TILE_PIXEL_GRID / 2 ;
-      trackRect.size.width = TILE_PIXEL_GRID / 2 ;
-      trackRect.fillRectInRegion(inDrawRegion) ;
+      trackRect.origin.x += isReverted() ? 0 : trackRect.size.width - M::kGrid / 2 ;
+      trackRect.size.width = M::kGrid / 2 ;
+      TTDraw::fillRect (trackRect, inDrawRegion) ;
       break ;
     case kTopDiagonal :
-      trackRect.origin.x += isReverted() ? TILE_PIXEL_GRID / 2 : trackRect.size.width - TILE_PIXEL_GRID / 2 - 1;
+      trackRect.origin.x += isReverted() ? M::kGrid / 2 : trackRect.size.width - M::kGrid / 2 - 1;
       trackRect.origin.y += isReverted() ? -1 : 0 ;
       xOffset = isReverted() ? -1 : 1 ;
       yOffset = isReverted() ? -1 : 1 ;
       initialYOffset = isReverted() ? 0 : -1 ;
       trackRect.size.width = 1 ;
-      trackRect.size.height = DIAGONAL_TRACK_WIDTH - 1 ;
-      for (int x = 0; x <= TILE_PIXEL_GRID / 2; x++) {
-        trackRect.fillRectInRegion (inDrawRegion) ;
-        trackRect.size.height = DIAGONAL_TRACK_WIDTH ;
+      trackRect.size.height = M::kDiagonalWidth - 1 ;
+      for (int x = 0; x <= M::kGrid / 2; x++) {
+        TTDraw::fillRect (trackRect, inDrawRegion) ;
+        trackRect.size.height = M::kDiagonalWidth ;
         trackRect.translateBy(xOffset, yOffset + initialYOffset) ;
         initialYOffset = 0 ;
       }
       break ;
     case kBottomDiagonal :
-      trackRect.origin.x += isReverted() ? TILE_PIXEL_GRID / 2 : trackRect.size.width - TILE_PIXEL_GRID / 2 - 1;
+      trackRect.origin.x += isReverted() ? M::kGrid / 2 : trackRect.size.width - M::kGrid / 2 - 1;
       trackRect.origin.y += isReverted() ? 0 : -1 ;
       xOffset = isReverted() ? -1 : 1 ;
       yOffset = isReverted() ? 1 : -1 ;
       initialYOffset = isReverted() ? -1 : 0 ;
       trackRect.size.width = 1 ;
-      trackRect.size.height = DIAGONAL_TRACK_WIDTH - 1 ;
-      for (int x = 0; x <= TILE_PIXEL_GRID / 2; x++) {
-        trackRect.fillRectInRegion (inDrawRegion) ;
-        trackRect.size.height = DIAGONAL_TRACK_WIDTH ;
+      trackRect.size.height = M::kDiagonalWidth - 1 ;
+      for (int x = 0; x <= M::kGrid / 2; x++) {
+        TTDraw::fillRect (trackRect, inDrawRegion) ;
+        trackRect.size.height = M::kDiagonalWidth ;
         trackRect.translateBy(xOffset, yOffset + initialYOffset) ;
         initialYOffset = 0 ;
       }
@@ -273,18 +591,35 @@ mFeedback(false)
 TTAbstractPoint::TTAbstractPoint (const AWPoint & inOrigin,
                                   const AWInt inWidth,
                                   const AWInt inHeight,
+                                  const bool inWay,
                                   const bool inIsReverted) :
-TTTouchableTrack (inOrigin, inWidth, inHeight, inIsReverted)
+TTTouchableTrack (inOrigin, inWidth, inHeight, inIsReverted),
+mWay (inWay)
 {
 }
 
 //-----------------------------------------------------------------------------
 TTAbstractPoint::TTAbstractPoint (const AWRect & inRect,
+                                  const bool inWay,
                                   const bool inIsReverted) :
-TTTouchableTrack (inRect, inIsReverted)
+TTTouchableTrack (inRect, inIsReverted),
+mWay (inWay)
 {
 }
 
+//-----------------------------------------------------------------------------
+TTAbstractPoint::~TTAbstractPoint (void)
+{
+  for (uint8_t i = 0 ; i < kTTMaxNumberOfPoints ; i++) {
+    if (sPointForIdentifier[i] == this) {
+      sPointForIdentifier[i] = NULL ;
+#ifdef TT_WISH_TIMEOUT
+      TTWishTimeout::stop (i) ;
+#endif
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
  TTAbstractPoint * TTAbstractPoint::sPointForIdentifier[kTTMaxNumberOfPoints] = { NULL } ;
 
@@ -292,6 +627,9 @@ TTTouchableTrack (inRect, inIsReverted)
 void TTAbstractPoint::setActualPositionOfPoint (const uint8_t inPointId,
                                                 const TTPointPosition inPosition)
 {
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalActualPosition, inPointId, inPosition) ;
+#endif
   if (inPointId < kTTMaxNumberOfPoints && sPointForIdentifier[inPointId] != NULL) {
     sPointForIdentifier[inPointId]->setActualPosition(inPointId, inPosition) ;
   }
@@ -299,10 +637,14 @@ void TTAbstractPoint::setActualPositionOfPoint (const uint8_t inPointId,
 
 //-----------------------------------------------------------------------------
 void TTAbstractPoint::setWishedPositionOfPoint (const uint8_t inPointId,
-                                                const TTPointPosition inPosition)
+                                                const TTPointPosition inPosition,
+                                                const TTChangeSource inSource)
 {
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalWishedPosition, inPointId, inPosition) ;
+#endif
   if (inPointId < kTTMaxNumberOfPoints && sPointForIdentifier[inPointId] != NULL) {
-    sPointForIdentifier[inPointId]->setWishedPosition(inPointId, inPosition) ;
+    sPointForIdentifier[inPointId]->setWishedPosition(inPointId, inPosition, inSource) ;
   }
 }
 
@@ -328,13 +670,53 @@ TTPointPosition TTAbstractPoint::wishedPositionOfPoint (const uint8_t inPointId)
   }
 }
 
+//-----------------------------------------------------------------------------
+bool TTAbstractPoint::pointExists (const uint8_t inPointId)
+{
+  return inPointId < kTTMaxNumberOfPoints && sPointForIdentifier[inPointId] != NULL ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractPoint::setWishFailedOfPoint (const uint8_t inPointId)
+{
+  if (inPointId < kTTMaxNumberOfPoints && sPointForIdentifier[inPointId] != NULL) {
+    sPointForIdentifier[inPointId]->setWishFailed (inPointId) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTAbstractPoint::wishFailedOfPoint (const uint8_t inPointId)
+{
+  return inPointId < kTTMaxNumberOfPoints &&
+         sPointForIdentifier[inPointId] != NULL &&
+         sPointForIdentifier[inPointId]->wishFailed (inPointId) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractPoint::watchWish (const uint8_t inPointId,
+                                 const bool inPending)
+{
+#ifdef TT_WISH_TIMEOUT
+  if (inPending) {
+    TTWishTimeout::start (inPointId) ;
+  }
+  else {
+    TTWishTimeout::stop (inPointId) ;
+  }
+#else
+  (void) inPointId ;
+  (void) inPending ;
+#endif
+  updateBlinking () ;
+}
+
 //-----------------------------------------------------------------------------
 void TTAbstractPoint::setCanicheActualPositionOfPoint(const uint8_t inPointId,
                                                       const TTCanichePointPosition inPosition)
 {
   if (inPointId < kTTMaxNumberOfPoints && sPointForIdentifier[inPointId] != NULL) {
     TTPointPosition ttPosition = sPointForIdentifier[inPointId]->canicheToPointPosition (inPosition) ;
-    sPointForIdentifier[inPointId]->setActualPosition(inPointId, ttPosition) ;
+    setActualPositionOfPoint (inPointId, ttPosition) ;
   }
 }
 
@@ -344,7 +726,7 @@ void TTAbstractPoint::setCanicheWishedPositionOfPoint(const uint8_t inPointId,
 {
   if (inPointId < kTTMaxNumberOfPoints && sPointForIdentifier[inPointId] != NULL) {
     TTPointPosition ttPosition = sPointForIdentifier[inPointId]->canicheToPointPosition (inPosition) ;
-    sPointForIdentifier[inPointId]->setWishedPosition(inPointId, ttPosition) ;
+    setWishedPositionOfPoint (inPointId, ttPosition) ;
   }
 }
 
@@ -382,6 +764,16 @@ void TTAbstractPoint::registerPointId (const uint8_t inPointId)
 {
   if (inPointId < kTTMaxNumberOfPoints) {
     sPointForIdentifier[inPointId] = this ;
+#ifdef TT_GENERATION
+    TTGeneration::touch (kTTPointObject, inPointId) ;
+#endif
+    const uint32_t lane = 0x3UL << (2 * (inPointId % kTTPointsPerWord)) ;
+    if (mWay == kRightHand) {
+      sWayMask[inPointId / kTTPointsPerWord] |= lane ;
+    }
+    else {
+      sWayMask[inPointId / kTTPointsPerWord] &= ~lane ;
+    }
   }
 }
 
@@ -392,55 +784,173 @@ TTCanichePointPosition TTAbstractPoint::pendingCanicheWish (uint8_t & outPointId
   return pointToCanichePosition (pos) ;
 }
 
+//-----------------------------------------------------------------------------
+TTCanichePointPosition TTAbstractPoint::pointToCanichePosition (TTPointPosition inPos) const
+{
+  switch (inPos) {
+    case kDiagonalPosition:
+      return mWay == kRightHand ? kCanicheRightPosition : kCanicheLeftPosition ;
+      break ;
+    case kStraightPosition:
+      return mWay == kRightHand ? kCanicheLeftPosition : kCanicheRightPosition ;
+      break ;
+    case kMiddlePosition:
+      return kCanicheMiddlePosition ;
+      break ;
+    case kNoPosition:
+      return kCanicheUnknownPosition ;
+      break ;
+    default:
+      return kCanicheUnknownPosition ;
+      break ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+TTPointPosition TTAbstractPoint::canicheToPointPosition (TTCanichePointPosition inPos) const
+{
+  switch (inPos) {
+    case kCanicheLeftPosition:
+      return mWay == kRightHand ? kStraightPosition : kDiagonalPosition ;
+      break ;
+    case kCanicheRightPosition:
+      return mWay == kRightHand ? kDiagonalPosition : kStraightPosition ;
+      break ;
+    case kCanicheMiddlePosition:
+      return kMiddlePosition ;
+      break ;
+    case kCanicheUnknownPosition:
+      return kNoPosition ;
+      break ;
+    default:
+      return kNoPosition ;
+      break ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+uint32_t TTAbstractPoint::sWayMask[kTTPositionWords] = { 0 } ;
+
+//--- Low bit of each 2 bits lane
+static const uint32_t kLowBits = 0x55555555UL ;
+
+//-----------------------------------------------------------------------------
+// Left hand: caniche = TT + 1 (mod 4), right hand: caniche = 3 - TT. In both
+// cases the low bit is inverted. The high bit is inverted for the right hand
+// and flipped by the low bit for the left hand.
+void TTAbstractPoint::pointToCanichePositions (const uint32_t * inPositions,
+                                               uint32_t * outCanichePositions,
+                                               const uint8_t inWordCount)
+{
+  for (uint8_t i = 0 ; i < inWordCount && i < kTTPositionWords ; i++) {
+    const uint32_t low = inPositions[i] & kLowBits ;
+    const uint32_t high = (inPositions[i] >> 1) & kLowBits ;
+    const uint32_t rightHand = sWayMask[i] & kLowBits ;
+    outCanichePositions[i] = (low ^ kLowBits) | ((high ^ (low | rightHand)) << 1) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Inverse: left hand TT = caniche - 1 (mod 4), right hand TT = 3 - caniche.
+void TTAbstractPoint::canicheToPointPositions (const uint32_t * inCanichePositions,
+                                               uint32_t * outPositions,
+                                               const uint8_t inWordCount)
+{
+  for (uint8_t i = 0 ; i < inWordCount && i < kTTPositionWords ; i++) {
+    const uint32_t low = (inCanichePositions[i] & kLowBits) ^ kLowBits ;
+    const uint32_t high = (inCanichePositions[i] >> 1) & kLowBits ;
+    const uint32_t rightHand = sWayMask[i] & kLowBits ;
+    outPositions[i] = low | ((high ^ (low | rightHand)) << 1) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractPoint::setCanicheActualPositionOfPoints (const uint32_t * inCanichePositions,
+                                                        const uint8_t inWordCount)
+{
+  uint32_t positions[kTTPositionWords] ;
+  canicheToPointPositions (inCanichePositions, positions, inWordCount) ;
+  for (uint8_t i = 0 ; i < inWordCount && i < kTTPositionWords ; i++) {
+    for (uint8_t lane = 0 ; lane < kTTPointsPerWord ; lane++) {
+      const uint8_t pointId = i * kTTPointsPerWord + lane ;
+      if (pointId < kTTMaxNumberOfPoints && sPointForIdentifier[pointId] != NULL) {
+        const TTPointPosition position = (TTPointPosition)((positions[i] >> (2 * lane)) & 0x3) ;
+        setActualPositionOfPoint (pointId, position) ;
+      }
+    }
+  }
+}
+
 //=============================================================================
-TTPoint::TTPoint (const AWPoint & inOrigin,
-                  const uint8_t inPointId,
-                  const bool inWay,
-                  const bool inInDiagonal,
-                  const bool inOutDiagonal,
-                  const bool inIsReverted) :
-TTAbstractPoint (computeTileRelativeFrameWithMargin (inOrigin, 2, 2), inIsReverted),
+template <class M>
+TTPointT <M>::TTPointT (const AWPoint & inOrigin,
+                        const uint8_t inPointId,
+                        const bool inWay,
+                        const bool inInDiagonal,
+                        const bool inOutDiagonal,
+                        const bool inIsReverted) :
+TTAbstractPoint (M::tileFrameWithMargin (inOrigin, 2, 2), inWay, inIsReverted),
 mPointId (inPointId),
-mWay (inWay),
 mInDiagonal (inInDiagonal),
 mOutDiagonal (inOutDiagonal),
 mWishedPosition (kStraightPosition),
 mActualPosition (kStraightPosition),
 mPendingWishedPosition (false),
+mWishFailed (false),
 mToggled (false)
 {
   registerPointId (inPointId) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTPoint::setActualPosition (const uint8_t inPointId,
-                                 const TTPointPosition inPosition)
+template <class M>
+void TTPointT <M>::setActualPosition (const uint8_t inPointId,
+                                      const TTPointPosition inPosition)
 {
   if (mPointId == inPointId && mActualPosition != inPosition) {
+    const TTPointPosition oldPosition = mActualPosition ;
     mActualPosition = inPosition ;
-    if (mActualPosition == mWishedPosition) mPendingWishedPosition = false ;
-    setNeedsDisplay() ;
+    if (mActualPosition == mWishedPosition) {
+      mPendingWishedPosition = false ;
+      mWishFailed = false ;
+      watchWish (mPointId, false) ;
+    }
+    invalidate () ;
+    TTChangeNotifier::feedbackChanged (mPointId, oldPosition, inPosition) ;
   }
 }
 
 //-----------------------------------------------------------------------------
-void TTPoint::setWishedPosition (const uint8_t inPointId,
-                                 const TTPointPosition inPosition)
+template <class M>
+void TTPointT <M>::setWishedPosition (const uint8_t inPointId,
+                                      const TTPointPosition inPosition,
+                                      const TTChangeSource inSource)
 {
   if (mPointId == inPointId &&
       mWishedPosition != inPosition &&
       (inPosition == kStraightPosition ||
        inPosition == kDiagonalPosition))
   {
+    const TTPointPosition oldPosition = mWishedPosition ;
     mWishedPosition = inPosition ;
+    //--- Pending until the feedback reports the wish. A synced wish is
+    //    watched by the board it comes from
+    mPendingWishedPosition = inSource != kTTSyncSource && mWishedPosition != mActualPosition ;
+    mWishFailed = false ;
+    watchWish (mPointId, mPendingWishedPosition) ;
     mToggled = true ;
-    sendAction () ;
-    setNeedsDisplay() ;
+    //--- A synced wish is sent to the motor by the board it comes from
+    if (inSource != kTTSyncSource) {
+      sendAction () ;
+    }
+    invalidate () ;
+    TTChangeNotifier::wishChanged (mPointId, oldPosition, inPosition, inSource) ;
   }
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTPoint::actualPosition (const uint8_t inPointId)
+template <class M>
+TTPointPosition TTPointT <M>::actualPosition (const uint8_t inPointId)
 {
   if (mPointId == inPointId) {
     return mActualPosition ;
@@ -451,7 +961,8 @@ TTPointPosition TTPoint::actualPosition (const uint8_t inPointId)
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTPoint::wishedPosition (const uint8_t inPointId)
+template <class M>
+TTPointPosition TTPointT <M>::wishedPosition (const uint8_t inPointId)
 {
   if (mPointId == inPointId) {
     return mWishedPosition ;
@@ -462,7 +973,35 @@ TTPointPosition TTPoint::wishedPosition (const uint8_t inPointId)
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTPoint::pendingWish (uint8_t & outPointId)
+template <class M>
+void TTPointT <M>::setWishFailed (const uint8_t inPointId)
+{
+  if (mPointId == inPointId && mPendingWishedPosition && ! mWishFailed) {
+    mWishFailed = true ;
+    invalidate () ;
+    updateBlinking () ;
+    TTChangeNotifier::wishFailed (mPointId, mActualPosition, mWishedPosition) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+bool TTPointT <M>::wishFailed (const uint8_t inPointId)
+{
+  return mPointId == inPointId && mWishFailed ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+bool TTPointT <M>::blinking (void) const
+{
+  return mPendingWishedPosition && mWishedPosition != mActualPosition &&
+         TTBlinkClock::blinks (mWishFailed ? kTTBlinkFailures : kTTBlinkWishes) ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+TTPointPosition TTPointT <M>::pendingWish (uint8_t & outPointId)
 {
   if (mToggled) {
     mToggled = false ;
@@ -475,145 +1014,133 @@ TTPointPosition TTPoint::pendingWish (uint8_t & outPointId)
 }
 
 //-----------------------------------------------------------------------------
-TTCanichePointPosition TTPoint::pointToCanichePosition (TTPointPosition inPos)
+template <class M>
+void TTPointT <M>::saveState (TTStateWriter & ioWriter) const
 {
-  switch (inPos) {
-    case kDiagonalPosition:
-      return mWay == kRightHand ? kCanicheRightPosition : kCanicheLeftPosition ;
-      break ;
-    case kStraightPosition:
-      return mWay == kRightHand ? kCanicheLeftPosition : kCanicheRightPosition ;
-      break ;
-    case kMiddlePosition:
-      return kCanicheMiddlePosition ;
-      break ;
-    case kNoPosition:
-      return kCanicheUnknownPosition ;
-      break ;
-    default:
-      return kCanicheUnknownPosition ;
-      break ;
-  }
+  ioWriter.write (mActualPosition, 2) ;
+  ioWriter.write (mWishedPosition, 2) ;
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTPoint::canicheToPointPosition (TTCanichePointPosition inPos)
+// The wish is not sent again, the point motor has already been commanded
+// before the snapshot was taken
+template <class M>
+void TTPointT <M>::restoreState (TTStateReader & ioReader)
 {
-  switch (inPos) {
-    case kCanicheLeftPosition:
-      return mWay == kRightHand ? kStraightPosition : kDiagonalPosition ;
-      break ;
-    case kCanicheRightPosition:
-      return mWay == kRightHand ? kDiagonalPosition : kStraightPosition ;
-      break ;
-    case kCanicheMiddlePosition:
-      return kMiddlePosition ;
-      break ;
-    case kCanicheUnknownPosition:
-      return kNoPosition ;
-      break ;
-    default:
-      return kNoPosition ;
-      break ;
-  }
+  mActualPosition = (TTPointPosition)ioReader.read (2) ;
+  mWishedPosition = (TTPointPosition)ioReader.read (2) ;
+  mPendingWishedPosition = mWishedPosition != mActualPosition ;
+  mWishFailed = false ;
+  watchWish (mPointId, mPendingWishedPosition) ;
+  mToggled = false ;
 }
 
 //-----------------------------------------------------------------------------
-void TTPoint::drawStraight (const AWRegion & inDrawRegion, const AWColor inStraightColor ) const
+template <class M>
+void TTPointT <M>::drawStraight (const AWRegion & inDrawRegion, const AWColor inStraightColor ) const
 {
   //--- Draw the straight track
-  AWContext::setColor(inStraightColor) ;
+  TTDraw::setColor(inStraightColor) ;
   AWRect r = absoluteFrame() ;
-  r.size.height = STRAIGHT_TRACK_WIDTH ;
-  r.size.width -= (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 8 ;
-  r.origin.x += 3 ;
-  if (! isReverted()) r.origin.x += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 2 ;
+  r.size.height = M::kStraightWidth ;
+  r.size.width -= M::kTrackOffset + M::scaled (8) ;
+  r.origin.x += M::kMargin ;
+  if (! isReverted()) r.origin.x += M::kTrackOffset + M::scaled (2) ;
   if ((mWay == kRightHand) ^ isReverted()) {
-    r.origin.y += TILE_PIXEL_GRID + (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3 ;
+    r.origin.y += M::kGrid + M::kTrackOffset + M::kMargin ;
   }
   else {
-    r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3 ;
+    r.origin.y += M::kTrackOffset + M::kMargin ;
   }
-  r.fillRectInRegion(inDrawRegion) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTPoint::drawDiagonal (const AWRegion & inDrawRegion, const AWColor inDiagonalColor ) const
+template <class M>
+void TTPointT <M>::drawDiagonal (const AWRegion & inDrawRegion, const AWColor inDiagonalColor ) const
 {
   //--- Draw the diagonal track
   int yOffset ;
   AWRect r = absoluteFrame () ;
   int height = r.size.height ;
   r.size.width = 1 ;
-  r.origin.x += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 5 ;
+  r.origin.x += M::kTrackOffset + M::scaled (5) ;
   if (mWay == kRightHand) {
     yOffset = -1 ;
-    r.origin.y += height - 9 - (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 ;
+    r.origin.y += height - M::scaled (9) - M::kTrackOffset ;
   }
   else {
     yOffset = 1 ;
-    r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3;
+    r.origin.y += M::kTrackOffset + M::kMargin;
   }
 
-  AWContext::setColor( inDiagonalColor ) ;
-  r.size.height = DIAGONAL_TRACK_WIDTH - 1;
-  r.fillRectInRegion (inDrawRegion) ;
+  TTDraw::setColor( inDiagonalColor ) ;
+  r.size.height = M::kDiagonalWidth - 1;
+  TTDraw::fillRect (r, inDrawRegion) ;
   r.size.height++ ;
   r.origin.x++ ;
   r.origin.y += (yOffset == -1) ? yOffset : 0 ;
 
-  for (int x = 1 ; x < height - 6 - TILE_PIXEL_GRID ; x++) {
-    r.fillRectInRegion (inDrawRegion) ;
+  for (int x = 1 ; x < height - M::scaled (6) - M::kGrid ; x++) {
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x++ ;
     r.origin.y += yOffset ;
   }
 
   r.size.height-- ;
   r.origin.y -= (yOffset == -1) ? yOffset : 0 ;
-  r.fillRectInRegion (inDrawRegion) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTPoint::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTPointT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   const AWRect trackRect = absoluteFrame() ;
   AWRect buttonRect = trackRect;
-  buttonRect.inset(3, 3);
-  AWContext::setColor (feedback() ? feedbackColor : buttonBackColor) ;
-  buttonRect.fillRoundRectInRegion (4, inDrawRegion) ;
-  AWContext::setColor( buttonFrameColor ) ;
-  buttonRect.frameRoundRectInRegion (4, inDrawRegion) ;
+  buttonRect.inset (M::kMargin, M::kMargin);
+  TTDraw::setColor (feedback() ? feedbackColor : buttonBackColor) ;
+  TTDraw::fillRoundRect (buttonRect, M::kButtonRadius, inDrawRegion) ;
+  TTDraw::setColor( buttonFrameColor ) ;
+  TTDraw::frameRoundRect (buttonRect, M::kButtonRadius, inDrawRegion) ;
 #ifdef DEBUG_TRACK
   drawFrame( inDrawRegion ) ;
 #endif
 
   AWColor diagonalColor;
   AWColor straightColor;
+  AWColor wishColor = mWishFailed ? wishFailedColor : wishedPosColor ;
+  if (! TTBlinkClock::visible (mWishFailed ? kTTBlinkFailures : kTTBlinkWishes)) {
+    wishColor = inactiveTrackColor ;
+  }
 
   switch (mActualPosition) {
     case kMiddlePosition:
       if (mWishedPosition == kStraightPosition) {
-        straightColor = mPendingWishedPosition ? wishedPosColor : inactiveTrackColor ;
+        straightColor = mPendingWishedPosition ? wishColor : inactiveTrackColor ;
         diagonalColor = inactiveTrackColor ;
         drawDiagonal(inDrawRegion, diagonalColor);
         drawStraight(inDrawRegion, straightColor);
       }
       else { /* kDiagonalPosition */
         straightColor = inactiveTrackColor ;
-        diagonalColor = mPendingWishedPosition ? wishedPosColor : inactiveTrackColor ;
+        diagonalColor = mPendingWishedPosition ? wishColor : inactiveTrackColor ;
         drawStraight(inDrawRegion, straightColor);
         drawDiagonal(inDrawRegion, diagonalColor);
       }
       break ;
     case kDiagonalPosition:
       diagonalColor = activeTrackColor ;
-      straightColor = (mWishedPosition == kStraightPosition) ? mPendingWishedPosition ? wishedPosColor : inactiveTrackColor : inactiveTrackColor ;
+      straightColor = (mWishedPosition == kStraightPosition) ? mPendingWishedPosition ? wishColor : inactiveTrackColor : inactiveTrackColor ;
       drawStraight(inDrawRegion, straightColor);
       drawDiagonal(inDrawRegion, diagonalColor);
       break ;
     case kStraightPosition:
       straightColor = activeTrackColor ;
-      diagonalColor = (mWishedPosition == kDiagonalPosition) ? mPendingWishedPosition ? wishedPosColor : inactiveTrackColor : inactiveTrackColor ;
+      diagonalColor = (mWishedPosition == kDiagonalPosition) ? mPendingWishedPosition ? wishColor : inactiveTrackColor : inactiveTrackColor ;
       drawDiagonal(inDrawRegion, diagonalColor);
       drawStraight(inDrawRegion, straightColor);
       break ;
@@ -624,68 +1151,68 @@ void TTPoint::drawInRegion ( const AWRegion & inDrawRegion ) const
   int yOffset ;
 
   //--- Draw the input
-  AWContext::setColor(activeTrackColor) ;
+  TTDraw::setColor(activeTrackColor) ;
   AWRect r = trackRect ;
-  r.origin.x += 3 ;
-  if ( isReverted() ) r.origin.x += TILE_PIXEL_GRID + (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 2 ;
+  r.origin.x += M::kMargin ;
+  if ( isReverted() ) r.origin.x += M::kGrid + M::kTrackOffset + M::scaled (2) ;
   if (mInDiagonal == kStraight) {
-    r.size.height = STRAIGHT_TRACK_WIDTH ;
-    r.size.width = (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3 ;
+    r.size.height = M::kStraightWidth ;
+    r.size.width = M::kTrackOffset + M::kMargin ;
     if ((mWay == kRightHand) ^ isReverted()) {
-      r.origin.y += TILE_PIXEL_GRID + (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3;
+      r.origin.y += M::kGrid + M::kTrackOffset + M::kMargin;
     }
     else {
-      r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3;
+      r.origin.y += M::kTrackOffset + M::kMargin;
     }
-    r.fillRectInRegion(inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
   }
   else {
-    r.size.height = DIAGONAL_TRACK_WIDTH ;
+    r.size.height = M::kDiagonalWidth ;
     r.size.width = 1 ;
     if (mWay == kRightHand) {
-      r.origin.y += isReverted() ? TILE_PIXEL_GRID / 3 + 3 : 2 * TILE_PIXEL_GRID - 1;
+      r.origin.y += isReverted() ? M::kGrid / 3 + M::scaled (3) : 2 * M::kGrid - 1;
       yOffset = -1;
     }
     else {
-      r.origin.y += isReverted() ? TILE_PIXEL_GRID + TILE_PIXEL_GRID / 3 + 3 : 0 ;
+      r.origin.y += isReverted() ? M::kGrid + M::kGrid / 3 + M::scaled (3) : 0 ;
       yOffset = 1;
     }
-    for (int x = 0; x < (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3; x++) {
-      r.fillRectInRegion (inDrawRegion) ;
+    for (int x = 0; x < M::kTrackOffset + M::kMargin; x++) {
+      TTDraw::fillRect (r, inDrawRegion) ;
       r.origin.x++ ;
       r.origin.y += yOffset ;
     }
   }
 
   //--- Draw the output
-  AWContext::setColor(diagonalColor);
+  TTDraw::setColor(diagonalColor);
   r = trackRect ;
-  r.origin.x += 3 ;
-  if ( ! isReverted() ) r.origin.x += TILE_PIXEL_GRID + (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 2 ;
+  r.origin.x += M::kMargin ;
+  if ( ! isReverted() ) r.origin.x += M::kGrid + M::kTrackOffset + M::scaled (2) ;
   if (mOutDiagonal == kStraight) {
-    r.size.height = STRAIGHT_TRACK_WIDTH ;
-    r.size.width = (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 2 ;
+    r.size.height = M::kStraightWidth ;
+    r.size.width = M::kTrackOffset + M::scaled (2) ;
     if ((mWay == kRightHand) ^ isReverted()) {
-      r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3;
+      r.origin.y += M::kTrackOffset + M::kMargin;
     }
     else {
-      r.origin.y += TILE_PIXEL_GRID + (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3;
+      r.origin.y += M::kGrid + M::kTrackOffset + M::kMargin;
     }
-    r.fillRectInRegion(inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
   }
   else {
-    r.size.height = DIAGONAL_TRACK_WIDTH ;
+    r.size.height = M::kDiagonalWidth ;
     r.size.width = 1 ;
     if (mWay == kRightHand) {
-      r.origin.y += isReverted() ? 2 * TILE_PIXEL_GRID - 1 : (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 2 ;
+      r.origin.y += isReverted() ? 2 * M::kGrid - 1 : M::kTrackOffset + M::scaled (2) ;
       yOffset = -1;
     }
     else {
-      r.origin.y += isReverted() ? 0 : TILE_PIXEL_GRID + (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 2 ;
+      r.origin.y += isReverted() ? 0 : M::kGrid + M::kTrackOffset + M::scaled (2) ;
       yOffset = 1;
     }
-    for (int x = 0; x <= (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3; x++) {
-      r.fillRectInRegion (inDrawRegion) ;
+    for (int x = 0; x <= M::kTrackOffset + M::kMargin; x++) {
+      TTDraw::fillRect (r, inDrawRegion) ;
       r.origin.x++ ;
       r.origin.y += yOffset ;
     }
@@ -693,18 +1220,21 @@ void TTPoint::drawInRegion ( const AWRegion & inDrawRegion ) const
 
 #ifdef TRACK_TAG
   r = trackRect ;
-  r.inset (3, 3) ;
-  AWContext::setColor(awkTextColor) ;
+  r.inset (M::kMargin, M::kMargin) ;
+  TTDraw::setColor(awkTextColor) ;
   String text (mPointId) ;
-  r.origin.x += isReverted() ? r.size.width - 5 - kTTTagFont.stringLength (text) : 5 ;
-  r.origin.y += (mWay == kLeftHand) ^ isReverted() ? r.size.height - 5 - kTTTagFont.ascent() : 5 ;
-  kTTTagFont.drawStringInRegion(r.origin.x, r.origin.y, text, inDrawRegion) ;
+  r.origin.x += isReverted() ? r.size.width - M::kTagInset - kTTTagFont.stringLength (text) : M::kTagInset ;
+  r.origin.y += (mWay == kLeftHand) ^ isReverted() ? r.size.height - M::kTagInset - kTTTagFont.ascent() : M::kTagInset ;
+  TTDraw::drawString (kTTTagFont, r.origin.x, r.origin.y, text, inDrawRegion) ;
 #endif
 }
 
 //-----------------------------------------------------------------------------
-void TTPoint::toggle ()
+template <class M>
+void TTPointT <M>::toggle ()
 {
+  if (! canToggle (mPointId)) return ;
+  const TTPointPosition oldPosition = mWishedPosition ;
   if (mWishedPosition == kStraightPosition) {
     mWishedPosition = kDiagonalPosition ;
   }
@@ -712,37 +1242,50 @@ void TTPoint::toggle ()
     mWishedPosition = kStraightPosition ;
   }
   mToggled = true ;
-  mPendingWishedPosition = true ;
-  setNeedsDisplay() ;
+  mPendingWishedPosition = mWishedPosition != mActualPosition ;
+  mWishFailed = false ;
+  watchWish (mPointId, mPendingWishedPosition) ;
+  invalidate () ;
   sendAction() ;
+  if (mWishedPosition != oldPosition) {
+    TTChangeNotifier::wishChanged (mPointId, oldPosition, mWishedPosition, kTTTouchSource) ;
+  }
 }
 
 //-----------------------------------------------------------------------------
 void TTTouchableTrack::touchDown (const AWPoint & inPoint)
 {
+  if (! TTDisplay::touchesEnabled ()) return ;
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalTouchDown, inPoint, viewport () != NULL) ;
+#endif
   AWRect r = absoluteFrame();
-  r.inset(3, 3);
+  r.inset(touchInset (), touchInset ());
   if (r.containsPoint(inPoint)) {
     setFeedback(true) ;
-    setNeedsDisplay() ;
+    invalidate () ;
   }
 }
 
 //-----------------------------------------------------------------------------
 void TTTouchableTrack::touchMove (const AWPoint & inPoint)
 {
+  if (! TTDisplay::touchesEnabled ()) return ;
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalTouchMove, inPoint, viewport () != NULL) ;
+#endif
   AWRect r = absoluteFrame();
-  r.inset(3, 3);
+  r.inset(touchInset (), touchInset ());
   if (r.containsPoint(inPoint)) {
     if (! feedback()) {
       setFeedback(true) ;
-      setNeedsDisplay() ;
+      invalidate () ;
     }
   }
   else {
     if (feedback()) {
       setFeedback(false) ;
-      setNeedsDisplay() ;
+      invalidate () ;
     }
   }
 }
@@ -750,30 +1293,40 @@ void TTTouchableTrack::touchMove (const AWPoint & inPoint)
 //-----------------------------------------------------------------------------
 void TTTouchableTrack::touchUp (const AWPoint & inPoint)
 {
+  if (! TTDisplay::touchesEnabled ()) return ;
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalTouchUp, inPoint, viewport () != NULL) ;
+#endif
   AWRect r = absoluteFrame();
-  r.inset(3, 3);
+  r.inset(touchInset (), touchInset ());
   if (r.containsPoint(inPoint)) {
     setFeedback(false) ;
     toggle() ;
   }
 }
 
+//-----------------------------------------------------------------------------
+AWInt TTTouchableTrack::touchInset (void) const
+{
+  return TTDefaultMetrics::kTouchInset ;
+}
+
 //-----------------------------------------------------------------------------
 void TTTouchableTrack::toggle ()
 {
 }
 
 //=============================================================================
-TTDoublePoint::TTDoublePoint (const AWPoint & inOrigin,
-                              const uint8_t inTopPointId,
-                              const uint8_t inBottomPointId,
-                              const bool inWay,
-                              const TTDoublePointSize inSize,
-                              const bool inIsReverted) :
-TTAbstractPoint (computeTileRelativeFrameWithMargin(inOrigin, inSize == kNormal ? 2 : 3, inSize == kNormal ? 2 : 3), inIsReverted),
+template <class M>
+TTDoublePointT <M>::TTDoublePointT (const AWPoint & inOrigin,
+                                    const uint8_t inTopPointId,
+                                    const uint8_t inBottomPointId,
+                                    const bool inWay,
+                                    const TTDoublePointSize inSize,
+                                    const bool inIsReverted) :
+TTAbstractPoint (M::tileFrameWithMargin (inOrigin, inSize == kNormal ? 2 : 3, inSize == kNormal ? 2 : 3), inWay, inIsReverted),
 mTopPointId (inTopPointId),
 mBottomPointId (inBottomPointId),
-mWay (inWay),
 mSize (inSize),
 mWishedTopPosition (kStraightPosition),
 mWishedBottomPosition (kStraightPosition),
@@ -781,6 +1334,9 @@ mActualTopPosition (kStraightPosition),
 mActualBottomPosition (kStraightPosition),
 mPendingWishedTopPosition (false),
 mPendingWishedBottomPosition (false),
+mTopWishFailed (false),
+mBottomWishFailed (false),
+mTouchLocation (0),
 mTouchInProgress (false),
 mTopToggled (false),
 mBottomToggled (false)
@@ -791,52 +1347,82 @@ mBottomToggled (false)
 
 //-----------------------------------------------------------------------------
 
-void TTDoublePoint::setActualPosition(const uint8_t inPointId,
-                                      const TTPointPosition inPosition)
+template <class M>
+void TTDoublePointT <M>::setActualPosition (const uint8_t inPointId,
+                                            const TTPointPosition inPosition)
 {
   if (mTopPointId == inPointId && mActualTopPosition != inPosition) {
+    const TTPointPosition oldPosition = mActualTopPosition ;
     mActualTopPosition = inPosition ;
-    if (mActualTopPosition == mWishedTopPosition) mPendingWishedTopPosition = false ;
-    setNeedsDisplay() ;
+    if (mActualTopPosition == mWishedTopPosition) {
+      mPendingWishedTopPosition = false ;
+      mTopWishFailed = false ;
+      watchWish (mTopPointId, false) ;
+    }
+    invalidate () ;
+    TTChangeNotifier::feedbackChanged (mTopPointId, oldPosition, inPosition) ;
   }
   else if (mBottomPointId == inPointId && mActualBottomPosition != inPosition) {
+    const TTPointPosition oldPosition = mActualBottomPosition ;
     mActualBottomPosition = inPosition ;
-    if (mActualBottomPosition == mWishedBottomPosition) mPendingWishedBottomPosition = false ;
-    setNeedsDisplay() ;
+    if (mActualBottomPosition == mWishedBottomPosition) {
+      mPendingWishedBottomPosition = false ;
+      mBottomWishFailed = false ;
+      watchWish (mBottomPointId, false) ;
+    }
+    invalidate () ;
+    TTChangeNotifier::feedbackChanged (mBottomPointId, oldPosition, inPosition) ;
   }
 }
 
 //-----------------------------------------------------------------------------
 
-void TTDoublePoint::setWishedPosition(const uint8_t inPointId,
-                                      const TTPointPosition inPosition)
+template <class M>
+void TTDoublePointT <M>::setWishedPosition (const uint8_t inPointId,
+                                            const TTPointPosition inPosition,
+                                            const TTChangeSource inSource)
 {
   if (mTopPointId == inPointId &&
       mWishedTopPosition != inPosition &&
       (inPosition == kStraightPosition ||
        inPosition == kDiagonalPosition))
   {
+    const TTPointPosition oldPosition = mWishedTopPosition ;
     mWishedTopPosition = inPosition ;
-    mPendingWishedTopPosition = true ;
+    //--- As TTPointT::setWishedPosition
+    mPendingWishedTopPosition = inSource != kTTSyncSource && mWishedTopPosition != mActualTopPosition ;
+    mTopWishFailed = false ;
+    watchWish (mTopPointId, mPendingWishedTopPosition) ;
     mTopToggled = true ;
-    sendAction () ;
-    setNeedsDisplay () ;
+    //--- A synced wish is sent to the motor by the board it comes from
+    if (inSource != kTTSyncSource) {
+      sendAction () ;
+    }
+    invalidate () ;
+    TTChangeNotifier::wishChanged (mTopPointId, oldPosition, inPosition, inSource) ;
   }
   else if (mBottomPointId == inPointId &&
       mWishedBottomPosition != inPosition &&
       (inPosition == kStraightPosition ||
        inPosition == kDiagonalPosition))
   {
+    const TTPointPosition oldPosition = mWishedBottomPosition ;
     mWishedBottomPosition = inPosition ;
-    mPendingWishedBottomPosition = true ;
+    mPendingWishedBottomPosition = inSource != kTTSyncSource && mWishedBottomPosition != mActualBottomPosition ;
+    mBottomWishFailed = false ;
+    watchWish (mBottomPointId, mPendingWishedBottomPosition) ;
     mBottomToggled = true ;
-    sendAction () ;
-    setNeedsDisplay() ;
+    if (inSource != kTTSyncSource) {
+      sendAction () ;
+    }
+    invalidate () ;
+    TTChangeNotifier::wishChanged (mBottomPointId, oldPosition, inPosition, inSource) ;
   }
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTDoublePoint::actualPosition (const uint8_t inPointId)
+template <class M>
+TTPointPosition TTDoublePointT <M>::actualPosition (const uint8_t inPointId)
 {
   if (mTopPointId == inPointId) {
     return mActualTopPosition ;
@@ -850,7 +1436,8 @@ TTPointPosition TTDoublePoint::actualPosition (const uint8_t inPointId)
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTDoublePoint::wishedPosition (const uint8_t inPointId)
+template <class M>
+TTPointPosition TTDoublePointT <M>::wishedPosition (const uint8_t inPointId)
 {
   if (mTopPointId == inPointId) {
     return mWishedTopPosition ;
@@ -864,7 +1451,44 @@ TTPointPosition TTDoublePoint::wishedPosition (const uint8_t inPointId)
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTDoublePoint::pendingWish (uint8_t & outPointId)
+template <class M>
+void TTDoublePointT <M>::setWishFailed (const uint8_t inPointId)
+{
+  if (mTopPointId == inPointId && mPendingWishedTopPosition && ! mTopWishFailed) {
+    mTopWishFailed = true ;
+    invalidate () ;
+    updateBlinking () ;
+    TTChangeNotifier::wishFailed (mTopPointId, mActualTopPosition, mWishedTopPosition) ;
+  }
+  else if (mBottomPointId == inPointId && mPendingWishedBottomPosition && ! mBottomWishFailed) {
+    mBottomWishFailed = true ;
+    invalidate () ;
+    updateBlinking () ;
+    TTChangeNotifier::wishFailed (mBottomPointId, mActualBottomPosition, mWishedBottomPosition) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+bool TTDoublePointT <M>::wishFailed (const uint8_t inPointId)
+{
+  return (mTopPointId == inPointId && mTopWishFailed) ||
+         (mBottomPointId == inPointId && mBottomWishFailed) ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+bool TTDoublePointT <M>::blinking (void) const
+{
+  return (mPendingWishedTopPosition && mWishedTopPosition != mActualTopPosition &&
+          TTBlinkClock::blinks (mTopWishFailed ? kTTBlinkFailures : kTTBlinkWishes)) ||
+         (mPendingWishedBottomPosition && mWishedBottomPosition != mActualBottomPosition &&
+          TTBlinkClock::blinks (mBottomWishFailed ? kTTBlinkFailures : kTTBlinkWishes)) ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+TTPointPosition TTDoublePointT <M>::pendingWish (uint8_t & outPointId)
 {
   if (mTopToggled) {
     outPointId = mTopPointId ;
@@ -882,117 +1506,104 @@ TTPointPosition TTDoublePoint::pendingWish (uint8_t & outPointId)
 }
 
 //-----------------------------------------------------------------------------
-TTCanichePointPosition TTDoublePoint::pointToCanichePosition (TTPointPosition inPos)
+template <class M>
+void TTDoublePointT <M>::saveState (TTStateWriter & ioWriter) const
 {
-  switch (inPos) {
-    case kDiagonalPosition:
-      return mWay == kRightHand ? kCanicheRightPosition : kCanicheLeftPosition ;
-      break ;
-    case kStraightPosition:
-      return mWay == kRightHand ? kCanicheLeftPosition : kCanicheRightPosition ;
-      break ;
-    case kMiddlePosition:
-      return kCanicheMiddlePosition ;
-      break ;
-    case kNoPosition:
-      return kCanicheUnknownPosition ;
-      break ;
-    default:
-      return kCanicheUnknownPosition ;
-      break ;
-  }
+  ioWriter.write (mActualTopPosition, 2) ;
+  ioWriter.write (mWishedTopPosition, 2) ;
+  ioWriter.write (mActualBottomPosition, 2) ;
+  ioWriter.write (mWishedBottomPosition, 2) ;
 }
 
 //-----------------------------------------------------------------------------
-TTPointPosition TTDoublePoint::canicheToPointPosition (TTCanichePointPosition inPos)
-{
-  switch (inPos) {
-    case kCanicheLeftPosition:
-      return mWay == kRightHand ? kStraightPosition : kDiagonalPosition ;
-      break ;
-    case kCanicheRightPosition:
-      return mWay == kRightHand ? kDiagonalPosition : kStraightPosition ;
-      break ;
-    case kCanicheMiddlePosition:
-      return kMiddlePosition ;
-      break ;
-    case kCanicheUnknownPosition:
-      return kNoPosition ;
-      break ;
-    default:
-      return kNoPosition ;
-      break ;
-  }
+template <class M>
+void TTDoublePointT <M>::restoreState (TTStateReader & ioReader)
+{
+  mActualTopPosition = (TTPointPosition)ioReader.read (2) ;
+  mWishedTopPosition = (TTPointPosition)ioReader.read (2) ;
+  mActualBottomPosition = (TTPointPosition)ioReader.read (2) ;
+  mWishedBottomPosition = (TTPointPosition)ioReader.read (2) ;
+  mPendingWishedTopPosition = mWishedTopPosition != mActualTopPosition ;
+  mPendingWishedBottomPosition = mWishedBottomPosition != mActualBottomPosition ;
+  mTopWishFailed = false ;
+  watchWish (mTopPointId, mPendingWishedTopPosition) ;
+  mBottomWishFailed = false ;
+  watchWish (mBottomPointId, mPendingWishedBottomPosition) ;
+  mTopToggled = false ;
+  mBottomToggled = false ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawTopStraight (const AWRegion & inDrawRegion,
-                                     const AWColor inStraightColor ) const
+template <class M>
+void TTDoublePointT <M>::drawTopStraight (const AWRegion & inDrawRegion,
+                                          const AWColor inStraightColor ) const
 {
   //--- Draw the top straight track
-  AWContext::setColor (inStraightColor) ;
+  TTDraw::setColor (inStraightColor) ;
   AWRect r = absoluteFrame() ;
   int height = r.size.height ;
-  r.size.height = STRAIGHT_TRACK_WIDTH ;
-  r.size.width -= (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 8 ;
-  r.origin.x += 3 ;
-  r.origin.y += height - (TILE_PIXEL_GRID + STRAIGHT_TRACK_WIDTH) / 2 - 3 ;
+  r.size.height = M::kStraightWidth ;
+  r.size.width -= M::kTrackOffset + M::scaled (8) ;
+  r.origin.x += M::kMargin ;
+  r.origin.y += height - (M::kGrid + M::kStraightWidth) / 2 - M::kMargin ;
   if (mWay == kRightHand) {
-    r.origin.x += TILE_PIXEL_GRID / 2 ;
+    r.origin.x += M::kGrid / 2 ;
   }
-  r.fillRectInRegion (inDrawRegion) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawBottomStraight (const AWRegion & inDrawRegion,
-                                        const AWColor inStraightColor ) const
+template <class M>
+void TTDoublePointT <M>::drawBottomStraight (const AWRegion & inDrawRegion,
+                                             const AWColor inStraightColor ) const
 {
   //--- Draw the straight track
-  AWContext::setColor (inStraightColor) ;
+  TTDraw::setColor (inStraightColor) ;
   AWRect r = absoluteFrame() ;
-  r.size.height = STRAIGHT_TRACK_WIDTH ;
-  r.size.width -= (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 8 ;
-  r.origin.x += 3 ;
-  r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3 ;
+  r.size.height = M::kStraightWidth ;
+  r.size.width -= M::kTrackOffset + M::scaled (8) ;
+  r.origin.x += M::kMargin ;
+  r.origin.y += M::kTrackOffset + M::kMargin ;
   if (mWay == kLeftHand) {
-    r.origin.x += TILE_PIXEL_GRID / 2 ;
+    r.origin.x += M::kGrid / 2 ;
   }
-  r.fillRectInRegion (inDrawRegion) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawTopDiagonal (const AWRegion & inDrawRegion,
-                                     const AWColor inDiagonalColor) const
+template <class M>
+void TTDoublePointT <M>::drawTopDiagonal (const AWRegion & inDrawRegion,
+                                          const AWColor inDiagonalColor) const
 {
   //--- Draw the diagonal track
   int yOffset ;
   AWRect r = absoluteFrame () ;
   int height = r.size.height ;
   r.size.width = 1 ;
-  r.origin.x += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 5 ;
+  r.origin.x += M::kTrackOffset + M::scaled (5) ;
   if (mWay == kRightHand) {
     yOffset = -1 ;
-    r.origin.y += height - 9 - (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 ;
+    r.origin.y += height - M::scaled (9) - M::kTrackOffset ;
   }
   else {
     yOffset = 1 ;
-    r.origin.x += (height - 4 - TILE_PIXEL_GRID) / 2 - (height % 2);
-    r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3 + (height - 6 - TILE_PIXEL_GRID) / 2  - (height % 2);
+    r.origin.x += (height - M::scaled (4) - M::kGrid) / 2 - (height % 2);
+    r.origin.y += M::kTrackOffset + M::kMargin + (height - M::scaled (6) - M::kGrid) / 2  - (height % 2);
   }
 
-  AWContext::setColor (inDiagonalColor) ;
-  r.size.height = DIAGONAL_TRACK_WIDTH ;
+  TTDraw::setColor (inDiagonalColor) ;
+  r.size.height = M::kDiagonalWidth ;
 
   if (mWay == kRightHand) {
     r.size.height-- ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.size.height++ ;
     r.origin.x++ ;
     r.origin.y += (yOffset == -1) ? yOffset : 0 ;
   }
 
-  for (int x = 0 ; x < (height - 6 - TILE_PIXEL_GRID) / 2 ; x++) {
-    r.fillRectInRegion (inDrawRegion) ;
+  for (int x = 0 ; x < (height - M::scaled (6) - M::kGrid) / 2 ; x++) {
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x++ ;
     r.origin.y += yOffset ;
   }
@@ -1000,44 +1611,45 @@ void TTDoublePoint::drawTopDiagonal (const AWRegion & inDrawRegion,
   if (mWay == kLeftHand) {
     r.size.height-- ;
     r.origin.y -= (yOffset == -1) ? yOffset : 0 ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
   }
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawBottomDiagonal (const AWRegion & inDrawRegion,
-                                        const AWColor inDiagonalColor ) const
+template <class M>
+void TTDoublePointT <M>::drawBottomDiagonal (const AWRegion & inDrawRegion,
+                                             const AWColor inDiagonalColor ) const
 {
   //--- Draw the diagonal track
   int yOffset ;
   AWRect r = absoluteFrame () ;
   int height = r.size.height ;
   r.size.width = 1 ;
-  r.origin.x += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 5 ;
+  r.origin.x += M::kTrackOffset + M::scaled (5) ;
   if (mWay == kRightHand) {
     yOffset = -1 ;
-    r.origin.x += (height - 4 - TILE_PIXEL_GRID) / 2 ;
-    r.origin.y += (height - 8) / 2 ;
+    r.origin.x += (height - M::scaled (4) - M::kGrid) / 2 ;
+    r.origin.y += (height - M::scaled (8)) / 2 ;
   }
   else {
     yOffset = 1 ;
-    r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 + 3 ;
+    r.origin.y += M::kTrackOffset + M::kMargin ;
   }
 
-  AWContext::setColor (inDiagonalColor) ;
-  r.size.height = DIAGONAL_TRACK_WIDTH ;
+  TTDraw::setColor (inDiagonalColor) ;
+  r.size.height = M::kDiagonalWidth ;
 
   if (mWay == kLeftHand) {
     r.size.height-- ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.size.height++ ;
     r.origin.x++ ;
     r.origin.y += (yOffset == -1) ? yOffset : 0 ;
   }
 
-  int limit = (height - 6 - TILE_PIXEL_GRID) / 2 - (height % 2);
+  int limit = (height - M::scaled (6) - M::kGrid) / 2 - (height % 2);
   for (int x = 0 ; x < limit ; x++) {
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x++ ;
     r.origin.y += yOffset ;
   }
@@ -1045,108 +1657,123 @@ void TTDoublePoint::drawBottomDiagonal (const AWRegion & inDrawRegion,
   if (mWay == kRightHand) {
     r.size.height-- ;
     r.origin.y -= (yOffset == -1) ? yOffset : 0 ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
   }
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawStraightLogo (AWRect &inButton, const AWRegion & inDrawRegion) const
+template <class M>
+void TTDoublePointT <M>::drawStraightLogo (AWRect &inButton, const AWRegion & inDrawRegion) const
 {
   AWRect r = inButton ;
-  r.inset (12, 17) ;
-  r.translateBy (0, -5) ;
-  AWColor currentColor = AWContext::color () ;
-  AWContext::setColor (AWColor::gray ()) ;
-  r.fillRectInRegion (inDrawRegion) ;
-  AWContext::setColor (currentColor) ;
+  r.inset (M::scaled (12), M::scaled (17)) ;
+  r.translateBy (0, - M::scaled (5)) ;
+  AWColor currentColor = TTDraw::color () ;
+  TTDraw::setColor (AWColor::gray ()) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
+  TTDraw::setColor (currentColor) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawDiagonalLogo (AWRect &inButton, const AWRegion & inDrawRegion) const
+template <class M>
+void TTDoublePointT <M>::drawDiagonalLogo (AWRect &inButton, const AWRegion & inDrawRegion) const
 {
   AWRect r = inButton ;
-  r.inset (13, 0) ;
+  r.inset (M::scaled (13), 0) ;
   r.size.width = 1 ;
-  r.size.height = 4 ;
-  r.origin.y += 17 ;
+  r.size.height = M::scaled (4) ;
+  r.origin.y += M::scaled (17) ;
   AWInt yOffset = (mWay == kRightHand) ? -1 : 1 ;
-  if (mWay == kRightHand) r.origin.y += 11 ;
-  AWColor currentColor = AWContext::color () ;
-  AWContext::setColor (AWColor::gray ()) ;
-  for (int i = 0 ; i < 11 ; i++) {
-    r.fillRectInRegion (inDrawRegion) ;
+  if (mWay == kRightHand) r.origin.y += M::scaled (11) ;
+  AWColor currentColor = TTDraw::color () ;
+  TTDraw::setColor (AWColor::gray ()) ;
+  for (int i = 0 ; i < M::scaled (11) ; i++) {
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.translateBy (1, yOffset) ;
   }
-  AWContext::setColor (currentColor) ;
+  TTDraw::setColor (currentColor) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTDoublePointT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect trackRect = absoluteFrame() ;
-  trackRect.inset(3, 3);
-  AWContext::setColor (feedback () ? feedbackColor : buttonBackColor) ;
+  trackRect.inset (M::kMargin, M::kMargin);
+  TTDraw::setColor (feedback () ? feedbackColor : buttonBackColor) ;
   if (mSize == kLargeNoSync) {
     if (mTouchInProgress) {
-      mFeedbackRect.fillRoundRectInRegion (4, inDrawRegion) ;
+      TTDraw::fillRoundRect (feedbackRect (), M::kButtonRadius, inDrawRegion) ;
     }
     else {
       AWRect subButtonRect = trackRect ;
       subButtonRect.size.width /= 2 ;
       subButtonRect.size.height /= 2 ;
-      subButtonRect.fillRoundRectInRegion(4, inDrawRegion) ;
+      TTDraw::fillRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
       subButtonRect.origin.x += subButtonRect.size.width ;
-      subButtonRect.fillRoundRectInRegion(4, inDrawRegion) ;
+      TTDraw::fillRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
       subButtonRect.origin.y += subButtonRect.size.height ;
-      subButtonRect.fillRoundRectInRegion(4, inDrawRegion) ;
+      TTDraw::fillRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
       subButtonRect.origin.x -= subButtonRect.size.width ;
-      subButtonRect.fillRoundRectInRegion(4, inDrawRegion) ;
+      TTDraw::fillRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
     }
   }
   else {
-    trackRect.fillRoundRectInRegion (4, inDrawRegion) ;
+    TTDraw::fillRoundRect (trackRect, M::kButtonRadius, inDrawRegion) ;
   }
-  AWContext::setColor (buttonFrameColor) ;
+  TTDraw::setColor (buttonFrameColor) ;
   if (mSize == kLargeNoSync) {
     AWRect subButtonRect = trackRect ;
     subButtonRect.size.width /= 2 ;
     subButtonRect.size.height /= 2 ;
-    subButtonRect.frameRoundRectInRegion(4, inDrawRegion) ;
+    TTDraw::frameRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
     if (mWay == kRightHand) drawDiagonalLogo (subButtonRect, inDrawRegion) ;
     subButtonRect.origin.x += subButtonRect.size.width ;
-    subButtonRect.frameRoundRectInRegion(4, inDrawRegion) ;
+    TTDraw::frameRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
     if (mWay == kLeftHand) drawDiagonalLogo (subButtonRect, inDrawRegion) ;
     subButtonRect.origin.y += subButtonRect.size.height ;
-    subButtonRect.frameRoundRectInRegion(4, inDrawRegion) ;
+    TTDraw::frameRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
     if (mWay == kRightHand) drawStraightLogo (subButtonRect, inDrawRegion) ;
     subButtonRect.origin.x -= subButtonRect.size.width ;
-    subButtonRect.frameRoundRectInRegion(4, inDrawRegion) ;
+    TTDraw::frameRoundRect (subButtonRect, M::kButtonRadius, inDrawRegion) ;
     if (mWay == kLeftHand) drawStraightLogo (subButtonRect, inDrawRegion) ;
   }
   else {
-    trackRect.frameRoundRectInRegion (4, inDrawRegion) ;
+    TTDraw::frameRoundRect (trackRect, M::kButtonRadius, inDrawRegion) ;
   }
 #ifdef DEBUG_TRACK
   drawFrame (inDrawRegion) ;
 #endif
 
+  AWColor topWishColor = mTopWishFailed ? wishFailedColor : wishedPosColor ;
+  if (! TTBlinkClock::visible (mTopWishFailed ? kTTBlinkFailures : kTTBlinkWishes)) {
+    topWishColor = inactiveTrackColor ;
+  }
+  AWColor bottomWishColor = mBottomWishFailed ? wishFailedColor : wishedPosColor ;
+  if (! TTBlinkClock::visible (mBottomWishFailed ? kTTBlinkFailures : kTTBlinkWishes)) {
+    bottomWishColor = inactiveTrackColor ;
+  }
+
   switch (mActualTopPosition) {
     case kMiddlePosition:
       if (mWishedTopPosition == kStraightPosition) {
         drawTopDiagonal (inDrawRegion, inactiveTrackColor) ;
-        drawTopStraight (inDrawRegion, mPendingWishedTopPosition ? wishedPosColor : inactiveTrackColor) ;
+        drawTopStraight (inDrawRegion, mPendingWishedTopPosition ? topWishColor : inactiveTrackColor) ;
       }
       else { /* kDiagonalPosition */
         drawTopStraight (inDrawRegion, inactiveTrackColor) ;
-        drawTopDiagonal (inDrawRegion, mPendingWishedTopPosition ? wishedPosColor : inactiveTrackColor) ;
+        drawTopDiagonal (inDrawRegion, mPendingWishedTopPosition ? topWishColor : inactiveTrackColor) ;
       }
       break ;
     case kStraightPosition:
-      drawTopDiagonal (inDrawRegion, mWishedTopPosition == kStraightPosition ? inactiveTrackColor : mPendingWishedTopPosition ? wishedPosColor : inactiveTrackColor) ;
+      drawTopDiagonal (inDrawRegion, mWishedTopPosition == kStraightPosition ? inactiveTrackColor : mPendingWishedTopPosition ? topWishColor : inactiveTrackColor) ;
       drawTopStraight (inDrawRegion, activeTrackColor) ;
       break ;
     case kDiagonalPosition:
-      drawTopStraight (inDrawRegion, mWishedTopPosition == kDiagonalPosition ? inactiveTrackColor : mPendingWishedTopPosition ? wishedPosColor : inactiveTrackColor) ;
+      drawTopStraight (inDrawRegion, mWishedTopPosition == kDiagonalPosition ? inactiveTrackColor : mPendingWishedTopPosition ? topWishColor : inactiveTrackColor) ;
       drawTopDiagonal (inDrawRegion, activeTrackColor) ;
       break ;
     default:
@@ -1157,54 +1784,54 @@ void TTDoublePoint::drawInRegion ( const AWRegion & inDrawRegion ) const
     case kMiddlePosition:
       if (mWishedBottomPosition == kStraightPosition) {
         drawBottomDiagonal (inDrawRegion, inactiveTrackColor) ;
-        drawBottomStraight (inDrawRegion, mPendingWishedBottomPosition ? wishedPosColor : inactiveTrackColor) ;
+        drawBottomStraight (inDrawRegion, mPendingWishedBottomPosition ? bottomWishColor : inactiveTrackColor) ;
       }
       else { /* kDiagonalPosition */
         drawBottomStraight (inDrawRegion, inactiveTrackColor) ;
-        drawBottomDiagonal (inDrawRegion, mPendingWishedBottomPosition ? wishedPosColor : inactiveTrackColor) ;
+        drawBottomDiagonal (inDrawRegion, mPendingWishedBottomPosition ? bottomWishColor : inactiveTrackColor) ;
       }
       break ;
     case kStraightPosition:
-      drawBottomDiagonal (inDrawRegion, mWishedBottomPosition == kStraightPosition ? inactiveTrackColor : mPendingWishedBottomPosition ? wishedPosColor : inactiveTrackColor) ;
+      drawBottomDiagonal (inDrawRegion, mWishedBottomPosition == kStraightPosition ? inactiveTrackColor : mPendingWishedBottomPosition ? bottomWishColor : inactiveTrackColor) ;
       drawBottomStraight (inDrawRegion, activeTrackColor) ;
       break ;
     case kDiagonalPosition:
-      drawBottomStraight (inDrawRegion, mWishedBottomPosition == kDiagonalPosition ? inactiveTrackColor : mPendingWishedBottomPosition ? wishedPosColor : inactiveTrackColor) ;
+      drawBottomStraight (inDrawRegion, mWishedBottomPosition == kDiagonalPosition ? inactiveTrackColor : mPendingWishedBottomPosition ? bottomWishColor : inactiveTrackColor) ;
       drawBottomDiagonal (inDrawRegion, activeTrackColor) ;
       break ;
     default:
       break ;
   }
 
-  AWContext::setColor( activeTrackColor ) ;
+  TTDraw::setColor( activeTrackColor ) ;
   AWRect r = trackRect ;
   int height = r.size.height ;
-  r.size.width = TILE_PIXEL_GRID / 2;
-  r.size.height = STRAIGHT_TRACK_WIDTH ;
-  r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 ;
+  r.size.width = M::kGrid / 2;
+  r.size.height = M::kStraightWidth ;
+  r.origin.y += M::kTrackOffset ;
   if (mWay == kRightHand) {
-    r.origin.x += height - TILE_PIXEL_GRID / 2 ;
-    r.fillRectInRegion (inDrawRegion) ;
-    r.origin.x -= height - TILE_PIXEL_GRID / 2 ;
-    r.origin.y += height - TILE_PIXEL_GRID ;
-    r.fillRectInRegion (inDrawRegion) ;
+    r.origin.x += height - M::kGrid / 2 ;
+    TTDraw::fillRect (r, inDrawRegion) ;
+    r.origin.x -= height - M::kGrid / 2 ;
+    r.origin.y += height - M::kGrid ;
+    TTDraw::fillRect (r, inDrawRegion) ;
   }
   else {
-    r.fillRectInRegion (inDrawRegion) ;
-    r.origin.x += height - TILE_PIXEL_GRID / 2 ;
-    r.origin.y += height - TILE_PIXEL_GRID ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
+    r.origin.x += height - M::kGrid / 2 ;
+    r.origin.y += height - M::kGrid ;
+    TTDraw::fillRect (r, inDrawRegion) ;
   }
 
 #ifdef TRACK_TAG
   r = trackRect ;
-  AWContext::setColor(awkTextColor) ;
+  TTDraw::setColor(awkTextColor) ;
   String textBottom (mBottomPointId) ;
   String textTop (mTopPointId) ;
-  AWInt xBottom = r.origin.x + (mWay == kRightHand ? r.size.width - 5 - kTTTagFont.stringLength(textBottom) : 5 ) ;
-  AWInt xTop = r.origin.x + (mWay == kLeftHand ? r.size.width - 5 - kTTTagFont.stringLength(textTop) : 5 ) ;
-  kTTTagFont.drawStringInRegion(xBottom, r.origin.y + 22, textBottom, inDrawRegion) ;
-  kTTTagFont.drawStringInRegion(xTop, r.origin.y + r.size.height - 22 - awkDefaultFont.ascent (), textTop, inDrawRegion) ;
+  AWInt xBottom = r.origin.x + (mWay == kRightHand ? r.size.width - M::kTagInset - kTTTagFont.stringLength(textBottom) : M::kTagInset ) ;
+  AWInt xTop = r.origin.x + (mWay == kLeftHand ? r.size.width - M::kTagInset - kTTTagFont.stringLength(textTop) : M::kTagInset ) ;
+  TTDraw::drawString (kTTTagFont, xBottom, r.origin.y + M::scaled (22), textBottom, inDrawRegion) ;
+  TTDraw::drawString (kTTTagFont, xTop, r.origin.y + r.size.height - M::scaled (22) - awkDefaultFont.ascent (), textTop, inDrawRegion) ;
 #endif
 }
 
@@ -1214,14 +1841,30 @@ static const uint8_t kTopLeft = 2 ;
 static const uint8_t kTopRight = 3 ;
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::touchDown (const AWPoint & inPoint)
+template <class M>
+AWRect TTDoublePointT <M>::feedbackRect (void) const
+{
+  AWRect r = absoluteFrame () ;
+  r.inset (M::kMargin, M::kMargin) ;
+  r.size.width /= 2 ;
+  r.size.height /= 2 ;
+  r.translateBy ((mTouchLocation & 1) * r.size.width, (mTouchLocation >> 1) * r.size.height) ;
+  return r ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTDoublePointT <M>::touchDown (const AWPoint & inPoint)
 {
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalTouchDown, inPoint, viewport () != NULL) ;
+#endif
   AWRect r = absoluteFrame ();
-  r.inset(3, 3);
+  r.inset (M::kMargin, M::kMargin);
   if (mSize != kLargeNoSync) {
     if (r.containsPoint(inPoint)) {
       setFeedback (true) ;
-      setNeedsDisplay() ;
+      invalidate () ;
     }
   }
   else {
@@ -1235,49 +1878,56 @@ void TTDoublePoint::touchDown (const AWPoint & inPoint)
       r.size.width /= 2 ;
       r.size.height /= 2 ;
       r.translateBy(normalizedPoint.x * r.size.width, normalizedPoint.y * r.size.height) ;
-      mFeedbackRect = r ;
       mTouchInProgress = true ;
       setFeedback (true) ;
-      setNeedsDisplayInRect(r) ;
+      invalidateRect (r) ;
     }
   }
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::touchMove (const AWPoint & inPoint)
+template <class M>
+void TTDoublePointT <M>::touchMove (const AWPoint & inPoint)
 {
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalTouchMove, inPoint, viewport () != NULL) ;
+#endif
   AWRect r ;
   if (mSize == kLargeNoSync) {
-    r = mFeedbackRect ;
+    r = feedbackRect () ;
   }
   else {
     r = absoluteFrame () ;
-    r.inset (3, 3) ;
+    r.inset (M::kMargin, M::kMargin) ;
   }
   if (r.containsPoint (inPoint)) {
     if (! feedback ()) {
       setFeedback (true) ;
-      setNeedsDisplayInRect(r) ;
+      invalidateRect (r) ;
     }
   }
   else {
     if (feedback ()) {
       setFeedback (false) ;
-      setNeedsDisplayInRect(r) ;
+      invalidateRect (r) ;
     }
   }
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::touchUp (const AWPoint & inPoint)
+template <class M>
+void TTDoublePointT <M>::touchUp (const AWPoint & inPoint)
 {
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalTouchUp, inPoint, viewport () != NULL) ;
+#endif
   AWRect r ;
   if (mSize == kLargeNoSync) {
-    r = mFeedbackRect ;
+    r = feedbackRect () ;
   }
   else {
     r = absoluteFrame();
-    r.inset(3, 3);
+    r.inset (M::kMargin, M::kMargin);
   }
   if (r.containsPoint(inPoint)) {
     setFeedback(false) ;
@@ -1325,8 +1975,12 @@ void TTDoublePoint::touchUp (const AWPoint & inPoint)
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::toggle ()
+template <class M>
+void TTDoublePointT <M>::toggle ()
 {
+  if (! canToggle (mTopPointId) || ! canToggle (mBottomPointId)) return ;
+  const TTPointPosition oldTopPosition = mWishedTopPosition ;
+  const TTPointPosition oldBottomPosition = mWishedBottomPosition ;
   if (mWishedTopPosition == kStraightPosition) {
     mWishedTopPosition = kDiagonalPosition ;
   }
@@ -1341,15 +1995,24 @@ void TTDoublePoint::toggle ()
   }
   mTopToggled = true ;
   mBottomToggled = true ;
-  mPendingWishedTopPosition = true ;
-  mPendingWishedBottomPosition = true ;
-  setNeedsDisplay () ;
+  mPendingWishedTopPosition = mWishedTopPosition != mActualTopPosition ;
+  mPendingWishedBottomPosition = mWishedBottomPosition != mActualBottomPosition ;
+  mTopWishFailed = false ;
+  watchWish (mTopPointId, mPendingWishedTopPosition) ;
+  mBottomWishFailed = false ;
+  watchWish (mBottomPointId, mPendingWishedBottomPosition) ;
+  invalidate () ;
   sendAction () ;
+  notifyWishChanges (oldTopPosition, oldBottomPosition, kTTTouchSource) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::toggleTop ()
+template <class M>
+void TTDoublePointT <M>::toggleTop ()
 {
+  if (! canToggle (mTopPointId)) return ;
+  const TTPointPosition oldTopPosition = mWishedTopPosition ;
+  const TTPointPosition oldBottomPosition = mWishedBottomPosition ;
   if (mWishedTopPosition == kStraightPosition) {
     mWishedTopPosition = kDiagonalPosition ;
   }
@@ -1357,14 +2020,21 @@ void TTDoublePoint::toggleTop ()
     mWishedTopPosition = kStraightPosition ;
   }
   mTopToggled = true ;
-  mPendingWishedTopPosition = true ;
-  setNeedsDisplay () ;
+  mPendingWishedTopPosition = mWishedTopPosition != mActualTopPosition ;
+  mTopWishFailed = false ;
+  watchWish (mTopPointId, mPendingWishedTopPosition) ;
+  invalidate () ;
   sendAction () ;
+  notifyWishChanges (oldTopPosition, oldBottomPosition, kTTTouchSource) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::toggleBottom ()
+template <class M>
+void TTDoublePointT <M>::toggleBottom ()
 {
+  if (! canToggle (mBottomPointId)) return ;
+  const TTPointPosition oldTopPosition = mWishedTopPosition ;
+  const TTPointPosition oldBottomPosition = mWishedBottomPosition ;
   if (mWishedBottomPosition == kStraightPosition) {
     mWishedBottomPosition = kDiagonalPosition ;
   }
@@ -1372,230 +2042,279 @@ void TTDoublePoint::toggleBottom ()
     mWishedBottomPosition = kStraightPosition ;
   }
   mBottomToggled = true ;
-  mPendingWishedBottomPosition = true ;
-  setNeedsDisplay () ;
+  mPendingWishedBottomPosition = mWishedBottomPosition != mActualBottomPosition ;
+  mBottomWishFailed = false ;
+  watchWish (mBottomPointId, mPendingWishedBottomPosition) ;
+  invalidate () ;
   sendAction () ;
+  notifyWishChanges (oldTopPosition, oldBottomPosition, kTTTouchSource) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::setStraight ()
+template <class M>
+void TTDoublePointT <M>::setStraight ()
 {
+  if (! canToggle (mTopPointId) || ! canToggle (mBottomPointId)) return ;
+  const TTPointPosition oldTopPosition = mWishedTopPosition ;
+  const TTPointPosition oldBottomPosition = mWishedBottomPosition ;
   mWishedTopPosition = mWishedBottomPosition = kStraightPosition ;
-  mPendingWishedTopPosition = mPendingWishedBottomPosition = true ;
+  mPendingWishedTopPosition = mWishedTopPosition != mActualTopPosition ;
+  mPendingWishedBottomPosition = mWishedBottomPosition != mActualBottomPosition ;
+  mTopWishFailed = false ;
+  watchWish (mTopPointId, mPendingWishedTopPosition) ;
+  mBottomWishFailed = false ;
+  watchWish (mBottomPointId, mPendingWishedBottomPosition) ;
   mTopToggled = true ;
   mBottomToggled = true ;
-  setNeedsDisplay () ;
+  invalidate () ;
   sendAction () ;
+  notifyWishChanges (oldTopPosition, oldBottomPosition, kTTTouchSource) ;
 }
 
 //-----------------------------------------------------------------------------
-void TTDoublePoint::setDiagonal ()
+template <class M>
+void TTDoublePointT <M>::setDiagonal ()
 {
+  if (! canToggle (mTopPointId) || ! canToggle (mBottomPointId)) return ;
+  const TTPointPosition oldTopPosition = mWishedTopPosition ;
+  const TTPointPosition oldBottomPosition = mWishedBottomPosition ;
   mWishedTopPosition = mWishedBottomPosition = kDiagonalPosition ;
-  mPendingWishedTopPosition = mPendingWishedBottomPosition = true ;
+  mPendingWishedTopPosition = mWishedTopPosition != mActualTopPosition ;
+  mPendingWishedBottomPosition = mWishedBottomPosition != mActualBottomPosition ;
+  mTopWishFailed = false ;
+  watchWish (mTopPointId, mPendingWishedTopPosition) ;
+  mBottomWishFailed = false ;
+  watchWish (mBottomPointId, mPendingWishedBottomPosition) ;
   mTopToggled = true ;
   mBottomToggled = true ;
-  setNeedsDisplay () ;
+  invalidate () ;
   sendAction () ;
+  notifyWishChanges (oldTopPosition, oldBottomPosition, kTTTouchSource) ;
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTDoublePointT <M>::notifyWishChanges (const TTPointPosition inOldTopPosition,
+                                            const TTPointPosition inOldBottomPosition,
+                                            const TTChangeSource inSource) const
+{
+  if (mWishedTopPosition != inOldTopPosition) {
+    TTChangeNotifier::wishChanged (mTopPointId, inOldTopPosition, mWishedTopPosition, inSource) ;
+  }
+  if (mWishedBottomPosition != inOldBottomPosition) {
+    TTChangeNotifier::wishChanged (mBottomPointId, inOldBottomPosition, mWishedBottomPosition, inSource) ;
+  }
 }
 
 //=============================================================================
-TTSlip::TTSlip (const AWPoint & inOrigin,
-                const int  inKind,
-                const bool inWay,
-                const bool inIsReverted) :
-TTTrack ( inOrigin, 3, 3, inIsReverted ),
+template <class M>
+TTSlipT <M>::TTSlipT (const AWPoint & inOrigin,
+                      const int  inKind,
+                      const bool inWay,
+                      const bool inIsReverted) :
+TTTrack ( M::tileFrame (inOrigin, 3, 3), inIsReverted ),
 mKind (inKind),
 mWay (inWay)
 {
 }
 
 //-----------------------------------------------------------------------------
-void TTSlip::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTSlipT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect trackRect = absoluteFrame() ;
-  AWContext::setColor ( AWColor::lightGray() ) ;
+  TTDraw::setColor ( AWColor::lightGray() ) ;
   AWRect touchableZone = trackRect ;
   touchableZone.size.width /= 2 ;
-  touchableZone.frameRoundRectInRegion (4, inDrawRegion) ;
+  TTDraw::frameRoundRect (touchableZone, M::kButtonRadius, inDrawRegion) ;
   touchableZone.translateBy(touchableZone.size.width, 0) ;
-  touchableZone.frameRoundRectInRegion (4, inDrawRegion) ;
+  TTDraw::frameRoundRect (touchableZone, M::kButtonRadius, inDrawRegion) ;
 #ifdef DEBUG_TRACK
   drawFrame( inDrawRegion ) ;
 #endif
-  AWContext::setColor( activeTrackColor ) ;
-  trackRect.inset(0, 20) ;
-  trackRect.fillRectInRegion(inDrawRegion) ;
+  TTDraw::setColor( activeTrackColor ) ;
+  trackRect.inset(0, M::scaled (20)) ;
+  TTDraw::fillRect (trackRect, inDrawRegion) ;
   AWRect r = absoluteFrame() ;
   AWPoint origin = r.origin ;
-  r.size.height = TILE_PIXEL_GRID / 3 + 1 ;
+  r.size.height = M::kGrid / 3 + 1 ;
   int yOffset ;
   if (mWay == kLeftHand) {
-    r.origin.y += TILE_PIXEL_GRID / 3 ;
+    r.origin.y += M::kGrid / 3 ;
     yOffset = 1 ;
   }
   else {
-    r.origin.y += 2 * TILE_PIXEL_GRID + TILE_PIXEL_GRID / 3 - 1;
+    r.origin.y += 2 * M::kGrid + M::kGrid / 3 - 1;
     yOffset = -1 ;
   }
-  for (int x = 0; x < TILE_PIXEL_GRID * 3 ; x += 3) {
+  for (int x = 0; x < M::kGrid * 3 ; x += 3) {
     r.size.width = 2 ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x += 2 ;
     r.origin.y += yOffset ;
     r.size.width = 1 ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x += 1 ;
     r.origin.y += yOffset ;
   }
-  AWContext::setColor( AWColor::black() ) ;
-  AWPoint p1 (15, 10);  p1.translateBy (origin) ;
-  AWPoint p2 (24, 16); p2.translateBy (origin) ;
-  AWPoint p3 (34, 16); p3.translateBy (origin) ;
-  AWPoint p4 (10, 28);  p4.translateBy (origin) ;
-  AWPoint p5 (21, 28); p5.translateBy (origin) ;
-  AWPoint p6 (30, 34); p6.translateBy (origin) ;
+  TTDraw::setColor( AWColor::black() ) ;
+  AWPoint p1 (M::scaled (15), M::scaled (10)) ;  p1.translateBy (origin) ;
+  AWPoint p2 (M::scaled (24), M::scaled (16)) ; p2.translateBy (origin) ;
+  AWPoint p3 (M::scaled (34), M::scaled (16)) ; p3.translateBy (origin) ;
+  AWPoint p4 (M::scaled (10), M::scaled (28)) ;  p4.translateBy (origin) ;
+  AWPoint p5 (M::scaled (21), M::scaled (28)) ; p5.translateBy (origin) ;
+  AWPoint p6 (M::scaled (30), M::scaled (34)) ; p6.translateBy (origin) ;
 
   if (isReverted ()) {
     if (mKind & kSlipLeft) {
-      p1.strokeLineInRegion (p2, inDrawRegion) ;
-      p2.strokeLineInRegion (p3, inDrawRegion) ;
+      TTDraw::strokeLine (p1, p2, inDrawRegion) ;
+      TTDraw::strokeLine (p2, p3, inDrawRegion) ;
     }
     if (mKind & kSlipRight) {
-      p4.strokeLineInRegion (p5, inDrawRegion) ;
-      p5.strokeLineInRegion (p6, inDrawRegion) ;
+      TTDraw::strokeLine (p4, p5, inDrawRegion) ;
+      TTDraw::strokeLine (p5, p6, inDrawRegion) ;
     }
   }
   else {
     if (mKind & kSlipLeft) {
-      p4.strokeLineInRegion (p5, inDrawRegion) ;
-      p5.strokeLineInRegion (p6, inDrawRegion) ;
+      TTDraw::strokeLine (p4, p5, inDrawRegion) ;
+      TTDraw::strokeLine (p5, p6, inDrawRegion) ;
     }
     if (mKind & kSlipRight) {
-      p1.strokeLineInRegion (p2, inDrawRegion) ;
-      p2.strokeLineInRegion (p3, inDrawRegion) ;
+      TTDraw::strokeLine (p1, p2, inDrawRegion) ;
+      TTDraw::strokeLine (p2, p3, inDrawRegion) ;
     }
   }
 }
 
 //=============================================================================
-TTDiag::TTDiag (const AWPoint & inOrigin,
-                const AWInt inSize,
-                const bool inWay,
-                const bool inIsReverted) :
-  TTTrack (computeTileRelativeFrameWithMargin(inOrigin, inSize, inSize), inIsReverted),
+template <class M>
+TTDiagT <M>::TTDiagT (const AWPoint & inOrigin,
+                      const AWInt inSize,
+                      const bool inWay,
+                      const bool inIsReverted) :
+  TTTrack (M::tileFrameWithMargin (inOrigin, inSize, inSize), inIsReverted),
   mWay (inWay)
 {
 }
 
 //-----------------------------------------------------------------------------
-void TTDiag::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTDiagT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect r = absoluteFrame() ;
 #ifdef DEBUG_TRACK
   drawFrame( inDrawRegion ) ;
 #endif
-  AWContext::setColor (activeTrackColor) ;
+  TTDraw::setColor (activeTrackColor) ;
   int count = r.size.width ;
   int yOffset ;
   if (mWay == kLeftHand) {
-    r.origin.y -= DIAGONAL_TRACK_WIDTH / 2 ;
+    r.origin.y -= M::kDiagonalWidth / 2 ;
     yOffset = 1 ;
   }
   else {
-    r.origin.y += r.size.height - DIAGONAL_TRACK_WIDTH / 2 - 1 ;
+    r.origin.y += r.size.height - M::kDiagonalWidth / 2 - 1 ;
     yOffset = -1 ;
   }
-  r.size.height = DIAGONAL_TRACK_WIDTH ;
+  r.size.height = M::kDiagonalWidth ;
   r.size.width = 1 ;
   for (int x = 0; x < count ; x++) {
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x += 1 ;
     r.origin.y += yOffset ;
   }
 }
 
 //=============================================================================
-TTArrow::TTArrow (const AWPoint & inOrigin,
-                  const bool inIsReverted) :
-TTTrack ( inOrigin, 1, 1, inIsReverted )
+template <class M>
+TTArrowT <M>::TTArrowT (const AWPoint & inOrigin,
+                        const bool inIsReverted) :
+TTTrack ( M::tileFrame (inOrigin, 1, 1), inIsReverted )
 {
 }
 
 //-----------------------------------------------------------------------------
-void TTArrow::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTArrowT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect r = absoluteFrame() ;
-//  AWContext::setColor ( AWColor::white() ) ;
-//  r.fillRectInRegion (inDrawRegion) ;
+//  TTDraw::setColor ( AWColor::white() ) ;
+//  TTDraw::fillRect (r, inDrawRegion) ;
 #ifdef DEBUG_TRACK
   drawFrame( inDrawRegion ) ;
 #endif
-  AWContext::setColor( activeTrackColor ) ;
+  TTDraw::setColor( activeTrackColor ) ;
   int xOffset;
-  r.inset(0, 2) ;
+  r.inset(0, M::scaled (2)) ;
   if (isReverted()) {
     xOffset = -1;
-    r.origin.x += TILE_PIXEL_GRID - 4 ;
+    r.origin.x += M::kGrid - M::scaled (4) ;
   }
   else {
     xOffset = 1;
-    r.origin.x += 3 ;
+    r.origin.x += M::scaled (3) ;
   }
-  for (int x = 0; x < TILE_PIXEL_GRID / 2 ; x++) {
+  for (int x = 0; x < M::kGrid / 2 ; x++) {
     r.size.width = 1 ;
-    r.fillRectInRegion (inDrawRegion) ;
+    TTDraw::fillRect (r, inDrawRegion) ;
     r.origin.x += xOffset ;
     r.origin.y += 1 ;
     r.size.height -= 2 ;
   }
   r = absoluteFrame ();
-  r.origin.y += (TILE_PIXEL_GRID - STRAIGHT_TRACK_WIDTH) / 2 ;
-  r.size.height = STRAIGHT_TRACK_WIDTH ;
-  r.size.width = 3;
-  if (isReverted()) r.origin.x += TILE_PIXEL_GRID - 3;
-  r.fillRectInRegion (inDrawRegion) ;
+  r.origin.y += M::kTrackOffset ;
+  r.size.height = M::kStraightWidth ;
+  r.size.width = M::scaled (3) ;
+  if (isReverted()) r.origin.x += M::kGrid - M::scaled (3) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 }
 
 //=============================================================================
-TTBuffer::TTBuffer (const AWPoint & inOrigin,
-                  const bool inIsReverted) :
-TTTrack (inOrigin, 1, 1, inIsReverted)
+template <class M>
+TTBufferT <M>::TTBufferT (const AWPoint & inOrigin,
+                        const bool inIsReverted) :
+TTTrack (M::tileFrame (inOrigin, 1, 1), inIsReverted)
 {
 }
 
 //-----------------------------------------------------------------------------
-void TTBuffer::drawInRegion ( const AWRegion & inDrawRegion ) const
+template <class M>
+void TTBufferT <M>::drawInRegion ( const AWRegion & inDrawRegion ) const
 {
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect r = absoluteFrame () ;
 #ifdef DEBUG_TRACK
   drawFrame (inDrawRegion) ;
 #endif
-  AWContext::setColor( activeTrackColor ) ;
-  r.inset(0, 3);
-  r.size.width = 5;
-  r.origin.x += isReverted () ? TILE_PIXEL_GRID - 5 : 0;
-  r.fillRectInRegion (inDrawRegion) ;
-  r.origin.x += isReverted () ? 3 : 0;
-  r.origin.y += 2;
-  r.size.width = 2;
-  r.size.height -= 4;
-  AWContext::setColor (TTBackColor) ;
-  r.fillRectInRegion (inDrawRegion) ;
-}
-
-//=============================================================================
-static AWRect computeDecouplerRelativeFrame(const AWPoint & inOrigin)
-{
-  AWRect r ( AWPoint (inOrigin.x * TILE_PIXEL_GRID - TILE_PIXEL_GRID / 4,
-                      inOrigin.y * TILE_PIXEL_GRID - TILE_PIXEL_GRID / 4),
-            AWSize (TILE_PIXEL_GRID + TILE_PIXEL_GRID / 2, TILE_PIXEL_GRID + TILE_PIXEL_GRID / 2) ) ;
-  return r ;
+  TTDraw::setColor( activeTrackColor ) ;
+  r.inset(0, M::scaled (3)) ;
+  r.size.width = M::scaled (5) ;
+  r.origin.x += isReverted () ? M::kGrid - M::scaled (5) : 0;
+  TTDraw::fillRect (r, inDrawRegion) ;
+  r.origin.x += isReverted () ? M::scaled (3) : 0;
+  r.origin.y += M::scaled (2) ;
+  r.size.width = M::scaled (2) ;
+  r.size.height -= M::scaled (4) ;
+  TTDraw::setColor (TTBackColor) ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 }
 
 //=============================================================================
-TTDecoupler::TTDecoupler (const AWPoint & inOrigin, const uint8_t inDecouplerId) :
-TTTouchableTrack (computeDecouplerRelativeFrame (inOrigin), false),
+TTAbstractDecoupler::TTAbstractDecoupler (const AWRect & inFrame,
+                                          const uint8_t inDecouplerId) :
+TTTouchableTrack (inFrame, false),
 mPosition (false),
 mDecouplerId (inDecouplerId)
 {
@@ -1603,18 +2322,29 @@ mDecouplerId (inDecouplerId)
 }
 
 //-----------------------------------------------------------------------------
-void TTDecoupler::registerDecouplerId (const uint8_t inDecouplerId)
+TTAbstractDecoupler::~TTAbstractDecoupler (void)
+{
+  if (mDecouplerId < kTTMaxNumberOfDecouplers && sDecouplerForIdentifier[mDecouplerId] == this) {
+    sDecouplerForIdentifier[mDecouplerId] = NULL ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractDecoupler::registerDecouplerId (const uint8_t inDecouplerId)
 {
   if (inDecouplerId < kTTMaxNumberOfDecouplers) {
     sDecouplerForIdentifier[inDecouplerId] = this ;
+#ifdef TT_GENERATION
+    TTGeneration::touch (kTTDecouplerObject, inDecouplerId) ;
+#endif
   }
 }
 
 //-----------------------------------------------------------------------------
-TTDecoupler *TTDecoupler::sDecouplerForIdentifier[kTTMaxNumberOfDecouplers] = { NULL } ;
+TTAbstractDecoupler *TTAbstractDecoupler::sDecouplerForIdentifier[kTTMaxNumberOfDecouplers] = { NULL } ;
 
 //-----------------------------------------------------------------------------
-bool TTDecoupler::positionOfDecoupler (const uint8_t inDecouplerId)
+bool TTAbstractDecoupler::positionOfDecoupler (const uint8_t inDecouplerId)
 {
   if (inDecouplerId < kTTMaxNumberOfDecouplers && sDecouplerForIdentifier[inDecouplerId] != NULL) {
     return sDecouplerForIdentifier[inDecouplerId]->position () ;
@@ -1625,8 +2355,32 @@ bool TTDecoupler::positionOfDecoupler (const uint8_t inDecouplerId)
 }
 
 //-----------------------------------------------------------------------------
-void TTDecoupler::setActionOfDecoupler (const uint8_t inDecouplerId,
-                                        AWAction inAction)
+void TTAbstractDecoupler::setPositionOfDecoupler (const uint8_t inDecouplerId,
+                                                  const bool inPosition,
+                                                  const TTChangeSource inSource)
+{
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalDecouplerPosition, inDecouplerId, inPosition) ;
+#endif
+  if (inDecouplerId < kTTMaxNumberOfDecouplers && sDecouplerForIdentifier[inDecouplerId] != NULL) {
+    TTAbstractDecoupler * decoupler = sDecouplerForIdentifier[inDecouplerId] ;
+    if (decoupler->mPosition != inPosition) {
+      decoupler->mPosition = inPosition ;
+      decoupler->invalidate () ;
+      TTChangeNotifier::decouplerChanged (inDecouplerId, ! inPosition, inPosition, inSource) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+bool TTAbstractDecoupler::decouplerExists (const uint8_t inDecouplerId)
+{
+  return inDecouplerId < kTTMaxNumberOfDecouplers && sDecouplerForIdentifier[inDecouplerId] != NULL ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractDecoupler::setActionOfDecoupler (const uint8_t inDecouplerId,
+                                                AWAction inAction)
 {
   if (inDecouplerId < kTTMaxNumberOfDecouplers && sDecouplerForIdentifier[inDecouplerId] != NULL) {
     sDecouplerForIdentifier[inDecouplerId]->setAction (inAction) ;
@@ -1634,7 +2388,7 @@ void TTDecoupler::setActionOfDecoupler (const uint8_t inDecouplerId,
 }
 
 //-----------------------------------------------------------------------------
-void TTDecoupler::setActionOfAllDecouplers (AWAction inAction)
+void TTAbstractDecoupler::setActionOfAllDecouplers (AWAction inAction)
 {
   for (uint8_t i = 0 ; i < kTTMaxNumberOfDecouplers ; i++) {
     setActionOfDecoupler (i, inAction) ;
@@ -1642,49 +2396,96 @@ void TTDecoupler::setActionOfAllDecouplers (AWAction inAction)
 }
 
 //-----------------------------------------------------------------------------
-void TTDecoupler::drawInRegion (const AWRegion & inDrawRegion) const
+void TTAbstractDecoupler::toggle ()
 {
+#ifdef TT_JOURNAL
+  TTJournalScope journalScope (kTTJournalDecouplerToggle, mDecouplerId, mPosition) ;
+#endif
+  mPosition = ! mPosition ;
+  invalidate () ;
+  sendAction () ;
+  TTChangeNotifier::decouplerChanged (mDecouplerId, ! mPosition, mPosition, kTTTouchSource) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractDecoupler::saveState (TTStateWriter & ioWriter) const
+{
+  ioWriter.write (mPosition, 1) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTAbstractDecoupler::restoreState (TTStateReader & ioReader)
+{
+  mPosition = ioReader.read (1) != 0 ;
+}
+
+//=============================================================================
+template <class M>
+TTDecouplerT <M>::TTDecouplerT (const AWPoint & inOrigin, const uint8_t inDecouplerId) :
+TTAbstractDecoupler (M::decouplerFrame (inOrigin), inDecouplerId)
+{
+}
+
+//-----------------------------------------------------------------------------
+template <class M>
+void TTDecouplerT <M>::drawInRegion (const AWRegion & inDrawRegion) const
+{
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (this) ;
+#endif
   AWRect r = absoluteFrame () ;
-  AWContext::setColor (feedback () ? feedbackColor : buttonBackColor) ;
-  r.fillRoundRectInRegion (4, inDrawRegion) ;
-  AWContext::setColor( buttonFrameColor ) ;
-  r.frameRoundRectInRegion (4, inDrawRegion) ;
+  TTDraw::setColor (feedback () ? feedbackColor : buttonBackColor) ;
+  TTDraw::fillRoundRect (r, M::kButtonRadius, inDrawRegion) ;
+  TTDraw::setColor( buttonFrameColor ) ;
+  TTDraw::frameRoundRect (r, M::kButtonRadius, inDrawRegion) ;
 #ifdef DEBUG_TRACK
   drawFrame (inDrawRegion) ;
 #endif
 
-  AWContext::setColor (activeTrackColor);
-  r.size.height = STRAIGHT_TRACK_WIDTH ;
-  r.origin.y += TILE_PIXEL_GRID / 2 + TILE_PIXEL_GRID / 4 - STRAIGHT_TRACK_WIDTH / 2 ;
-  r.fillRectInRegion (inDrawRegion) ;
+  TTDraw::setColor (activeTrackColor);
+  r.size.height = M::kStraightWidth ;
+  r.origin.y += M::kGrid / 2 + M::kGrid / 4 - M::kStraightWidth / 2 ;
+  TTDraw::fillRect (r, inDrawRegion) ;
 
   r = absoluteFrame() ;
-  AWContext::setColor (feedback () ? feedbackColor : buttonBackColor);
-  r.origin.x += r.size.width / 2 - STRAIGHT_TRACK_WIDTH -  STRAIGHT_TRACK_WIDTH / 2 ;
-  r.size.width = 3 * STRAIGHT_TRACK_WIDTH ;
-  r.origin.y += r.size.height / 2 - STRAIGHT_TRACK_WIDTH -  STRAIGHT_TRACK_WIDTH / 2 ;
-  r.size.height = 3 * STRAIGHT_TRACK_WIDTH ;
-  r.fillOvalInRegion (inDrawRegion) ;
+  TTDraw::setColor (feedback () ? feedbackColor : buttonBackColor);
+  r.origin.x += r.size.width / 2 - M::kStraightWidth -  M::kStraightWidth / 2 ;
+  r.size.width = 3 * M::kStraightWidth ;
+  r.origin.y += r.size.height / 2 - M::kStraightWidth -  M::kStraightWidth / 2 ;
+  r.size.height = 3 * M::kStraightWidth ;
+  TTDraw::fillOval (r, inDrawRegion) ;
 
-  AWContext::setColor (mPosition ? decoupleColor : activeTrackColor) ;
-  r.inset (2,2);
-  r.fillOvalInRegion (inDrawRegion) ;
+  TTDraw::setColor (position () ? decoupleColor : activeTrackColor) ;
+  r.inset (M::scaled (2), M::scaled (2)) ;
+  TTDraw::fillOval (r, inDrawRegion) ;
 
 #ifdef TRACK_TAG
   r = absoluteFrame() ;
-  AWContext::setColor(awkTextColor) ;
-  String text (mDecouplerId) ;
-  r.origin.x += 3 ;
-  r.origin.y += 3 ;
-  kTTTagFont.drawStringInRegion(r.origin.x, r.origin.y, text, inDrawRegion) ;
+  TTDraw::setColor(awkTextColor) ;
+  String text (identifier ()) ;
+  r.origin.x += M::scaled (3) ;
+  r.origin.y += M::scaled (3) ;
+  TTDraw::drawString (kTTTagFont, r.origin.x, r.origin.y, text, inDrawRegion) ;
 #endif
 }
 
-//-----------------------------------------------------------------------------
-void TTDecoupler::toggle ()
-{
-  mPosition = ! mPosition ;
-  setNeedsDisplay () ;
-  sendAction () ;
-}
-
+//=============================================================================
+// Instantiation of the tiles for the metrics used by the library
+//=============================================================================
+template class TTBlockT <TTDefaultMetrics> ;
+template class TTPointT <TTDefaultMetrics> ;
+template class TTDoublePointT <TTDefaultMetrics> ;
+template class TTSlipT <TTDefaultMetrics> ;
+template class TTDiagT <TTDefaultMetrics> ;
+template class TTArrowT <TTDefaultMetrics> ;
+template class TTBufferT <TTDefaultMetrics> ;
+template class TTDecouplerT <TTDefaultMetrics> ;
+
+template class TTBlockT <TTOverviewMetrics> ;
+template class TTPointT <TTOverviewMetrics> ;
+template class TTDoublePointT <TTOverviewMetrics> ;
+template class TTSlipT <TTOverviewMetrics> ;
+template class TTDiagT <TTOverviewMetrics> ;
+template class TTArrowT <TTOverviewMetrics> ;
+template class TTBufferT <TTOverviewMetrics> ;
+template class TTDecouplerT <TTOverviewMetrics> ;
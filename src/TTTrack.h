@@ -10,11 +10,27 @@
 #define TTTrack_h
 
 #include "AWView.h"
+#include "TTDraw.h"
+#include "TTConfig.h"
+
+class TTViewport ;
+class TTDirtyRegion ;
+class TTStateWriter ;
+class TTStateReader ;
 
 typedef enum { kMiddle, kTopDiagonal, kBottomDiagonal } BlockInOutShape ;
 typedef enum { kStraightPosition, kMiddlePosition, kDiagonalPosition, kNoPosition } TTPointPosition ;
 typedef enum { kCanicheUnknownPosition, kCanicheRightPosition, kCanicheMiddlePosition, kCanicheLeftPosition } TTCanichePointPosition ;
 typedef enum { kNormal, kLarge, kLargeNoSync } TTDoublePointSize ;
+typedef enum { kTTViewKind, kTTTrackKind, kTTBlockKind, kTTPointKind, kTTDoublePointKind, kTTSlipKind,
+               kTTDiagKind, kTTArrowKind, kTTBufferKind, kTTDecouplerKind, kTTSignalKind,
+               kTTNumberOfTileKinds } TTTileKind ;
+//--- Metrics a tile class is instantiated with (see TTGridMetrics)
+typedef enum { kTTDefaultScale, kTTOverviewScale, kTTNumberOfTileScales } TTTileScale ;
+//--- Origin of a change: the operator on the screen, the sketch through
+//    the static setters (see TTChange.h) or the other board through
+//    TTSyncDecoder, which drives its own hardware (see TTSync.h)
+typedef enum { kTTTouchSource, kTTRemoteSource, kTTSyncSource } TTChangeSource ;
   
 static const bool kForward = false;
 static const bool kBackward = true;
@@ -33,12 +49,63 @@ AWRect computeTileRelativeFrame(const AWPoint & inOrigin,
                                 const AWInt inWidth,
                                 const AWInt inHeight) ;
 
+//-----------------------------------------------------------------------------
+// Size of the tiles in pixels. The tile classes are templates parameterized
+// by the metrics so that all the geometry is constant for each of them.
+// TTTrack.cpp instantiates them for TTDefaultMetrics and TTOverviewMetrics.
+template <AWInt GRID, AWInt STRAIGHT, AWInt DIAGONAL> class TTGridMetrics {
+  public : static const AWInt kGrid = GRID ;
+  public : static const AWInt kStraightWidth = STRAIGHT ;
+  public : static const AWInt kDiagonalWidth = DIAGONAL ;
+  //--- Offset of a straight track from the side of its tile
+  public : static const AWInt kTrackOffset = (GRID - STRAIGHT) / 2 ;
+  //--- Margin around the frame of the tiles having diagonal tracks
+  public : static const AWInt kMargin = DIAGONAL / 2 ;
+  //--- Corner radius of the buttons, inset of the touch zone in the frame
+  //    and of the tags in the buttons, designed for the 25 pixels grid
+  public : static const AWInt kButtonRadius = (4 * GRID) / 25 ;
+  public : static const AWInt kTouchInset = (3 * GRID) / 25 ;
+  public : static const AWInt kTagInset = (5 * GRID) / 25 ;
+  public : static const TTTileScale kScale = (GRID == TILE_PIXEL_GRID) ? kTTDefaultScale : kTTOverviewScale ;
+
+  //--- Pixel dimension designed for the 25 pixels grid
+  public : static AWInt scaled (const AWInt inPixels) { return (inPixels * GRID) / 25 ; }
+
+  public : static AWRect tileFrame (const AWPoint & inOrigin,
+                                    const AWInt inWidth,
+                                    const AWInt inHeight)
+  {
+    return AWRect (AWPoint (inOrigin.x * GRID, inOrigin.y * GRID),
+                   AWSize (inWidth * GRID, inHeight * GRID)) ;
+  }
+
+  public : static AWRect tileFrameWithMargin (const AWPoint & inOrigin,
+                                              const AWInt inWidth,
+                                              const AWInt inHeight)
+  {
+    return AWRect (AWPoint (inOrigin.x * GRID - kMargin, inOrigin.y * GRID - kMargin),
+                   AWSize (inWidth * GRID + 2 * kMargin, inHeight * GRID + 2 * kMargin)) ;
+  }
+
+  public : static AWRect decouplerFrame (const AWPoint & inOrigin)
+  {
+    return AWRect (AWPoint (inOrigin.x * GRID - GRID / 4, inOrigin.y * GRID - GRID / 4),
+                   AWSize (GRID + GRID / 2, GRID + GRID / 2)) ;
+  }
+};
+
+typedef TTGridMetrics <TILE_PIXEL_GRID, STRAIGHT_TRACK_WIDTH, DIAGONAL_TRACK_WIDTH> TTDefaultMetrics ;
+typedef TTGridMetrics <OVERVIEW_TILE_PIXEL_GRID, OVERVIEW_STRAIGHT_TRACK_WIDTH, OVERVIEW_DIAGONAL_TRACK_WIDTH> TTOverviewMetrics ;
+
 //-----------------------------------------------------------------------------
 class TTView : public AWView {
   
   public : TTView (const AWPoint & inOrigin, const AWInt inSizeX, const AWInt inSizeY, const String & inTitle = "") ;
+  public : TTView (const AWPoint & inOrigin, const AWInt inSizeX, const AWInt inSizeY, const AWInt inGrid, const String & inTitle = "") ;
   
   private : String mTitle ;
+  private : AWInt mGrid ;
+  public : AWInt grid () const { return mGrid ; }
   
   //--- Tell the view is opaque or not
   public : virtual bool isOpaque (void) const ;
@@ -53,6 +120,74 @@ class TTTile : public AWView {
                    const AWInt inWidth,
                    const AWInt inHeight) ;
   public : TTTile (const AWRect & inFrame) ;
+  public : virtual ~TTTile (void) ;
+
+  //--- The tiles are allocated from the layout arena (see TTArena.h)
+  public : static void * operator new (size_t inSize) ;
+  public : static void * operator new (size_t inSize, void * inPlace) ;
+  public : static void operator delete (void * inPointer) ;
+
+  //--- All the tiles, in construction order. A pointer per tile, see
+  //    TTStressBenchmark::footprint for its share of a layout
+  private : static TTTile * sFirstTile ;
+  private : static TTTile * sLastTile ;
+  private : TTTile * mNextTile ;
+  public : static TTTile * firstTile (void) { return sFirstTile ; }
+  public : TTTile * nextTile (void) const { return mNextTile ; }
+  private : void appendToTileList (void) ;
+  //--- Unlinks inTiles, given in construction order, in one walk of the
+  //    list. Their destructors then skip the search, so deleting a whole
+  //    generated layout is linear
+  public : static void removeFromTileList (TTTile * const * inTiles,
+                                           const uint16_t inCount) ;
+
+  //--- Class of the tile: its kind and the scale of its metrics
+  public : virtual TTTileKind tileKind (void) const ;
+  public : virtual TTTileScale tileScale (void) const { return kTTDefaultScale ; }
+
+  //--- Viewport displaying the tile, NULL when the tile is a subview. The
+  //    viewports keep their tiles (see TTViewport::viewportOf), so the
+  //    tiles which are subviews do not pay for it
+  public : TTViewport * viewport (void) const ;
+
+  //--- Redraw requests go through the viewport when there is one and are
+  //    forwarded to every TTDisplay
+  protected : void invalidate (void) ;
+  protected : void invalidateRect (const AWRect & inRect) ;
+  //--- Viewport or AWView part of invalidateRect
+  private : void invalidateView (const AWRect & inRect) ;
+
+  //--- By default each tile which is a subview calls setNeedsDisplay on
+  //    itself, so a route redraws the screen one tile at a time. Once
+  //    mergeInvalidations is called, the rectangles go into ioRegion and
+  //    flushInvalidations, called from loop (), sends the merged ones to
+  //    inView, the view holding the tiles. NULL goes back to the default
+  public : static void mergeInvalidations (AWView * inView, TTDirtyRegion * ioRegion) ;
+  public : static void flushInvalidations (void) ;
+  private : static AWView * sInvalidatedView ;
+  private : static TTDirtyRegion * sInvalidatedRegion ;
+
+  //--- Blinking (see TTBlink.h). blinking () tells if the current state of
+  //    the tile blinks, blinkRect () is the part redrawn when the phase flips
+  public : virtual bool blinking (void) const { return false ; }
+  public : virtual AWRect blinkRect (void) const { return absoluteFrame () ; }
+  //--- Registers or unregisters the tile, called when its state changes
+  protected : void updateBlinking (void) ;
+
+  friend class TTBlinkClock ;
+
+  //--- State saved in a TTSnapshot, restored without any redraw request
+  //    nor action since it is done before the first paint
+  public : virtual void saveState (TTStateWriter & ioWriter) const ;
+  public : virtual void restoreState (TTStateReader & ioReader) ;
+
+#ifdef TT_PROFILE
+  //--- Primitives issued by the last drawInRegion of the current frame
+  public : const TTDrawCounters & drawCounters (void) const ;
+  public : TTDrawCounters & drawCountersOfFrame (const uint16_t inFrame) const ;
+  private : mutable TTDrawCounters mDrawCounters ;
+  private : mutable uint16_t mDrawCountersFrame ;
+#endif
 };
 
 //-----------------------------------------------------------------------------
@@ -65,11 +200,10 @@ class TTTrack : public TTTile {
   public : TTTrack (const AWRect & inRect,
                     const bool inIsReverted) ;
   
-  //--- Direction
+  //--- Direction, the tracks are always drawn forward
   private : bool mIsReverted ;
   public : bool isReverted() const { return mIsReverted; }
-  private : bool mDirection ;
-  public : bool direction ()  const { return mDirection ;  }
+  public : bool direction ()  const { return kForward ;  }
   
   //--- Tell the view is opaque or not
   public : virtual bool isOpaque (void) const ;
@@ -80,21 +214,34 @@ class TTTrack : public TTTile {
 };
 
 //-----------------------------------------------------------------------------
-class TTBlock : public TTTrack {
-  public : TTBlock (const AWPoint & inOrigin,
-                    const AWInt inLength,
-                    const BlockInOutShape inInShape = kMiddle,
-                    const BlockInOutShape inOutShape = kMiddle,
-                    const bool inIsReverted = false) ;
-  
-  private : BlockInOutShape mInShape ;
-  private : BlockInOutShape mOutShape ;
-  private : bool mDashed ;
-  public : void setDashed (const bool inDashed) { mDashed = inDashed ; setNeedsDisplay () ; }
+template <class M> class TTBlockT : public TTTrack {
+  public : TTBlockT (const AWPoint & inOrigin,
+                     const AWInt inLength,
+                     const BlockInOutShape inInShape = kMiddle,
+                     const BlockInOutShape inOutShape = kMiddle,
+                     const bool inIsReverted = false) ;
   
+  //--- Packed in one byte
+  private : BlockInOutShape mInShape : 2 ;
+  private : BlockInOutShape mOutShape : 2 ;
+  private : bool mDashed : 1 ;
+  public : void setDashed (const bool inDashed) { mDashed = inDashed ; invalidate () ; }
+  //--- An alarmed block is drawn in alarmColor and may blink
+  private : bool mAlarm : 1 ;
+  public : void setAlarm (const bool inAlarm) ;
+  public : bool alarm (void) const { return mAlarm ; }
+  public : virtual bool blinking (void) const ;
+  public : virtual AWRect blinkRect (void) const ;
+  
+  public : virtual TTTileKind tileKind (void) const { return kTTBlockKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
+  public : virtual void saveState (TTStateWriter & ioWriter) const ;
+  public : virtual void restoreState (TTStateReader & ioReader) ;
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
 };
 
+typedef TTBlockT <TTDefaultMetrics> TTBlock ;
+
 //-----------------------------------------------------------------------------
 class TTTouchableTrack : public TTTrack {
   public : TTTouchableTrack (const AWPoint & inOrigin,
@@ -113,29 +260,52 @@ class TTTouchableTrack : public TTTrack {
   public : virtual void touchUp (const AWPoint & inPoint) ;
   
   protected : virtual void toggle() ;
+
+  //--- Inset of the touch zone in the frame, TTDefaultMetrics::kTouchInset
+  //    unless the metrics of the subclass say otherwise
+  protected : virtual AWInt touchInset (void) const ;
+
+  friend class TTGoldenHarness ;
+  friend class TTStressBenchmark ;
 };
 
 //-----------------------------------------------------------------------------
 static const int kTTMaxNumberOfPoints = 64 ;
 
+//--- Positions packed 2 bits per point, point i in bits 2 * (i % 16) of word i / 16
+static const int kTTPointsPerWord = 16 ;
+static const int kTTPositionWords = (kTTMaxNumberOfPoints + kTTPointsPerWord - 1) / kTTPointsPerWord ;
+
 //-----------------------------------------------------------------------------
 class TTAbstractPoint : public TTTouchableTrack
 {
   public : TTAbstractPoint (const AWPoint & inOrigin,
                             const AWInt inWidth,
                             const AWInt inHeight,
+                            const bool inWay,
                             const bool inIsReverted) ;
   public : TTAbstractPoint (const AWRect & inRect,
+                            const bool inWay,
                             const bool inIsReverted) ;
+  public : virtual ~TTAbstractPoint (void) ;
+
+  protected : bool mWay ;
+  public : bool way (void) const { return mWay ; }
   
   //--- static data and methods to handle the collection of points
   private : static TTAbstractPoint * sPointForIdentifier[kTTMaxNumberOfPoints] ;
   public : static void setActualPositionOfPoint (const uint8_t inPointId,
                                                  const TTPointPosition inPosition) ;
+  //--- The action of the point is not sent for kTTSyncSource
   public : static void setWishedPositionOfPoint (const uint8_t inPointId,
-                                                 const TTPointPosition inPosition) ;
+                                                 const TTPointPosition inPosition,
+                                                 const TTChangeSource inSource = kTTRemoteSource) ;
   public : static TTPointPosition actualPositionOfPoint (const uint8_t inPointId) ;
   public : static TTPointPosition wishedPositionOfPoint (const uint8_t inPointId) ;
+  public : static bool pointExists (const uint8_t inPointId) ;
+  //--- The wish of the point has not been reached in time (see TTTimeout.h)
+  public : static void setWishFailedOfPoint (const uint8_t inPointId) ;
+  public : static bool wishFailedOfPoint (const uint8_t inPointId) ;
   
   public : static void setCanicheActualPositionOfPoint(const uint8_t inPointId,
                                                        const TTCanichePointPosition inPosition) ;
@@ -148,55 +318,80 @@ class TTAbstractPoint : public TTTouchableTrack
   
   //--- Register
   protected : void registerPointId (const uint8_t inPointId) ;
+
+  //--- Arms the deadline of a wish not reached yet, disarms it otherwise.
+  //    The caller clears the failure of the previous wish first
+  protected : void watchWish (const uint8_t inPointId,
+                              const bool inPending) ;
   
   //--- Caniche to TT position and TT to Caniche position
-  private : virtual TTCanichePointPosition pointToCanichePosition (TTPointPosition inPos) = 0 ;
-  private : virtual TTPointPosition canicheToPointPosition (TTCanichePointPosition inPos) = 0 ;
+  private : TTCanichePointPosition pointToCanichePosition (TTPointPosition inPos) const ;
+  private : TTPointPosition canicheToPointPosition (TTCanichePointPosition inPos) const ;
+
+  //--- Bulk conversion of packed positions. Bits of sWayMask are set for
+  //    the right hand points, the conversion of a word is a few bitwise
+  //    operations whatever the number of points
+  private : static uint32_t sWayMask [kTTPositionWords] ;
+  public : static void canicheToPointPositions (const uint32_t * inCanichePositions,
+                                                uint32_t * outPositions,
+                                                const uint8_t inWordCount = kTTPositionWords) ;
+  public : static void pointToCanichePositions (const uint32_t * inPositions,
+                                                uint32_t * outCanichePositions,
+                                                const uint8_t inWordCount = kTTPositionWords) ;
+  public : static void setCanicheActualPositionOfPoints (const uint32_t * inCanichePositions,
+                                                         const uint8_t inWordCount = kTTPositionWords) ;
   
   //--- Pure virtual methods for points interface
   private : virtual void setActualPosition (const uint8_t inPointId,
                                            const TTPointPosition inPosition) = 0 ;
   private : virtual void setWishedPosition (const uint8_t inPointId,
-                                           const TTPointPosition inPosition) = 0 ;
+                                           const TTPointPosition inPosition,
+                                           const TTChangeSource inSource) = 0 ;
   private : virtual TTPointPosition actualPosition (const uint8_t inPointId) = 0 ;
   private : virtual TTPointPosition wishedPosition (const uint8_t inPointId) = 0 ;
+  private : virtual void setWishFailed (const uint8_t inPointId) = 0 ;
+  private : virtual bool wishFailed (const uint8_t inPointId) = 0 ;
   public : virtual TTPointPosition pendingWish (uint8_t & outPointId) = 0 ;
   public : TTCanichePointPosition pendingCanicheWish (uint8_t & outPointId) ;
+
+  friend class TTStressBenchmark ;
 };
 
 //-----------------------------------------------------------------------------
-class TTDoublePoint : public TTAbstractPoint {
-  public : TTDoublePoint (const AWPoint & inOrigin,
-                          const uint8_t inTopPointId,
-                          const uint8_t inBottomPointId,
-                          const bool inWay,
-                          const TTDoublePointSize inSize = kNormal,
-                          const bool inIsReverted = false) ;
-  
+template <class M> class TTDoublePointT : public TTAbstractPoint {
+  public : TTDoublePointT (const AWPoint & inOrigin,
+                           const uint8_t inTopPointId,
+                           const uint8_t inBottomPointId,
+                           const bool inWay,
+                           const TTDoublePointSize inSize = kNormal,
+                           const bool inIsReverted = false) ;
+  
+  //--- The state is packed in bit fields, 3 bytes with the touch and the
+  //    toggle state below
   private : uint8_t mTopPointId ;
   private : uint8_t mBottomPointId ;
-  private : bool mWay ;
-  private : TTDoublePointSize mSize ;
-  private : TTPointPosition mWishedTopPosition ;
-  private : TTPointPosition mWishedBottomPosition ;
-  private : TTPointPosition mActualTopPosition ;
-  private : TTPointPosition mActualBottomPosition ;
-  private : bool mPendingWishedTopPosition ;
-  private : bool mPendingWishedBottomPosition ;
+  private : TTDoublePointSize mSize : 2 ;
+  private : TTPointPosition mWishedTopPosition : 2 ;
+  private : TTPointPosition mWishedBottomPosition : 2 ;
+  private : TTPointPosition mActualTopPosition : 2 ;
+  private : TTPointPosition mActualBottomPosition : 2 ;
+  private : bool mPendingWishedTopPosition : 1 ;
+  private : bool mPendingWishedBottomPosition : 1 ;
+  private : bool mTopWishFailed : 1 ;
+  private : bool mBottomWishFailed : 1 ;
 
   //--- Virtual methods for points interface
   private : virtual void setActualPosition (const uint8_t inPointId,
                                            const TTPointPosition inPosition) ;
   private : virtual void setWishedPosition (const uint8_t inPointId,
-                                           const TTPointPosition inPosition) ;
+                                           const TTPointPosition inPosition,
+                                           const TTChangeSource inSource) ;
   private : virtual TTPointPosition actualPosition (const uint8_t inPointId) ;
   private : virtual TTPointPosition wishedPosition (const uint8_t inPointId) ;
+  private : virtual void setWishFailed (const uint8_t inPointId) ;
+  private : virtual bool wishFailed (const uint8_t inPointId) ;
   public : virtual TTPointPosition pendingWish (uint8_t & outPointId) ;
   
-  //--- Caniche to TT position and TT to Caniche position
-  private : virtual TTCanichePointPosition pointToCanichePosition (TTPointPosition inPos) ;
-  private : virtual TTPointPosition canicheToPointPosition (TTCanichePointPosition inPos) ;
-  
   //--- Drawing
   private : void drawTopStraight (const AWRegion & inDrawRegion,
                                   const AWColor inStraightColor ) const ;
@@ -206,122 +401,161 @@ class TTDoublePoint : public TTAbstractPoint {
                                   const AWColor inDiagonalColor ) const ;
   private : void drawBottomDiagonal (const AWRegion & inDrawRegion,
                                      const AWColor inDiagonalColor ) const ;
+  public : virtual TTTileKind tileKind (void) const { return kTTDoublePointKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
+  public : virtual bool blinking (void) const ;
+  public : virtual void saveState (TTStateWriter & ioWriter) const ;
+  public : virtual void restoreState (TTStateReader & ioReader) ;
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
   
   private : void drawStraightLogo (AWRect &inButton, const AWRegion & inDrawRegion) const ;
   private : void drawDiagonalLogo (AWRect &inButton, const AWRegion & inDrawRegion) const ;
 
-  //--- Touch
-  private : uint8_t mTouchLocation ; // 0, 1, 2 or 3
-  private : AWRect mFeedbackRect ;
-  private : bool mTouchInProgress ;
+  //--- Touch. The feedback rectangle is the quarter of the button at
+  //    mTouchLocation
+  private : uint8_t mTouchLocation : 2 ; // 0, 1, 2 or 3
+  private : bool mTouchInProgress : 1 ;
+  private : AWRect feedbackRect (void) const ;
   
   public : virtual void touchDown (const AWPoint & inPoint) ;
   public : virtual void touchMove (const AWPoint & inPoint) ;
   public : virtual void touchUp (const AWPoint & inPoint) ;
   
   //--- Internal toggle methods and state attributes
-  private : bool mTopToggled ;
-  private : bool mBottomToggled ;
+  private : bool mTopToggled : 1 ;
+  private : bool mBottomToggled : 1 ;
   
   private : void toggleTop () ;
   private : void toggleBottom () ;
   private : void setStraight () ;
   private : void setDiagonal () ;
   protected : virtual void toggle () ;
-  
+  private : void notifyWishChanges (const TTPointPosition inOldTopPosition,
+                                    const TTPointPosition inOldBottomPosition,
+                                    const TTChangeSource inSource) const ;
+
+  friend class TTGoldenHarness ;
 };
 
+typedef TTDoublePointT <TTDefaultMetrics> TTDoublePoint ;
+
 //-----------------------------------------------------------------------------
-class TTPoint : public TTAbstractPoint {
-  public : TTPoint (const AWPoint & inOrigin,
-                    const uint8_t inPointId,
-                    const bool inWay,
-                    const bool inInDiagonal,
-                    const bool inoutDiagonal,
-                    const bool inIsReverted = false) ;
+template <class M> class TTPointT : public TTAbstractPoint {
+  public : TTPointT (const AWPoint & inOrigin,
+                     const uint8_t inPointId,
+                     const bool inWay,
+                     const bool inInDiagonal,
+                     const bool inoutDiagonal,
+                     const bool inIsReverted = false) ;
   
+  //--- The state is packed in bit fields, 2 bytes with mToggled
   private : uint8_t mPointId ;
-  private : bool mWay ;
-  private : bool mInDiagonal ;
-  private : bool mOutDiagonal ;
-  private : TTPointPosition mWishedPosition ;
-  private : TTPointPosition mActualPosition ;
-  private : bool mPendingWishedPosition ;
+  private : bool mInDiagonal : 1 ;
+  private : bool mOutDiagonal : 1 ;
+  private : TTPointPosition mWishedPosition : 2 ;
+  private : TTPointPosition mActualPosition : 2 ;
+  private : bool mPendingWishedPosition : 1 ;
+  private : bool mWishFailed : 1 ;
   
   //--- Virtual methods for points interface
   private : virtual void setActualPosition (const uint8_t inPointId,
                                            const TTPointPosition inPosition) ;
   private : virtual void setWishedPosition (const uint8_t inPointId,
-                                           const TTPointPosition inPosition) ;
+                                           const TTPointPosition inPosition,
+                                           const TTChangeSource inSource) ;
   private : virtual TTPointPosition actualPosition (const uint8_t inPointId) ;
   private : virtual TTPointPosition wishedPosition (const uint8_t inPointId) ;
+  private : virtual void setWishFailed (const uint8_t inPointId) ;
+  private : virtual bool wishFailed (const uint8_t inPointId) ;
   public : virtual TTPointPosition pendingWish (uint8_t & outPointId) ;
 
-  //--- Caniche to TT position and TT to Caniche position
-  private : virtual TTCanichePointPosition pointToCanichePosition (TTPointPosition inPos) ;
-  private : virtual TTPointPosition canicheToPointPosition (TTCanichePointPosition inPos) ;
-  
   //--- Drawing
   private : void drawStraight (const AWRegion & inDrawRegion,
                                const AWColor inStraightColor ) const ;
   private : void drawDiagonal (const AWRegion & inDrawRegion,
                                const AWColor inDiagonalColor ) const ;
+  public : virtual TTTileKind tileKind (void) const { return kTTPointKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
+  public : virtual bool blinking (void) const ;
+  public : virtual void saveState (TTStateWriter & ioWriter) const ;
+  public : virtual void restoreState (TTStateReader & ioReader) ;
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
 
   //--- Internal toggle methods and state attributes
-  private : bool mToggled ;
+  private : bool mToggled : 1 ;
   
   protected : virtual void toggle() ;
+  protected : virtual AWInt touchInset (void) const { return M::kTouchInset ; }
+
+  friend class TTGoldenHarness ;
 };
 
+typedef TTPointT <TTDefaultMetrics> TTPoint ;
+
 //-----------------------------------------------------------------------------
-class TTSlip : public TTTrack {
-  public : TTSlip (const AWPoint & inOrigin,
-                   const int  inKind,
-                   const bool inWay = kLeftHand,
-                   const bool inIsReverted = false) ;
+template <class M> class TTSlipT : public TTTrack {
+  public : TTSlipT (const AWPoint & inOrigin,
+                    const int  inKind,
+                    const bool inWay = kLeftHand,
+                    const bool inIsReverted = false) ;
   
-  private : bool mKind ;
-  private : bool mWay ;
+  private : bool mKind : 1 ;
+  private : bool mWay : 1 ;
   
+  public : virtual TTTileKind tileKind (void) const { return kTTSlipKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
 };
 
+typedef TTSlipT <TTDefaultMetrics> TTSlip ;
+
 //-----------------------------------------------------------------------------
-class TTDiag : public TTTrack {
-  public : TTDiag (const AWPoint & inOrigin,
-                   const AWInt inSize,
-                   const bool inWay = kLeftHand,
-                   const bool inIsReverted = false) ;
+template <class M> class TTDiagT : public TTTrack {
+  public : TTDiagT (const AWPoint & inOrigin,
+                    const AWInt inSize,
+                    const bool inWay = kLeftHand,
+                    const bool inIsReverted = false) ;
   
   private : bool mWay ;
   
+  public : virtual TTTileKind tileKind (void) const { return kTTDiagKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
 };
 
+typedef TTDiagT <TTDefaultMetrics> TTDiag ;
+
 //-----------------------------------------------------------------------------
-class TTArrow : public TTTrack {
-  public : TTArrow (const AWPoint & inOrigin,
-                    const bool inIsReverted = false) ;
+template <class M> class TTArrowT : public TTTrack {
+  public : TTArrowT (const AWPoint & inOrigin,
+                     const bool inIsReverted = false) ;
   
+  public : virtual TTTileKind tileKind (void) const { return kTTArrowKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
 };
 
+typedef TTArrowT <TTDefaultMetrics> TTArrow ;
+
 //-----------------------------------------------------------------------------
-class TTBuffer : public TTTrack {
-  public : TTBuffer (const AWPoint & inOrigin,
-                     const bool inIsReverted = false) ;
+template <class M> class TTBufferT : public TTTrack {
+  public : TTBufferT (const AWPoint & inOrigin,
+                      const bool inIsReverted = false) ;
   
+  public : virtual TTTileKind tileKind (void) const { return kTTBufferKind ; }
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
 };
 
+typedef TTBufferT <TTDefaultMetrics> TTBuffer ;
+
 //-----------------------------------------------------------------------------
 static const int kTTMaxNumberOfDecouplers = 64 ;
 
 //-----------------------------------------------------------------------------
-class TTDecoupler : public TTTouchableTrack {
-  public : TTDecoupler (const AWPoint & inOrigin, const uint8_t inDecouplerId) ;
+class TTAbstractDecoupler : public TTTouchableTrack {
+  public : TTAbstractDecoupler (const AWRect & inFrame, const uint8_t inDecouplerId) ;
+  public : virtual ~TTAbstractDecoupler (void) ;
   
   private : bool mPosition ;
   private : uint8_t mDecouplerId ;
@@ -329,20 +563,41 @@ class TTDecoupler : public TTTouchableTrack {
   public : uint8_t identifier () const { return mDecouplerId ; }
   
   //--- static data and methods to handle the collection of points
-  private : static TTDecoupler *sDecouplerForIdentifier[kTTMaxNumberOfDecouplers] ;
+  private : static TTAbstractDecoupler *sDecouplerForIdentifier[kTTMaxNumberOfDecouplers] ;
   public : static bool positionOfDecoupler (const uint8_t inDecouplerId) ;
+  public : static void setPositionOfDecoupler (const uint8_t inDecouplerId,
+                                               const bool inPosition,
+                                               const TTChangeSource inSource = kTTRemoteSource) ;
+  public : static bool decouplerExists (const uint8_t inDecouplerId) ;
   public : static void setActionOfDecoupler (const uint8_t inDecouplerId, AWAction inAction) ;
   public : static void setActionOfAllDecouplers (AWAction inAction) ;
   
   //--- Register
   protected : void registerDecouplerId (const uint8_t inDecouplerId) ;
   
+  public : virtual TTTileKind tileKind (void) const { return kTTDecouplerKind ; }
+  public : virtual void saveState (TTStateWriter & ioWriter) const ;
+  public : virtual void restoreState (TTStateReader & ioReader) ;
+
+  protected : virtual void toggle() ;
+
+  friend class TTGoldenHarness ;
+  friend class TTJournalReplay ;
+};
+
+//-----------------------------------------------------------------------------
+template <class M> class TTDecouplerT : public TTAbstractDecoupler {
+  public : TTDecouplerT (const AWPoint & inOrigin, const uint8_t inDecouplerId) ;
+  
   //--- Draw
   public : virtual void drawInRegion ( const AWRegion & inDrawRegion ) const ;
+  public : virtual TTTileScale tileScale (void) const { return M::kScale ; }
 
-  protected : virtual void toggle() ;
+  protected : virtual AWInt touchInset (void) const { return M::kTouchInset ; }
 };
 
+typedef TTDecouplerT <TTDefaultMetrics> TTDecoupler ;
+
 //-----------------------------------------------------------------------------
 //class TTDecouplerButton
 
@@ -0,0 +1,391 @@
+//
+//  TTViewport.cpp
+//  CocoaSimulator
+//
+
+#include "TTViewport.h"
+#include "TTConfig.h"
+#include "TTProfiler.h"
+
+//-----------------------------------------------------------------------------
+static bool intersect (const AWRect & inA, const AWRect & inB, AWRect & outRect)
+{
+  const AWInt left = inA.origin.x > inB.origin.x ? inA.origin.x : inB.origin.x ;
+  const AWInt top = inA.origin.y > inB.origin.y ? inA.origin.y : inB.origin.y ;
+  const AWInt rightA = inA.origin.x + inA.size.width ;
+  const AWInt rightB = inB.origin.x + inB.size.width ;
+  const AWInt bottomA = inA.origin.y + inA.size.height ;
+  const AWInt bottomB = inB.origin.y + inB.size.height ;
+  const AWInt right = rightA < rightB ? rightA : rightB ;
+  const AWInt bottom = bottomA < bottomB ? bottomA : bottomB ;
+  if (right > left && bottom > top) {
+    outRect = AWRect (AWPoint (left, top), AWSize (right - left, bottom - top)) ;
+    return true ;
+  }
+  else {
+    return false ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+static AWRect unite (const AWRect & inA, const AWRect & inB)
+{
+  const AWInt left = inA.origin.x < inB.origin.x ? inA.origin.x : inB.origin.x ;
+  const AWInt top = inA.origin.y < inB.origin.y ? inA.origin.y : inB.origin.y ;
+  const AWInt rightA = inA.origin.x + inA.size.width ;
+  const AWInt rightB = inB.origin.x + inB.size.width ;
+  const AWInt bottomA = inA.origin.y + inA.size.height ;
+  const AWInt bottomB = inB.origin.y + inB.size.height ;
+  return AWRect (AWPoint (left, top),
+                 AWSize ((rightA > rightB ? rightA : rightB) - left,
+                         (bottomA > bottomB ? bottomA : bottomB) - top)) ;
+}
+
+//-----------------------------------------------------------------------------
+static AWInt clamp (const AWInt inValue, const AWInt inMax)
+{
+  if (inValue > inMax) {
+    return inMax > 0 ? inMax : 0 ;
+  }
+  else if (inValue < 0) {
+    return 0 ;
+  }
+  else {
+    return inValue ;
+  }
+}
+
+//=============================================================================
+TTViewport * TTViewport::sFirstViewport = NULL ;
+
+//-----------------------------------------------------------------------------
+TTViewport::TTViewport (const AWPoint & inOrigin,
+                        const AWInt inSizeX,
+                        const AWInt inSizeY,
+                        const AWInt inLayoutSizeX,
+                        const AWInt inLayoutSizeY) :
+TTView (inOrigin, inSizeX, inSizeY),
+mTiles (NULL),
+mTileCount (0),
+mTileCapacity (0),
+mNextViewport (NULL),
+mLayoutSize (inLayoutSizeX * TTDefaultMetrics::kGrid, inLayoutSizeY * TTDefaultMetrics::kGrid),
+mScroll (0, 0),
+mBlit (NULL),
+mTouchedTile (NULL),
+mPendingRectCount (0),
+mDrawn (false)
+{
+  mNextViewport = sFirstViewport ;
+  sFirstViewport = this ;
+}
+
+//-----------------------------------------------------------------------------
+TTViewport::TTViewport (const AWPoint & inOrigin,
+                        const AWInt inSizeX,
+                        const AWInt inSizeY,
+                        const AWInt inLayoutSizeX,
+                        const AWInt inLayoutSizeY,
+                        const AWInt inGrid) :
+TTView (inOrigin, inSizeX, inSizeY, inGrid),
+mTiles (NULL),
+mTileCount (0),
+mTileCapacity (0),
+mNextViewport (NULL),
+mLayoutSize (inLayoutSizeX * inGrid, inLayoutSizeY * inGrid),
+mScroll (0, 0),
+mBlit (NULL),
+mTouchedTile (NULL),
+mPendingRectCount (0),
+mDrawn (false)
+{
+  mNextViewport = sFirstViewport ;
+  sFirstViewport = this ;
+}
+
+//-----------------------------------------------------------------------------
+TTViewport::~TTViewport (void)
+{
+  TTViewport * * link = & sFirstViewport ;
+  while (* link != this) {
+    link = & (* link)->mNextViewport ;
+  }
+  * link = mNextViewport ;
+  delete [] mTiles ;
+}
+
+//-----------------------------------------------------------------------------
+TTViewport * TTViewport::viewportOf (const TTTile * inTile)
+{
+  for (TTViewport * viewport = sFirstViewport ; viewport != NULL ; viewport = viewport->mNextViewport) {
+    if (viewport->containsTile (inTile)) {
+      return viewport ;
+    }
+  }
+  return NULL ;
+}
+
+//-----------------------------------------------------------------------------
+// Index of inTile in mTiles, or where it would be inserted
+bool TTViewport::findTile (const TTTile * inTile, uint16_t & outIndex) const
+{
+  uint16_t low = 0 ;
+  uint16_t high = mTileCount ;
+  while (low < high) {
+    const uint16_t middle = (uint16_t)((low + high) / 2) ;
+    if (mTiles [middle] < inTile) {
+      low = (uint16_t)(middle + 1) ;
+    }
+    else {
+      high = middle ;
+    }
+  }
+  outIndex = low ;
+  return low < mTileCount && mTiles [low] == inTile ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTViewport::containsTile (const TTTile * inTile) const
+{
+  uint16_t index ;
+  return findTile (inTile, index) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::addTile (TTTile * inTile)
+{
+  uint16_t index ;
+  if (inTile != NULL && ! findTile (inTile, index)) {
+    TTViewport * const previous = viewportOf (inTile) ;
+    if (previous != NULL) {
+      previous->removeTile (inTile) ;
+    }
+    if (mTileCount == mTileCapacity) {
+      const uint16_t capacity = (uint16_t)(mTileCapacity == 0 ? 8 : mTileCapacity * 2) ;
+      TTTile * * tiles = new TTTile * [capacity] ;
+      for (uint16_t i = 0 ; i < mTileCount ; i++) {
+        tiles [i] = mTiles [i] ;
+      }
+      delete [] mTiles ;
+      mTiles = tiles ;
+      mTileCapacity = capacity ;
+    }
+    for (uint16_t i = mTileCount ; i > index ; i--) {
+      mTiles [i] = mTiles [i - 1] ;
+    }
+    mTiles [index] = inTile ;
+    mTileCount++ ;
+    invalidateLayoutRect (inTile->absoluteFrame ()) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::removeTile (TTTile * inTile)
+{
+  uint16_t index ;
+  if (inTile != NULL && findTile (inTile, index)) {
+    invalidateLayoutRect (inTile->absoluteFrame ()) ;
+    mTileCount-- ;
+    for (uint16_t i = index ; i < mTileCount ; i++) {
+      mTiles [i] = mTiles [i + 1] ;
+    }
+    if (mTouchedTile == inTile) {
+      mTouchedTile = NULL ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+AWRect TTViewport::visibleLayoutRect (void) const
+{
+  return AWRect (mScroll, absoluteFrame ().size) ;
+}
+
+//-----------------------------------------------------------------------------
+bool TTViewport::isVisible (const TTTile * inTile) const
+{
+  AWRect visiblePart ;
+  return containsTile (inTile) &&
+         intersect (inTile->absoluteFrame (), visibleLayoutRect (), visiblePart) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::scrollTo (const AWPoint & inPosition)
+{
+  const AWRect screen = absoluteFrame () ;
+  const AWPoint position (clamp (inPosition.x, mLayoutSize.width - screen.size.width),
+                          clamp (inPosition.y, mLayoutSize.height - screen.size.height)) ;
+  const AWInt dx = position.x - mScroll.x ;
+  const AWInt dy = position.y - mScroll.y ;
+  if (dx == 0 && dy == 0) return ;
+  mScroll = position ;
+
+  const AWInt adx = dx > 0 ? dx : -dx ;
+  const AWInt ady = dy > 0 ? dy : -dy ;
+  if (mBlit == NULL || adx >= screen.size.width || ady >= screen.size.height) {
+    //--- Nothing to keep
+    mPendingRectCount = 0 ;
+    setNeedsDisplay () ;
+  }
+  else {
+    //--- The content moves by -dx, -dy. The pending rects move with it
+    const AWRect source (AWPoint (screen.origin.x + (dx > 0 ? dx : 0),
+                                  screen.origin.y + (dy > 0 ? dy : 0)),
+                         AWSize (screen.size.width - adx, screen.size.height - ady)) ;
+    const AWPoint destination (screen.origin.x + (dx > 0 ? 0 : adx),
+                               screen.origin.y + (dy > 0 ? 0 : ady)) ;
+    mBlit (source, destination) ;
+    AWRect pending [kPendingRectCount] ;
+    const uint8_t pendingCount = mPendingRectCount ;
+    for (uint8_t i = 0 ; i < pendingCount ; i++) {
+      pending [i] = mPendingRects [i] ;
+    }
+    mPendingRectCount = 0 ;
+    for (uint8_t i = 0 ; i < pendingCount ; i++) {
+      pending [i].translateBy (-dx, -dy) ;
+      AWRect visiblePart ;
+      if (intersect (pending [i], screen, visiblePart)) {
+        setNeedsDisplayInRect (visiblePart) ;
+        addPendingRect (visiblePart) ;
+      }
+    }
+    //--- Exposed strips
+    if (adx > 0) {
+      const AWRect strip (AWPoint (dx > 0 ? screen.origin.x + screen.size.width - adx : screen.origin.x,
+                                   screen.origin.y),
+                          AWSize (adx, screen.size.height)) ;
+      setNeedsDisplayInRect (strip) ;
+      addPendingRect (strip) ;
+    }
+    if (ady > 0) {
+      const AWRect strip (AWPoint (screen.origin.x,
+                                   dy > 0 ? screen.origin.y + screen.size.height - ady : screen.origin.y),
+                          AWSize (screen.size.width, ady)) ;
+      setNeedsDisplayInRect (strip) ;
+      addPendingRect (strip) ;
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::scrollBy (const AWInt inDeltaX, const AWInt inDeltaY)
+{
+  scrollTo (AWPoint (mScroll.x + inDeltaX, mScroll.y + inDeltaY)) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::scrollToTile (const AWInt inX, const AWInt inY)
+{
+  scrollTo (AWPoint (inX * grid (), inY * grid ())) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::invalidateLayoutRect (const AWRect & inRect)
+{
+  const AWRect screen = absoluteFrame () ;
+  AWRect r = inRect ;
+  r.translateBy (screen.origin.x - mScroll.x, screen.origin.y - mScroll.y) ;
+  AWRect visiblePart ;
+  if (intersect (r, screen, visiblePart)) {
+    setNeedsDisplayInRect (visiblePart) ;
+    addPendingRect (visiblePart) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::addPendingRect (const AWRect & inRect)
+{
+  if (mPendingRectCount < kPendingRectCount) {
+    mPendingRects [mPendingRectCount] = inRect ;
+    mPendingRectCount++ ;
+  }
+  else {
+    mPendingRects [kPendingRectCount - 1] = unite (mPendingRects [kPendingRectCount - 1], inRect) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::drawInRegion (const AWRegion & inDrawRegion) const
+{
+#ifdef TT_PROFILE
+  TTProfileScope profileScope (kTTViewKind) ;
+#endif
+  const AWRect screen = absoluteFrame () ;
+  const AWInt dx = screen.origin.x - mScroll.x ;
+  const AWInt dy = screen.origin.y - mScroll.y ;
+
+  //--- Parts to redraw, in screen coordinates: the rects the viewport
+  //    invalidated, or the whole window for a draw coming from outside. A
+  //    tile half in a part redraws its other half over the blitted copy of
+  //    itself, the same pixels
+  const bool whole = ! mDrawn || mPendingRectCount == 0 ;
+  const AWRect * parts = whole ? & screen : mPendingRects ;
+  const uint8_t partCount = whole ? 1 : mPendingRectCount ;
+  TTDraw::setColor (backColor ()) ;
+  for (uint8_t p = 0 ; p < partCount ; p++) {
+    TTDraw::fillRect (parts [p], inDrawRegion) ;
+  }
+
+  //--- The tiles touching a part draw in construction order, clipped by
+  //    inDrawRegion
+  const AWPoint savedOffset = TTDraw::offset () ;
+  TTDraw::setOffset (AWPoint (savedOffset.x + dx, savedOffset.y + dy)) ;
+  for (const TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    if (containsTile (tile)) {
+      AWRect frame = tile->absoluteFrame () ;
+      frame.translateBy (dx, dy) ;
+      bool touched = false ;
+      for (uint8_t p = 0 ; p < partCount && ! touched ; p++) {
+        AWRect common ;
+        touched = intersect (frame, parts [p], common) ;
+      }
+      if (touched) {
+        tile->drawInRegion (inDrawRegion) ;
+      }
+    }
+  }
+  TTDraw::setOffset (savedOffset) ;
+  mPendingRectCount = 0 ;
+  mDrawn = true ;
+}
+
+//-----------------------------------------------------------------------------
+AWPoint TTViewport::layoutPoint (const AWPoint & inPoint) const
+{
+  const AWRect screen = absoluteFrame () ;
+  return AWPoint (inPoint.x - screen.origin.x + mScroll.x,
+                  inPoint.y - screen.origin.y + mScroll.y) ;
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::touchDown (const AWPoint & inPoint)
+{
+  //--- The last constructed tile is on top
+  const AWPoint point = layoutPoint (inPoint) ;
+  mTouchedTile = NULL ;
+  for (TTTile * tile = TTTile::firstTile () ; tile != NULL ; tile = tile->nextTile ()) {
+    if (containsTile (tile) && tile->absoluteFrame ().containsPoint (point)) {
+      mTouchedTile = tile ;
+    }
+  }
+  if (mTouchedTile != NULL) {
+    mTouchedTile->touchDown (point) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::touchMove (const AWPoint & inPoint)
+{
+  if (mTouchedTile != NULL) {
+    mTouchedTile->touchMove (layoutPoint (inPoint)) ;
+  }
+}
+
+//-----------------------------------------------------------------------------
+void TTViewport::touchUp (const AWPoint & inPoint)
+{
+  if (mTouchedTile != NULL) {
+    mTouchedTile->touchUp (layoutPoint (inPoint)) ;
+    mTouchedTile = NULL ;
+  }
+}
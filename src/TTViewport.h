@@ -0,0 +1,107 @@
+//
+//  TTViewport.h
+//  CocoaSimulator
+//
+//  A TTView showing a window over a layout larger than the screen. The
+//  tiles of the layout are added to the viewport instead of being subviews
+//  so they keep their logical coordinates. Panning copies the pixels that
+//  stay visible and redraws only the newly exposed strips. Tiles outside
+//  the window keep their state up to date but do not draw.
+//
+
+#ifndef TTViewport_h
+#define TTViewport_h
+
+#include "TTTrack.h"
+
+//-----------------------------------------------------------------------------
+// Copies the screen rectangle inSource so that its origin lands on
+// inDestination (hardware scroll or frame buffer copy). Source and
+// destination may overlap.
+typedef void (*TTBlitFunction) (const AWRect & inSource, const AWPoint & inDestination) ;
+
+//-----------------------------------------------------------------------------
+class TTViewport : public TTView {
+  public : TTViewport (const AWPoint & inOrigin,
+                       const AWInt inSizeX,
+                       const AWInt inSizeY,
+                       const AWInt inLayoutSizeX,
+                       const AWInt inLayoutSizeY) ;
+  public : TTViewport (const AWPoint & inOrigin,
+                       const AWInt inSizeX,
+                       const AWInt inSizeY,
+                       const AWInt inLayoutSizeX,
+                       const AWInt inLayoutSizeY,
+                       const AWInt inGrid) ;
+  public : virtual ~TTViewport (void) ;
+
+  //--- Tiles of the layout, their origin is in tiles of the layout. A tile
+  //    belongs to one viewport at most, adding it moves it
+  public : void addTile (TTTile * inTile) ;
+  public : void removeTile (TTTile * inTile) ;
+
+  //--- Viewport of a tile, NULL when it is in none. The tiles are kept
+  //    sorted by address in a growing array so TTTile needs no back pointer
+  public : static TTViewport * viewportOf (const TTTile * inTile) ;
+  private : bool containsTile (const TTTile * inTile) const ;
+  private : bool findTile (const TTTile * inTile, uint16_t & outIndex) const ;
+  private : TTTile * * mTiles ;
+  private : uint16_t mTileCount ;
+  private : uint16_t mTileCapacity ;
+
+  //--- Every viewport, for viewportOf
+  private : static TTViewport * sFirstViewport ;
+  private : TTViewport * mNextViewport ;
+
+  //--- Size of the layout in pixels
+  private : AWSize mLayoutSize ;
+  public : const AWSize & layoutSize (void) const { return mLayoutSize ; }
+
+  //--- Position of the window in the layout, in pixels
+  private : AWPoint mScroll ;
+  public : const AWPoint & scrollPosition (void) const { return mScroll ; }
+  public : void scrollTo (const AWPoint & inPosition) ;
+  public : void scrollBy (const AWInt inDeltaX, const AWInt inDeltaY) ;
+  public : void scrollToTile (const AWInt inX, const AWInt inY) ;
+
+  //--- Without blit function, every scroll redraws the whole viewport
+  private : TTBlitFunction mBlit ;
+  public : void setBlitFunction (TTBlitFunction inBlit) { mBlit = inBlit ; }
+
+  //--- Part of the layout currently displayed
+  public : AWRect visibleLayoutRect (void) const ;
+  public : bool isVisible (const TTTile * inTile) const ;
+
+  //--- Called by the tiles, inRect is in layout coordinates
+  public : void invalidateLayoutRect (const AWRect & inRect) ;
+
+  public : virtual void drawInRegion (const AWRegion & inDrawRegion) const ;
+
+  //--- Touches are forwarded to the tile under the finger
+  public : virtual void touchDown (const AWPoint & inPoint) ;
+  public : virtual void touchMove (const AWPoint & inPoint) ;
+  public : virtual void touchUp (const AWPoint & inPoint) ;
+  private : TTTile * mTouchedTile ;
+  private : AWPoint layoutPoint (const AWPoint & inPoint) const ;
+
+  //--- Screen rectangles the viewport invalidated since the last draw: the
+  //    strips exposed by the scrolls and the tiles that changed. When the
+  //    array is full the last one grows. A blit moves their stale pixels,
+  //    so they are invalidated again at their new place. drawInRegion only
+  //    redraws the tiles touching them. On the first draw or with none
+  //    pending, the draw comes from outside (a view uncovering the
+  //    viewport, a scroll without blit) and every visible tile is drawn.
+  //    ArduinoWidgets does not give the bounds of the draw region, so an
+  //    exposure from outside in the same frame as a pending rect is missed
+  private : static const uint8_t kPendingRectCount = 4 ;
+  private : void addPendingRect (const AWRect & inRect) ;
+  private : mutable AWRect mPendingRects [kPendingRectCount] ;
+  private : mutable uint8_t mPendingRectCount ;
+  private : mutable bool mDrawn ;
+
+  //--- No copy
+  private : TTViewport (const TTViewport &) ;
+  private : TTViewport & operator = (const TTViewport &) ;
+};
+
+#endif /* TTViewport_h */